@@ -0,0 +1,942 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AmigaROMDatImport.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define AMIGA_ROM_DAT_BUFFER_SIZE     65536
+#define AMIGA_ROM_DAT_MAX_TOKEN_LENGTH 64
+
+typedef struct {
+	FILE *fp;
+	const char *dat_path;
+	uint8_t buffer[AMIGA_ROM_DAT_BUFFER_SIZE];
+	size_t buffer_length;
+	size_t buffer_position;
+	size_t line_number;
+	AmigaROMDatGame game;
+	AmigaROMDatRom *roms;
+	size_t rom_capacity;
+	bool in_game;
+	AmigaROMDatCallback rom_callback;
+	void *context;
+} AmigaROMDatParser;
+
+// Refills the buffer if it has been used up.
+// Returns false at the end of the file.
+static bool FillDatBuffer(AmigaROMDatParser *parser)
+{
+	if(parser->buffer_position < parser->buffer_length)
+	{
+		return true;
+	}
+
+	parser->buffer_length = fread(parser->buffer, 1, sizeof(parser->buffer), parser->fp);
+	parser->buffer_position = 0;
+
+	return (parser->buffer_length > 0);
+}
+
+static int PeekDatChar(AmigaROMDatParser *parser)
+{
+	return FillDatBuffer(parser) ? parser->buffer[parser->buffer_position] : EOF;
+}
+
+static int ReadDatChar(AmigaROMDatParser *parser)
+{
+	int c;
+
+	if(!FillDatBuffer(parser))
+	{
+		return EOF;
+	}
+
+	c = parser->buffer[parser->buffer_position++];
+	if(c == '\n')
+	{
+		parser->line_number++;
+	}
+
+	return c;
+}
+
+static bool IsDatSpace(const int c)
+{
+	return (c == ' ' || c == '\t' || c == '\r' || c == '\n');
+}
+
+// Appends c to a NUL-terminated string of capacity bytes, dropping it if
+// the string is full.
+static void AppendDatChar(char *text, size_t *length, const size_t capacity, const int c)
+{
+	if(*length + 1 < capacity)
+	{
+		text[(*length)++] = (char)c;
+		text[*length] = '\0';
+	}
+}
+
+static void ReportDatError(const AmigaROMDatParser *parser, const char *message)
+{
+	fprintf(stderr, "ERROR: %s:%zu: %s\n", parser->dat_path, parser->line_number, message);
+}
+
+static void StartDatGame(AmigaROMDatParser *parser)
+{
+	memset(&(parser->game), 0, sizeof(parser->game));
+	parser->game.line_number = parser->line_number;
+	parser->in_game = true;
+}
+
+// Adds a new, empty ROM to the current game.
+// Returns NULL if it fails.
+static AmigaROMDatRom* AddDatRom(AmigaROMDatParser *parser)
+{
+	AmigaROMDatRom *test_ptr;
+	AmigaROMDatRom *rom;
+
+	if(parser->game.rom_count == parser->rom_capacity)
+	{
+		parser->rom_capacity = parser->rom_capacity ? parser->rom_capacity * 2 : 16;
+		test_ptr = realloc(parser->roms, parser->rom_capacity * sizeof(AmigaROMDatRom));
+		if(!test_ptr)
+		{
+			ReportDatError(parser, "Out of memory.");
+			return NULL;
+		}
+
+		parser->roms = test_ptr;
+	}
+
+	rom = &(parser->roms[parser->game.rom_count++]);
+	memset(rom, 0, sizeof(AmigaROMDatRom));
+	rom->line_number = parser->line_number;
+
+	return rom;
+}
+
+// Hands every ROM of the current game to the callback.
+static bool FinishDatGame(AmigaROMDatParser *parser)
+{
+	size_t i;
+
+	parser->in_game = false;
+
+	for(i = 0; i < parser->game.rom_count; i++)
+	{
+		if(parser->roms[i].has_sha256_digest)
+		{
+			parser->game.hashed_rom_count++;
+		}
+	}
+
+	for(i = 0; i < parser->game.rom_count; i++)
+	{
+		if(!parser->rom_callback(&(parser->game), &(parser->roms[i]), parser->context))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool IsDatGameKeyword(const char *keyword)
+{
+	return (strcmp(keyword, "game") == 0 || strcmp(keyword, "machine") == 0 || strcmp(keyword, "resource") == 0);
+}
+
+static int DatHexCharToNibble(const char hex_char)
+{
+	if(hex_char >= '0' && hex_char <= '9')
+	{
+		return hex_char - '0';
+	}
+	else if(hex_char >= 'a' && hex_char <= 'f')
+	{
+		return hex_char - 'a' + 10;
+	}
+	else if(hex_char >= 'A' && hex_char <= 'F')
+	{
+		return hex_char - 'A' + 10;
+	}
+
+	return -1;
+}
+
+// Stores one game field, ignoring any this importer doesn't use.
+static void SetDatGameField(AmigaROMDatGame *game, const char *key, const char *value)
+{
+	if(strcmp(key, "name") == 0)
+	{
+		snprintf(game->name, sizeof(game->name), "%s", value);
+	}
+	else if(strcmp(key, "description") == 0)
+	{
+		snprintf(game->description, sizeof(game->description), "%s", value);
+	}
+}
+
+// Stores one ROM field, ignoring any this importer doesn't use.
+// Returns false if a size or SHA256 digest is malformed.
+static bool SetDatRomField(AmigaROMDatRom *rom, const char *key, const char *value)
+{
+	char *end;
+	int high_nibble, low_nibble;
+	size_t i;
+
+	if(strcmp(key, "name") == 0)
+	{
+		snprintf(rom->name, sizeof(rom->name), "%s", value);
+	}
+	else if(strcmp(key, "size") == 0)
+	{
+		if(*value < '0' || *value > '9')
+		{
+			return false;
+		}
+
+		rom->file_size = strtoull(value, &end, 10);
+		if(*end != '\0')
+		{
+			return false;
+		}
+
+		rom->has_file_size = true;
+	}
+	else if(strcmp(key, "sha256") == 0)
+	{
+		if(strlen(value) != 64)
+		{
+			return false;
+		}
+
+		for(i = 0; i < 32; i++)
+		{
+			high_nibble = DatHexCharToNibble(value[i * 2]);
+			low_nibble = DatHexCharToNibble(value[(i * 2) + 1]);
+			if(high_nibble < 0 || low_nibble < 0)
+			{
+				return false;
+			}
+
+			rom->sha256_digest[i] = (uint8_t)((high_nibble << 4) | low_nibble);
+		}
+
+		rom->has_sha256_digest = true;
+	}
+
+	return true;
+}
+
+// Appends code_point to text as UTF-8, dropping it if it doesn't fit whole.
+static void AppendDatCodePoint(char *text, size_t *length, const size_t capacity, const unsigned long code_point)
+{
+	size_t byte_count = (code_point < 0x80) ? 1 : (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4;
+	size_t i;
+
+	if(code_point >= 0x110000 || *length + byte_count >= capacity)
+	{
+		return;
+	}
+
+	if(byte_count == 1)
+	{
+		AppendDatChar(text, length, capacity, (int)code_point);
+		return;
+	}
+
+	// Lead byte: byte_count high bits set, then the top bits of the code point
+	AppendDatChar(text, length, capacity, (int)(((0xF00 >> byte_count) & 0xF0) | (code_point >> (6 * (byte_count - 1)))));
+	for(i = byte_count - 1; i > 0; i--)
+	{
+		AppendDatChar(text, length, capacity, (int)(0x80 | ((code_point >> (6 * (i - 1))) & 0x3F)));
+	}
+}
+
+// Decodes the XML entity following an '&' and appends it to text.  Unknown
+// entities are kept as written.
+static void ReadXmlEntity(AmigaROMDatParser *parser, char *text, size_t *length, const size_t capacity)
+{
+	char entity[12];
+	size_t entity_length = 0;
+	char *end;
+	unsigned long code_point;
+	int c;
+	size_t i;
+
+	while(entity_length + 1 < sizeof(entity))
+	{
+		c = PeekDatChar(parser);
+		if(c == EOF || c == ';' || c == '<' || c == '&' || c == '"' || c == '\'' || IsDatSpace(c))
+		{
+			break;
+		}
+
+		entity[entity_length++] = (char)ReadDatChar(parser);
+	}
+	entity[entity_length] = '\0';
+
+	if(PeekDatChar(parser) == ';')
+	{
+		ReadDatChar(parser);
+
+		if(strcmp(entity, "amp") == 0)
+		{
+			AppendDatChar(text, length, capacity, '&');
+			return;
+		}
+		else if(strcmp(entity, "lt") == 0)
+		{
+			AppendDatChar(text, length, capacity, '<');
+			return;
+		}
+		else if(strcmp(entity, "gt") == 0)
+		{
+			AppendDatChar(text, length, capacity, '>');
+			return;
+		}
+		else if(strcmp(entity, "quot") == 0)
+		{
+			AppendDatChar(text, length, capacity, '"');
+			return;
+		}
+		else if(strcmp(entity, "apos") == 0)
+		{
+			AppendDatChar(text, length, capacity, '\'');
+			return;
+		}
+		else if(entity[0] == '#' && entity_length > 1)
+		{
+			code_point = (entity[1] == 'x' || entity[1] == 'X') ? strtoul(&entity[2], &end, 16) : strtoul(&entity[1], &end, 10);
+			if(*end == '\0' && end != &entity[1] && end != &entity[2])
+			{
+				AppendDatCodePoint(text, length, capacity, code_point);
+				return;
+			}
+		}
+
+		AppendDatChar(text, length, capacity, '&');
+		for(i = 0; i < entity_length; i++)
+		{
+			AppendDatChar(text, length, capacity, entity[i]);
+		}
+		AppendDatChar(text, length, capacity, ';');
+		return;
+	}
+
+	AppendDatChar(text, length, capacity, '&');
+	for(i = 0; i < entity_length; i++)
+	{
+		AppendDatChar(text, length, capacity, entity[i]);
+	}
+}
+
+// Skips input up to and including terminator.
+// Returns false if the file ends first.
+static bool SkipDatPast(AmigaROMDatParser *parser, const char *terminator)
+{
+	size_t terminator_length = strlen(terminator);
+	size_t matched = 0;
+	int c;
+
+	while(matched < terminator_length)
+	{
+		c = ReadDatChar(parser);
+		if(c == EOF)
+		{
+			return false;
+		}
+
+		if(c == terminator[matched])
+		{
+			matched++;
+		}
+		else
+		{
+			matched = (c == terminator[0]) ? 1 : 0;
+		}
+	}
+
+	return true;
+}
+
+// Reads the rest of a CDATA section whose "<![CDATA[" has been read,
+// through its "]]>", appending its text to text unless text is NULL.
+// Returns false if the file ends first.
+static bool ReadXmlCData(AmigaROMDatParser *parser, char *text, size_t *length, const size_t capacity)
+{
+	size_t bracket_count = 0;
+	bool is_end;
+	int c;
+
+	for(;;)
+	{
+		c = ReadDatChar(parser);
+		if(c == EOF)
+		{
+			return false;
+		}
+		else if(c == ']')
+		{
+			bracket_count++;
+			continue;
+		}
+
+		// Only the last two brackets before a '>' end the section
+		is_end = (c == '>' && bracket_count >= 2);
+		if(is_end)
+		{
+			bracket_count -= 2;
+		}
+
+		for(; bracket_count > 0; bracket_count--)
+		{
+			if(text)
+			{
+				AppendDatChar(text, length, capacity, ']');
+			}
+		}
+
+		if(is_end)
+		{
+			return true;
+		}
+
+		if(text)
+		{
+			AppendDatChar(text, length, capacity, c);
+		}
+	}
+}
+
+// Reads an XML tag or attribute name, which may be truncated.
+static void ReadXmlName(AmigaROMDatParser *parser, char *name, const size_t capacity)
+{
+	size_t length = 0;
+	int c;
+
+	name[0] = '\0';
+
+	for(c = PeekDatChar(parser); c != EOF && !IsDatSpace(c) && c != '>' && c != '/' && c != '='; c = PeekDatChar(parser))
+	{
+		AppendDatChar(name, &length, capacity, ReadDatChar(parser));
+	}
+}
+
+// Reads the attributes of a start tag through its closing '>', storing the
+// ones which matter for game and rom tags.  Sets self_closing if the tag
+// ends with "/>".
+static bool ReadXmlAttributes(AmigaROMDatParser *parser, const char *tag_name, bool *self_closing)
+{
+	char attribute_name[AMIGA_ROM_DAT_MAX_TOKEN_LENGTH];
+	char value[AMIGA_ROM_DAT_MAX_NAME_LENGTH];
+	size_t value_length;
+	AmigaROMDatRom *rom = NULL;
+	int c, quote;
+
+	*self_closing = false;
+
+	if(parser->in_game && strcmp(tag_name, "rom") == 0)
+	{
+		rom = AddDatRom(parser);
+		if(!rom)
+		{
+			return false;
+		}
+	}
+
+	for(;;)
+	{
+		c = ReadDatChar(parser);
+		while(IsDatSpace(c))
+		{
+			c = ReadDatChar(parser);
+		}
+
+		if(c == '>')
+		{
+			return true;
+		}
+		else if(c == '/' && PeekDatChar(parser) == '>')
+		{
+			ReadDatChar(parser);
+			*self_closing = true;
+			return true;
+		}
+		else if(c == EOF || c == '/' || c == '=')
+		{
+			ReportDatError(parser, "Malformed tag.");
+			return false;
+		}
+
+		attribute_name[0] = (char)c;
+		attribute_name[1] = '\0';
+		ReadXmlName(parser, &attribute_name[1], sizeof(attribute_name) - 1);
+
+		c = ReadDatChar(parser);
+		while(IsDatSpace(c))
+		{
+			c = ReadDatChar(parser);
+		}
+
+		if(c != '=')
+		{
+			ReportDatError(parser, "Malformed attribute.");
+			return false;
+		}
+
+		quote = ReadDatChar(parser);
+		while(IsDatSpace(quote))
+		{
+			quote = ReadDatChar(parser);
+		}
+
+		if(quote != '"' && quote != '\'')
+		{
+			ReportDatError(parser, "Malformed attribute.");
+			return false;
+		}
+
+		value_length = 0;
+		value[0] = '\0';
+		for(c = ReadDatChar(parser); c != quote; c = ReadDatChar(parser))
+		{
+			if(c == EOF)
+			{
+				ReportDatError(parser, "Unterminated attribute.");
+				return false;
+			}
+
+			if(c == '&')
+			{
+				ReadXmlEntity(parser, value, &value_length, sizeof(value));
+			}
+			else
+			{
+				AppendDatChar(value, &value_length, sizeof(value), c);
+			}
+		}
+
+		if(rom)
+		{
+			if(!SetDatRomField(rom, attribute_name, value))
+			{
+				ReportDatError(parser, "Malformed ROM size or SHA-256 digest.");
+				return false;
+			}
+		}
+		else if(parser->in_game && IsDatGameKeyword(tag_name) && strcmp(attribute_name, "name") == 0)
+		{
+			SetDatGameField(&(parser->game), attribute_name, value);
+		}
+	}
+}
+
+// Parses a Logiqx XML datafile.  Only game (or machine) names,
+// descriptions and rom attributes are used; everything else is skipped.
+static bool ParseLogiqxDat(AmigaROMDatParser *parser)
+{
+	static const char cdata_start[] = "[CDATA[";
+	char tag_name[AMIGA_ROM_DAT_MAX_TOKEN_LENGTH];
+	size_t description_length = 0;
+	bool in_description = false;
+	bool self_closing, cdata_read;
+	size_t i;
+	int c;
+
+	while((c = ReadDatChar(parser)) != EOF)
+	{
+		if(c != '<')
+		{
+			if(in_description)
+			{
+				if(c == '&')
+				{
+					ReadXmlEntity(parser, parser->game.description, &description_length, sizeof(parser->game.description));
+				}
+				else
+				{
+					AppendDatChar(parser->game.description, &description_length, sizeof(parser->game.description), c);
+				}
+			}
+
+			continue;
+		}
+
+		c = PeekDatChar(parser);
+		if(c == '!')
+		{
+			ReadDatChar(parser);
+			if(PeekDatChar(parser) == '-')
+			{
+				if(!SkipDatPast(parser, "-->"))
+				{
+					ReportDatError(parser, "Unterminated comment.");
+					return false;
+				}
+			}
+			else if(PeekDatChar(parser) == '[')
+			{
+				for(i = 0; cdata_start[i] != '\0'; i++)
+				{
+					if(ReadDatChar(parser) != cdata_start[i])
+					{
+						ReportDatError(parser, "Malformed CDATA section.");
+						return false;
+					}
+				}
+
+				if(in_description)
+				{
+					cdata_read = ReadXmlCData(parser, parser->game.description, &description_length, sizeof(parser->game.description));
+				}
+				else
+				{
+					cdata_read = ReadXmlCData(parser, NULL, NULL, 0);
+				}
+
+				if(!cdata_read)
+				{
+					ReportDatError(parser, "Unterminated CDATA section.");
+					return false;
+				}
+			}
+			else if(!SkipDatPast(parser, ">"))
+			{
+				ReportDatError(parser, "Unterminated declaration.");
+				return false;
+			}
+		}
+		else if(c == '?')
+		{
+			if(!SkipDatPast(parser, "?>"))
+			{
+				ReportDatError(parser, "Unterminated processing instruction.");
+				return false;
+			}
+		}
+		else if(c == '/')
+		{
+			ReadDatChar(parser);
+			ReadXmlName(parser, tag_name, sizeof(tag_name));
+			if(!SkipDatPast(parser, ">"))
+			{
+				ReportDatError(parser, "Unterminated tag.");
+				return false;
+			}
+
+			if(strcmp(tag_name, "description") == 0)
+			{
+				in_description = false;
+			}
+			else if(parser->in_game && IsDatGameKeyword(tag_name) && !FinishDatGame(parser))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			ReadXmlName(parser, tag_name, sizeof(tag_name));
+
+			if(IsDatGameKeyword(tag_name))
+			{
+				if(parser->in_game)
+				{
+					ReportDatError(parser, "Nested game.");
+					return false;
+				}
+
+				StartDatGame(parser);
+			}
+
+			if(!ReadXmlAttributes(parser, tag_name, &self_closing))
+			{
+				return false;
+			}
+
+			if(self_closing && parser->in_game && IsDatGameKeyword(tag_name) && !FinishDatGame(parser))
+			{
+				return false;
+			}
+
+			if(!self_closing && parser->in_game && strcmp(tag_name, "description") == 0)
+			{
+				in_description = true;
+				description_length = 0;
+				parser->game.description[0] = '\0';
+			}
+		}
+	}
+
+	if(parser->in_game)
+	{
+		ReportDatError(parser, "Unexpected end of file inside a game.");
+		return false;
+	}
+
+	return true;
+}
+
+// Reads the next clrmamepro token into token.  Returns '(' or ')' for
+// parentheses, '"' for a quoted string, 'w' for a bare word, or EOF.  A
+// backslash in a quoted string takes the next character literally, so
+// strings may hold \" and \\.
+static int ReadClrMameProToken(AmigaROMDatParser *parser, char *token, const size_t capacity)
+{
+	size_t length = 0;
+	int c;
+
+	token[0] = '\0';
+
+	c = ReadDatChar(parser);
+	while(IsDatSpace(c))
+	{
+		c = ReadDatChar(parser);
+	}
+
+	if(c == EOF || c == '(' || c == ')')
+	{
+		return c;
+	}
+
+	if(c == '"')
+	{
+		for(c = ReadDatChar(parser); c != '"' && c != '\n' && c != EOF; c = ReadDatChar(parser))
+		{
+			if(c == '\\')
+			{
+				c = ReadDatChar(parser);
+				if(c == '\n' || c == EOF)
+				{
+					break;
+				}
+			}
+
+			AppendDatChar(token, &length, capacity, c);
+		}
+
+		return (c == '"') ? '"' : EOF;
+	}
+
+	AppendDatChar(token, &length, capacity, c);
+	for(c = PeekDatChar(parser); c != EOF && !IsDatSpace(c) && c != '(' && c != ')'; c = PeekDatChar(parser))
+	{
+		AppendDatChar(token, &length, capacity, ReadDatChar(parser));
+	}
+
+	return 'w';
+}
+
+// Skips the rest of a parenthesized block whose '(' has been read.
+static bool SkipClrMameProBlock(AmigaROMDatParser *parser)
+{
+	char token[AMIGA_ROM_DAT_MAX_TOKEN_LENGTH];
+	size_t depth = 1;
+	int token_type;
+
+	while(depth > 0)
+	{
+		token_type = ReadClrMameProToken(parser, token, sizeof(token));
+		if(token_type == EOF)
+		{
+			ReportDatError(parser, "Unexpected end of file.");
+			return false;
+		}
+
+		if(token_type == '(')
+		{
+			depth++;
+		}
+		else if(token_type == ')')
+		{
+			depth--;
+		}
+	}
+
+	return true;
+}
+
+// Parses the key and value pairs of a game or rom block whose '(' has been
+// read, through its ')'.  Nested blocks other than rom are skipped.
+static bool ParseClrMameProBlock(AmigaROMDatParser *parser, AmigaROMDatRom *rom)
+{
+	char key[AMIGA_ROM_DAT_MAX_TOKEN_LENGTH];
+	char value[AMIGA_ROM_DAT_MAX_NAME_LENGTH];
+	AmigaROMDatRom *nested_rom;
+	int token_type;
+
+	for(;;)
+	{
+		token_type = ReadClrMameProToken(parser, key, sizeof(key));
+		if(token_type == ')')
+		{
+			return true;
+		}
+		else if(token_type == EOF)
+		{
+			ReportDatError(parser, "Unexpected end of file.");
+			return false;
+		}
+		else if(token_type != 'w')
+		{
+			ReportDatError(parser, "Expected a key.");
+			return false;
+		}
+
+		token_type = ReadClrMameProToken(parser, value, sizeof(value));
+		if(token_type == '(')
+		{
+			if(!rom && strcmp(key, "rom") == 0)
+			{
+				nested_rom = AddDatRom(parser);
+				if(!nested_rom || !ParseClrMameProBlock(parser, nested_rom))
+				{
+					return false;
+				}
+			}
+			else if(!SkipClrMameProBlock(parser))
+			{
+				return false;
+			}
+		}
+		else if(token_type == 'w' || token_type == '"')
+		{
+			if(rom)
+			{
+				if(!SetDatRomField(rom, key, value))
+				{
+					ReportDatError(parser, "Malformed ROM size or SHA-256 digest.");
+					return false;
+				}
+			}
+			else
+			{
+				SetDatGameField(&(parser->game), key, value);
+			}
+		}
+		else
+		{
+			ReportDatError(parser, "Expected a value.");
+			return false;
+		}
+	}
+}
+
+// Parses a clrmamepro DAT.  Top-level blocks other than game, machine and
+// resource (such as the clrmamepro header) are skipped.
+static bool ParseClrMameProDat(AmigaROMDatParser *parser)
+{
+	char keyword[AMIGA_ROM_DAT_MAX_TOKEN_LENGTH];
+	char token[AMIGA_ROM_DAT_MAX_TOKEN_LENGTH];
+	int token_type;
+
+	while((token_type = ReadClrMameProToken(parser, keyword, sizeof(keyword))) != EOF)
+	{
+		if(token_type != 'w' || ReadClrMameProToken(parser, token, sizeof(token)) != '(')
+		{
+			ReportDatError(parser, "Expected a block.");
+			return false;
+		}
+
+		if(IsDatGameKeyword(keyword))
+		{
+			StartDatGame(parser);
+			if(!ParseClrMameProBlock(parser, NULL) || !FinishDatGame(parser))
+			{
+				return false;
+			}
+		}
+		else if(!SkipClrMameProBlock(parser))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Streams the Logiqx XML or clrmamepro DAT file at dat_path (told apart by
+// its first character) through a fixed-size buffer, calling rom_callback for
+// each ROM of each game (or machine) once the game is closed, so only one
+// game is ever held in memory.  Returns false, after reporting the offending
+// line, if the file can't be read or is malformed, or if rom_callback
+// returns false.
+bool ImportAmigaROMDat(const char *dat_path, AmigaROMDatCallback rom_callback, void *context)
+{
+	AmigaROMDatParser *parser;
+	bool result;
+	int c;
+
+	if(!dat_path || !rom_callback)
+	{
+		return false;
+	}
+
+	parser = (AmigaROMDatParser*)calloc(1, sizeof(AmigaROMDatParser));
+	if(!parser)
+	{
+		fprintf(stderr, "ERROR: Out of memory importing DAT at: %s\n", dat_path);
+		return false;
+	}
+
+	parser->fp = fopen(dat_path, "rb");
+	if(!(parser->fp))
+	{
+		fprintf(stderr, "ERROR: Unable to open DAT at: %s\n", dat_path);
+		free(parser);
+		return false;
+	}
+
+	parser->dat_path = dat_path;
+	parser->line_number = 1;
+	parser->rom_callback = rom_callback;
+	parser->context = context;
+
+	// Skip any UTF-8 byte order mark and leading whitespace
+	for(c = PeekDatChar(parser); c == 0xEF || c == 0xBB || c == 0xBF || IsDatSpace(c); c = PeekDatChar(parser))
+	{
+		ReadDatChar(parser);
+	}
+
+	result = (c == '<') ? ParseLogiqxDat(parser) : ParseClrMameProDat(parser);
+
+	if(result && ferror(parser->fp))
+	{
+		fprintf(stderr, "ERROR: Unable to read DAT at: %s\n", dat_path);
+		result = false;
+	}
+
+	fclose(parser->fp);
+	free(parser->roms);
+	free(parser);
+
+	return result;
+}
@@ -0,0 +1,71 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMDATIMPORT_H
+#define AMIGAROMDATIMPORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest game or ROM name kept; longer names are truncated.
+#define AMIGA_ROM_DAT_MAX_NAME_LENGTH 256
+
+typedef struct {
+	char name[AMIGA_ROM_DAT_MAX_NAME_LENGTH];
+	char description[AMIGA_ROM_DAT_MAX_NAME_LENGTH];
+	size_t rom_count;
+	size_t hashed_rom_count;
+	size_t line_number;
+} AmigaROMDatGame;
+
+typedef struct {
+	char name[AMIGA_ROM_DAT_MAX_NAME_LENGTH];
+	uint64_t file_size;
+	bool has_file_size;
+	uint8_t sha256_digest[32];
+	bool has_sha256_digest;
+	size_t line_number;
+} AmigaROMDatRom;
+
+// Called once for every ROM in a DAT.  Returning false stops the import.
+typedef bool (*AmigaROMDatCallback)(const AmigaROMDatGame *game, const AmigaROMDatRom *rom, void *context);
+
+// Streams the Logiqx XML or clrmamepro DAT file at dat_path (told apart by
+// its first character) through a fixed-size buffer, calling rom_callback for
+// each ROM of each game (or machine) once the game is closed, so only one
+// game is ever held in memory.  Returns false, after reporting the offending
+// line, if the file can't be read or is malformed, or if rom_callback
+// returns false.
+bool ImportAmigaROMDat(const char *dat_path, AmigaROMDatCallback rom_callback, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
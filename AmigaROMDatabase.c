@@ -0,0 +1,644 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AmigaROMDatabase.h"
+#include "AmigaROMDatabaseFormat.h"
+#include "AmigaROMDigests.h"
+#include "AmigaROMHashes.h"
+#include "AmigaROMMerkle.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define AMIGA_ROM_DATABASE_ATOMIC(type) _Atomic(type)
+#else
+// Without C11 atomics, loading a database while other threads look ROMs up
+// is not safe.
+#define AMIGA_ROM_DATABASE_ATOMIC(type) type
+#define atomic_load_explicit(object, order) (*(object))
+#define atomic_exchange_explicit(object, desired, order) ExchangeAmigaROMDatabase((object), (desired))
+static AmigaROMDatabase* ExchangeAmigaROMDatabase(AmigaROMDatabase **object, AmigaROMDatabase *desired)
+{
+	AmigaROMDatabase *previous = *object;
+
+	*object = desired;
+
+	return previous;
+}
+#endif
+
+// The mapped sections are used in place on little-endian hosts, which needs
+// the records to match the structs exactly.
+_Static_assert(sizeof(AmigaROMFingerprint) == AMIGA_ROM_DATABASE_FINGERPRINT_SIZE, "AmigaROMFingerprint must match the database record");
+_Static_assert(sizeof(AmigaROMSizeClass) == AMIGA_ROM_DATABASE_SIZE_CLASS_SIZE, "AmigaROMSizeClass must match the database record");
+
+static const AmigaROMDatabase BUILT_IN_AMIGA_ROM_DATABASE = {
+	AMIGA_ROM_INFO, AMIGA_ROM_DIGESTS, AMIGA_ROM_INFO_COUNT,
+	AMIGA_ROM_HASH_SEEDS, AMIGA_ROM_HASH_BUCKET_COUNT,
+	AMIGA_ROM_FINGERPRINTS, AMIGA_ROM_FINGERPRINT_COUNT,
+	AMIGA_ROM_SIZE_CLASSES, AMIGA_ROM_SIZE_CLASS_COUNT,
+	AMIGA_ROM_MODULES, AMIGA_ROM_MODULE_COUNT,
+	AMIGA_ROM_SIMILARITY_KEYS, AMIGA_ROM_SIMILARITY_KEY_COUNT,
+	AMIGA_ROM_BANK_CHECKSUMS, AMIGA_ROM_BANK_CHECKSUM_COUNT,
+	NULL, 0, NULL, NULL
+};
+
+// NULL while the built-in database is in use
+static AMIGA_ROM_DATABASE_ATOMIC(AmigaROMDatabase*) current_database = NULL;
+
+// Singly linked through next_retired
+static AMIGA_ROM_DATABASE_ATOMIC(AmigaROMDatabase*) retired_databases = NULL;
+
+typedef struct {
+	uint32_t format_version;
+	uint32_t header_size;
+	uint32_t file_size;
+	uint32_t entry_count;
+	uint32_t hash_bucket_count;
+	uint32_t fingerprint_count;
+	uint32_t size_class_count;
+	uint32_t seeds_offset;
+	uint32_t entries_offset;
+	uint32_t fingerprints_offset;
+	uint32_t size_classes_offset;
+	uint32_t strings_offset;
+	uint32_t strings_size;
+	uint32_t merkle_offset;
+	uint32_t merkle_size;
+	uint32_t digests_offset;
+	uint32_t module_count;
+	uint32_t modules_offset;
+	uint32_t similarity_key_count;
+	uint32_t similarity_keys_offset;
+	uint32_t bank_checksum_count;
+	uint32_t bank_checksums_offset;
+} AmigaROMDatabaseHeader;
+
+static uint32_t GetLittleEndianWord(const uint8_t *bytes)
+{
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static bool IsLittleEndianHost(void)
+{
+	const uint16_t probe = 1;
+
+	return (*(const uint8_t*)&probe == 1);
+}
+
+// Returns whether count records of record_size bytes at offset fit in a
+// file of file_size bytes, starting on an aligned boundary.
+static bool IsDatabaseSectionValid(const uint32_t offset, const uint32_t count, const size_t record_size, const uint32_t file_size)
+{
+	if(offset % AMIGA_ROM_DATABASE_ALIGNMENT != 0 || offset > file_size)
+	{
+		return false;
+	}
+
+	return ((uint64_t)count * record_size <= (uint64_t)(file_size - offset));
+}
+
+// Maps the whole file at database_path read-only.
+// Returns NULL if it fails.
+static void* MapAmigaROMDatabaseFile(const char *database_path, size_t *mapping_size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE file_handle;
+	HANDLE mapping_handle;
+	LARGE_INTEGER file_size;
+	void *mapping = NULL;
+
+	file_handle = CreateFileA(database_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file_handle == INVALID_HANDLE_VALUE)
+	{
+		return NULL;
+	}
+
+	if(GetFileSizeEx(file_handle, &file_size) && file_size.QuadPart >= AMIGA_ROM_DATABASE_HEADER_SIZE && file_size.QuadPart <= 0xFFFFFFFF)
+	{
+		mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if(mapping_handle)
+		{
+			mapping = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping_handle);
+		}
+	}
+
+	CloseHandle(file_handle);
+
+	*mapping_size = mapping ? (size_t)file_size.QuadPart : 0;
+
+	return mapping;
+#else
+	struct stat file_stat;
+	void *mapping;
+	int fd;
+
+	fd = open(database_path, O_RDONLY);
+	if(fd < 0)
+	{
+		return NULL;
+	}
+
+	if(fstat(fd, &file_stat) != 0 || file_stat.st_size < AMIGA_ROM_DATABASE_HEADER_SIZE || (uint64_t)file_stat.st_size > 0xFFFFFFFF)
+	{
+		close(fd);
+		return NULL;
+	}
+
+	mapping = mmap(NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if(mapping == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+	*mapping_size = (size_t)file_stat.st_size;
+
+	return mapping;
+#endif
+}
+
+static void UnmapAmigaROMDatabaseFile(void *mapping, const size_t mapping_size)
+{
+	if(!mapping)
+	{
+		return;
+	}
+
+#if defined(_WIN32) || defined(_WIN64)
+	(void)mapping_size;
+	UnmapViewOfFile(mapping);
+#else
+	munmap(mapping, mapping_size);
+#endif
+}
+
+static void DestroyAmigaROMDatabase(AmigaROMDatabase *database)
+{
+	if(!database)
+	{
+		return;
+	}
+
+	UnmapAmigaROMDatabaseFile(database->mapping, database->mapping_size);
+	free((void*)(database->rom_info));
+	free(database->owned_tables);
+	free(database);
+}
+
+// Reads and checks the header of a mapped database file.
+static bool ReadAmigaROMDatabaseHeader(const uint8_t *mapping, const size_t mapping_size, AmigaROMDatabaseHeader *header)
+{
+	if(mapping_size < AMIGA_ROM_DATABASE_HEADER_SIZE || memcmp(mapping, AMIGA_ROM_DATABASE_MAGIC, 8) != 0)
+	{
+		return false;
+	}
+
+	header->format_version = GetLittleEndianWord(&mapping[8]);
+	header->header_size = GetLittleEndianWord(&mapping[12]);
+	header->file_size = GetLittleEndianWord(&mapping[16]);
+	header->entry_count = GetLittleEndianWord(&mapping[20]);
+	header->hash_bucket_count = GetLittleEndianWord(&mapping[24]);
+	header->fingerprint_count = GetLittleEndianWord(&mapping[28]);
+	header->size_class_count = GetLittleEndianWord(&mapping[32]);
+	header->seeds_offset = GetLittleEndianWord(&mapping[36]);
+	header->entries_offset = GetLittleEndianWord(&mapping[40]);
+	header->fingerprints_offset = GetLittleEndianWord(&mapping[44]);
+	header->size_classes_offset = GetLittleEndianWord(&mapping[48]);
+	header->strings_offset = GetLittleEndianWord(&mapping[52]);
+	header->strings_size = GetLittleEndianWord(&mapping[56]);
+	header->merkle_offset = GetLittleEndianWord(&mapping[60]);
+	header->merkle_size = GetLittleEndianWord(&mapping[64]);
+	header->digests_offset = GetLittleEndianWord(&mapping[68]);
+	header->module_count = GetLittleEndianWord(&mapping[72]);
+	header->modules_offset = GetLittleEndianWord(&mapping[76]);
+	header->similarity_key_count = GetLittleEndianWord(&mapping[80]);
+	header->similarity_keys_offset = GetLittleEndianWord(&mapping[84]);
+	header->bank_checksum_count = GetLittleEndianWord(&mapping[88]);
+	header->bank_checksums_offset = GetLittleEndianWord(&mapping[92]);
+
+	if(header->format_version != AMIGA_ROM_DATABASE_FORMAT_VERSION || header->header_size < AMIGA_ROM_DATABASE_HEADER_SIZE || header->file_size != mapping_size)
+	{
+		return false;
+	}
+
+	if(header->entry_count == 0 || header->hash_bucket_count == 0)
+	{
+		return false;
+	}
+
+	return (IsDatabaseSectionValid(header->seeds_offset, header->hash_bucket_count, 4, header->file_size)
+		&& IsDatabaseSectionValid(header->digests_offset, header->entry_count, 32, header->file_size)
+		&& IsDatabaseSectionValid(header->entries_offset, header->entry_count, AMIGA_ROM_DATABASE_ENTRY_SIZE, header->file_size)
+		&& IsDatabaseSectionValid(header->fingerprints_offset, header->fingerprint_count, AMIGA_ROM_DATABASE_FINGERPRINT_SIZE, header->file_size)
+		&& IsDatabaseSectionValid(header->size_classes_offset, header->size_class_count, AMIGA_ROM_DATABASE_SIZE_CLASS_SIZE, header->file_size)
+		&& IsDatabaseSectionValid(header->modules_offset, header->module_count, AMIGA_ROM_DATABASE_MODULE_SIZE, header->file_size)
+		&& IsDatabaseSectionValid(header->similarity_keys_offset, header->similarity_key_count, AMIGA_ROM_DATABASE_SIMILARITY_KEY_SIZE, header->file_size)
+		&& IsDatabaseSectionValid(header->bank_checksums_offset, header->bank_checksum_count, AMIGA_ROM_DATABASE_BANK_CHECKSUM_SIZE, header->file_size)
+		&& IsDatabaseSectionValid(header->strings_offset, header->strings_size, 1, header->file_size)
+		&& IsDatabaseSectionValid(header->merkle_offset, header->merkle_size, 1, header->file_size));
+}
+
+// Points the seed, fingerprint, size class and bank checksum tables at the
+// mapping, or on big-endian hosts at byte swapped copies of it.
+static bool AttachAmigaROMDatabaseTables(AmigaROMDatabase *database, const uint8_t *mapping, const AmigaROMDatabaseHeader *header)
+{
+	uint32_t *words;
+	size_t seed_words, fingerprint_words, size_class_words, bank_checksum_words, i;
+
+	seed_words = header->hash_bucket_count;
+	fingerprint_words = (size_t)header->fingerprint_count * (AMIGA_ROM_DATABASE_FINGERPRINT_SIZE / 4);
+	size_class_words = (size_t)header->size_class_count * (AMIGA_ROM_DATABASE_SIZE_CLASS_SIZE / 4);
+	bank_checksum_words = (size_t)header->bank_checksum_count * (AMIGA_ROM_DATABASE_BANK_CHECKSUM_SIZE / 4);
+
+	if(IsLittleEndianHost())
+	{
+		database->hash_seeds = (const uint32_t*)&mapping[header->seeds_offset];
+		database->fingerprints = (const AmigaROMFingerprint*)&mapping[header->fingerprints_offset];
+		database->size_classes = (const AmigaROMSizeClass*)&mapping[header->size_classes_offset];
+		database->bank_checksums = (const AmigaROMBankChecksum*)&mapping[header->bank_checksums_offset];
+		return true;
+	}
+
+	words = (uint32_t*)malloc((seed_words + fingerprint_words + size_class_words + bank_checksum_words) * sizeof(uint32_t));
+	if(!words)
+	{
+		return false;
+	}
+
+	for(i = 0; i < seed_words; i++)
+	{
+		words[i] = GetLittleEndianWord(&mapping[header->seeds_offset + (i * 4)]);
+	}
+
+	for(i = 0; i < fingerprint_words; i++)
+	{
+		words[seed_words + i] = GetLittleEndianWord(&mapping[header->fingerprints_offset + (i * 4)]);
+	}
+
+	for(i = 0; i < size_class_words; i++)
+	{
+		words[seed_words + fingerprint_words + i] = GetLittleEndianWord(&mapping[header->size_classes_offset + (i * 4)]);
+	}
+
+	for(i = 0; i < bank_checksum_words; i++)
+	{
+		words[seed_words + fingerprint_words + size_class_words + i] = GetLittleEndianWord(&mapping[header->bank_checksums_offset + (i * 4)]);
+	}
+
+	database->owned_tables = words;
+	database->hash_seeds = words;
+	database->fingerprints = (const AmigaROMFingerprint*)&words[seed_words];
+	database->size_classes = (const AmigaROMSizeClass*)&words[seed_words + fingerprint_words];
+	database->bank_checksums = (const AmigaROMBankChecksum*)&words[seed_words + fingerprint_words + size_class_words];
+
+	return true;
+}
+
+// Builds the AmigaROMModuleInfo records for a mapped database, after
+// rom_info.  Every name and ROM must be in range, and the records sorted by
+// hash.
+static bool BuildAmigaROMDatabaseModules(AmigaROMDatabase *database, AmigaROMModuleInfo *modules, const uint8_t *mapping, const AmigaROMDatabaseHeader *header)
+{
+	const uint8_t *record;
+	const char *strings;
+	uint64_t hash;
+	uint32_t name_offset, rom_index;
+	size_t i;
+
+	strings = (const char*)&mapping[header->strings_offset];
+
+	for(i = 0; i < header->module_count; i++)
+	{
+		record = &mapping[header->modules_offset + (i * AMIGA_ROM_DATABASE_MODULE_SIZE)];
+		hash = (uint64_t)GetLittleEndianWord(&record[0]) | ((uint64_t)GetLittleEndianWord(&record[4]) << 32);
+		name_offset = GetLittleEndianWord(&record[8]);
+		rom_index = GetLittleEndianWord(&record[12]);
+
+		if(name_offset >= header->strings_size || !memchr(&strings[name_offset], '\0', header->strings_size - name_offset) || rom_index >= header->entry_count)
+		{
+			return false;
+		}
+
+		if(i > 0 && hash < modules[i - 1].hash)
+		{
+			return false;
+		}
+
+		{
+			AmigaROMModuleInfo loaded_module = {hash, &strings[name_offset], &(database->rom_info[rom_index]), record[16]};
+
+			memcpy(&modules[i], &loaded_module, sizeof(loaded_module));
+		}
+	}
+
+	database->modules = modules;
+
+	return true;
+}
+
+// Builds the AmigaROMSimilarityKey records for a mapped database, after
+// rom_info.  Every key must name a ROM with Merkle leaves, and the records
+// must be sorted.
+static bool BuildAmigaROMDatabaseSimilarityKeys(AmigaROMDatabase *database, AmigaROMSimilarityKey *similarity_keys, const uint8_t *mapping, const AmigaROMDatabaseHeader *header)
+{
+	const uint8_t *record;
+	uint64_t key;
+	uint32_t rom_index;
+	size_t i;
+
+	for(i = 0; i < header->similarity_key_count; i++)
+	{
+		record = &mapping[header->similarity_keys_offset + (i * AMIGA_ROM_DATABASE_SIMILARITY_KEY_SIZE)];
+		key = (uint64_t)GetLittleEndianWord(&record[0]) | ((uint64_t)GetLittleEndianWord(&record[4]) << 32);
+		rom_index = GetLittleEndianWord(&record[8]);
+
+		if(rom_index >= header->entry_count || !(database->rom_info[rom_index].merkle))
+		{
+			return false;
+		}
+
+		if(i > 0 && (key < similarity_keys[i - 1].key || (key == similarity_keys[i - 1].key && rom_index < similarity_keys[i - 1].rom_index)))
+		{
+			return false;
+		}
+
+		{
+			AmigaROMSimilarityKey loaded_key = {key, rom_index};
+
+			memcpy(&similarity_keys[i], &loaded_key, sizeof(loaded_key));
+		}
+	}
+
+	database->similarity_keys = similarity_keys;
+
+	return true;
+}
+
+// Builds the AmigaROMInfo (and AmigaROMMerkleInfo, AmigaROMModuleInfo and
+// AmigaROMSimilarityKey) records for a mapped database.  These hold pointers, so they can't live in
+// the file, but the digests, strings and Merkle leaves they point to stay in
+// the mapping.
+// Every offset is checked, and every digest must sit in its hash slot.
+static bool BuildAmigaROMDatabaseInfo(AmigaROMDatabase *database, const uint8_t *mapping, const AmigaROMDatabaseHeader *header)
+{
+	AmigaROMInfo *rom_info;
+	AmigaROMMerkleInfo *merkle_info;
+	AmigaROMModuleInfo *modules;
+	AmigaROMSimilarityKey *similarity_keys;
+	uint32_t minhash[AMIGA_ROM_MERKLE_MINHASH_SIZE];
+	const uint8_t *record;
+	const char *strings;
+	size_t merkle_count = 0;
+	size_t merkle_index = 0;
+	size_t i, j;
+	uint32_t version_offset, merkle_offset, merkle_leaf_count, canonical_index;
+
+	strings = (const char*)&mapping[header->strings_offset];
+	database->digests = (const uint8_t (*)[32])&mapping[header->digests_offset];
+
+	for(i = 0; i < header->entry_count; i++)
+	{
+		record = &mapping[header->entries_offset + (i * AMIGA_ROM_DATABASE_ENTRY_SIZE)];
+		if(GetLittleEndianWord(&record[16]) > 0)
+		{
+			merkle_count++;
+		}
+	}
+
+	// One allocation for every table, with the Merkle, module and then
+	// similarity key records after the ROM records, so destroying the
+	// database only frees rom_info.
+	rom_info = (AmigaROMInfo*)calloc(1, (header->entry_count * sizeof(AmigaROMInfo)) + (merkle_count * sizeof(AmigaROMMerkleInfo)) + (header->module_count * sizeof(AmigaROMModuleInfo)) + (header->similarity_key_count * sizeof(AmigaROMSimilarityKey)));
+	if(!rom_info)
+	{
+		return false;
+	}
+
+	database->rom_info = rom_info;
+	merkle_info = (AmigaROMMerkleInfo*)&rom_info[header->entry_count];
+	modules = (AmigaROMModuleInfo*)&merkle_info[merkle_count];
+	similarity_keys = (AmigaROMSimilarityKey*)&modules[header->module_count];
+
+	for(i = 0; i < header->entry_count; i++)
+	{
+		record = &mapping[header->entries_offset + (i * AMIGA_ROM_DATABASE_ENTRY_SIZE)];
+		version_offset = GetLittleEndianWord(&record[0]);
+		merkle_offset = GetLittleEndianWord(&record[12]);
+		merkle_leaf_count = GetLittleEndianWord(&record[16]);
+		canonical_index = GetLittleEndianWord(&record[20]);
+
+		if(version_offset >= header->strings_size || !memchr(&strings[version_offset], '\0', header->strings_size - version_offset))
+		{
+			return false;
+		}
+
+		// A derived layout names the entry it is a layout of, and nothing else does
+		if((record[10] == 0) != (canonical_index == AMIGA_ROM_DATABASE_NO_CANONICAL) || (record[10] != 0 && canonical_index >= header->entry_count))
+		{
+			return false;
+		}
+
+		if(AmigaROMHashSlot(database->digests[i], database->hash_seeds, header->hash_bucket_count, header->entry_count) != i)
+		{
+			return false;
+		}
+
+		if(merkle_leaf_count > 0)
+		{
+			if(merkle_offset > header->merkle_size || (((uint64_t)merkle_leaf_count + 1) * 32) + (AMIGA_ROM_MERKLE_MINHASH_SIZE * 4) > (uint64_t)(header->merkle_size - merkle_offset))
+			{
+				return false;
+			}
+
+			for(j = 0; j < AMIGA_ROM_MERKLE_MINHASH_SIZE; j++)
+			{
+				minhash[j] = GetLittleEndianWord(&mapping[header->merkle_offset + merkle_offset + 32 + (j * 4)]);
+			}
+
+			{
+				AmigaROMMerkleInfo loaded_merkle = {{0}, merkle_leaf_count, (const uint8_t (*)[32])&mapping[header->merkle_offset + merkle_offset + 32 + (AMIGA_ROM_MERKLE_MINHASH_SIZE * 4)], {0}};
+
+				memcpy(&merkle_info[merkle_index], &loaded_merkle, sizeof(loaded_merkle));
+				memcpy((uint8_t*)&merkle_info[merkle_index] + offsetof(AmigaROMMerkleInfo, root), &mapping[header->merkle_offset + merkle_offset], 32);
+				memcpy((uint8_t*)&merkle_info[merkle_index] + offsetof(AmigaROMMerkleInfo, minhash), minhash, sizeof(minhash));
+			}
+		}
+
+		{
+			AmigaROMInfo loaded_rom = {database->digests[i], &strings[version_offset], GetLittleEndianWord(&record[4]), (char)record[8], (int8_t)record[9], record[10], (merkle_leaf_count > 0) ? &merkle_info[merkle_index] : NULL, (canonical_index != AMIGA_ROM_DATABASE_NO_CANONICAL) ? &rom_info[canonical_index] : NULL};
+
+			memcpy(&rom_info[i], &loaded_rom, sizeof(loaded_rom));
+		}
+
+		if(merkle_leaf_count > 0)
+		{
+			merkle_index++;
+		}
+	}
+
+	for(i = 0; i < header->fingerprint_count; i++)
+	{
+		if(database->fingerprints[i].rom_index >= header->entry_count)
+		{
+			return false;
+		}
+	}
+
+	for(i = 0; i < header->bank_checksum_count; i++)
+	{
+		if(database->bank_checksums[i].rom_index >= header->entry_count || database->bank_checksums[i].bank >= AMIGA_ROM_MAX_EPROM_BANKS)
+		{
+			return false;
+		}
+
+		if(i > 0 && (database->bank_checksums[i].rom_index < database->bank_checksums[i - 1].rom_index || (database->bank_checksums[i].rom_index == database->bank_checksums[i - 1].rom_index && database->bank_checksums[i].bank <= database->bank_checksums[i - 1].bank)))
+		{
+			return false;
+		}
+	}
+
+	return BuildAmigaROMDatabaseModules(database, modules, mapping, header) && BuildAmigaROMDatabaseSimilarityKeys(database, similarity_keys, mapping, header);
+}
+
+// Returns the database lookups currently use: the most recently loaded file,
+// or the built-in table if none is loaded.  Safe to call while another
+// thread loads a new database.
+const AmigaROMDatabase* GetAmigaROMDatabase(void)
+{
+	const AmigaROMDatabase *database = atomic_load_explicit(&current_database, memory_order_acquire);
+
+	return database ? database : &BUILT_IN_AMIGA_ROM_DATABASE;
+}
+
+// Pushes a replaced database onto the retired list.
+static void RetireAmigaROMDatabase(AmigaROMDatabase *database)
+{
+	if(!database)
+	{
+		return;
+	}
+
+#if !defined(__STDC_NO_ATOMICS__)
+	database->next_retired = atomic_load_explicit(&retired_databases, memory_order_relaxed);
+	while(!atomic_compare_exchange_weak_explicit(&retired_databases, &(database->next_retired), database, memory_order_release, memory_order_relaxed))
+	{
+	}
+#else
+	database->next_retired = retired_databases;
+	retired_databases = database;
+#endif
+}
+
+// Maps and validates the binary database file at database_path (as written
+// by AmigaROMHashGen -b) and atomically makes it the current database.  The
+// database it replaces is retired rather than freed, so lookups already
+// running and AmigaROMInfo pointers already handed out stay valid.
+// Returns true if it succeeds, or false (keeping the current database) if it
+// fails.
+bool LoadAmigaROMDatabase(const char *database_path)
+{
+	AmigaROMDatabase *database;
+	AmigaROMDatabaseHeader header;
+	const uint8_t *mapping;
+
+	if(!database_path)
+	{
+		return false;
+	}
+
+	database = (AmigaROMDatabase*)calloc(1, sizeof(AmigaROMDatabase));
+	if(!database)
+	{
+		return false;
+	}
+
+	database->mapping = MapAmigaROMDatabaseFile(database_path, &(database->mapping_size));
+	if(!(database->mapping))
+	{
+		free(database);
+		return false;
+	}
+
+	mapping = (const uint8_t*)(database->mapping);
+
+	if(!ReadAmigaROMDatabaseHeader(mapping, database->mapping_size, &header) || !AttachAmigaROMDatabaseTables(database, mapping, &header) || !BuildAmigaROMDatabaseInfo(database, mapping, &header))
+	{
+		DestroyAmigaROMDatabase(database);
+		return false;
+	}
+
+	database->rom_info_count = header.entry_count;
+	database->hash_bucket_count = header.hash_bucket_count;
+	database->fingerprint_count = header.fingerprint_count;
+	database->size_class_count = header.size_class_count;
+	database->module_count = header.module_count;
+	database->similarity_key_count = header.similarity_key_count;
+	database->bank_checksum_count = header.bank_checksum_count;
+
+	RetireAmigaROMDatabase(atomic_exchange_explicit(&current_database, database, memory_order_acq_rel));
+
+	return true;
+}
+
+// Atomically switches lookups back to the built-in table, retiring any
+// loaded database.
+void UseBuiltInAmigaROMDatabase(void)
+{
+	RetireAmigaROMDatabase(atomic_exchange_explicit(&current_database, NULL, memory_order_acq_rel));
+}
+
+// Frees every retired database.  Only call this when no other thread is
+// using one and no AmigaROMInfo pointer from one (including
+// ParsedAmigaROMData's rom_info) will be used again.
+void FreeRetiredAmigaROMDatabases(void)
+{
+	AmigaROMDatabase *database;
+	AmigaROMDatabase *next_database;
+
+	database = atomic_exchange_explicit(&retired_databases, NULL, memory_order_acquire);
+
+	while(database)
+	{
+		next_database = database->next_retired;
+		DestroyAmigaROMDatabase(database);
+		database = next_database;
+	}
+}
@@ -0,0 +1,91 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMDATABASE_H
+#define AMIGAROMDATABASE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "AmigaROMDatabaseFormat.h"
+#include "AmigaROMHashes.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// The tables every lookup uses.  The built-in database points at the tables
+// compiled in from AmigaROMHashes.c; a loaded one points into a mapped
+// database file wherever the file's layout allows.  digests[i] is
+// rom_info[i].sha256_digest, packed so digest lookups only touch that column.
+typedef struct AmigaROMDatabase {
+	const AmigaROMInfo *rom_info;
+	const uint8_t (*digests)[32];
+	size_t rom_info_count;
+	const uint32_t *hash_seeds;
+	size_t hash_bucket_count;
+	const AmigaROMFingerprint *fingerprints;
+	size_t fingerprint_count;
+	const AmigaROMSizeClass *size_classes;
+	size_t size_class_count;
+	const AmigaROMModuleInfo *modules;
+	size_t module_count;
+	const AmigaROMSimilarityKey *similarity_keys;
+	size_t similarity_key_count;
+	const AmigaROMBankChecksum *bank_checksums;
+	size_t bank_checksum_count;
+	void *mapping;
+	size_t mapping_size;
+	void *owned_tables;
+	struct AmigaROMDatabase *next_retired;
+} AmigaROMDatabase;
+
+// Returns the database lookups currently use: the most recently loaded file,
+// or the built-in table if none is loaded.  Safe to call while another
+// thread loads a new database.
+const AmigaROMDatabase* GetAmigaROMDatabase(void);
+
+// Maps and validates the binary database file at database_path (as written
+// by AmigaROMHashGen -b) and atomically makes it the current database.  The
+// database it replaces is retired rather than freed, so lookups already
+// running and AmigaROMInfo pointers already handed out stay valid.
+// Returns true if it succeeds, or false (keeping the current database) if it
+// fails.
+bool LoadAmigaROMDatabase(const char *database_path);
+
+// Atomically switches lookups back to the built-in table, retiring any
+// loaded database.
+void UseBuiltInAmigaROMDatabase(void);
+
+// Frees every retired database.  Only call this when no other thread is
+// using one and no AmigaROMInfo pointer from one (including
+// ParsedAmigaROMData's rom_info) will be used again.
+void FreeRetiredAmigaROMDatabases(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMDATABASEFORMAT_H
+#define AMIGAROMDATABASEFORMAT_H
+
+// Layout of the binary ROM database files written by AmigaROMHashGen -b and
+// mapped by LoadAmigaROMDatabase().  Every integer is little-endian, and
+// every section starts on an 8-byte boundary so the seed, digest,
+// fingerprint, size class and bank checksum sections can be used in place.
+//
+// Header (AMIGA_ROM_DATABASE_HEADER_SIZE bytes):
+//   0  char magic[8]                  AMIGA_ROM_DATABASE_MAGIC
+//   8  uint32_t format_version        AMIGA_ROM_DATABASE_FORMAT_VERSION
+//  12  uint32_t header_size
+//  16  uint32_t file_size
+//  20  uint32_t entry_count
+//  24  uint32_t hash_bucket_count
+//  28  uint32_t fingerprint_count
+//  32  uint32_t size_class_count
+//  36  uint32_t seeds_offset          uint32_t[hash_bucket_count]
+//  40  uint32_t entries_offset        entry records, in perfect hash order
+//  44  uint32_t fingerprints_offset   fingerprint records, sorted
+//  48  uint32_t size_classes_offset   size class records, sorted
+//  52  uint32_t strings_offset        null-terminated version strings, then
+//                                     module names
+//  56  uint32_t strings_size
+//  60  uint32_t merkle_offset         per-ROM root, then its MinHash
+//                                     signature (uint32_t[AMIGA_ROM_MERKLE_MINHASH_SIZE]),
+//                                     then its leaves
+//  64  uint32_t merkle_size
+//  68  uint32_t digests_offset        uint8_t[entry_count][32], packed in
+//                                     perfect hash order
+//  72  uint32_t module_count
+//  76  uint32_t modules_offset        module records, sorted by hash
+//  80  uint32_t similarity_key_count
+//  84  uint32_t similarity_keys_offset similarity key records, sorted by key
+//                                     and then rom_index
+//  88  uint32_t bank_checksum_count
+//  92  uint32_t bank_checksums_offset bank checksum records, sorted by
+//                                     rom_index and then bank
+//
+// Entry record (AMIGA_ROM_DATABASE_ENTRY_SIZE bytes), in the same order as
+// the digests:
+//   0  uint32_t version_offset        into the strings section
+//   4  uint32_t file_size
+//   8  char type
+//   9  int8_t byte_swap
+//  10  uint8_t derived_view          AMIGA_ROM_VIEW_* bit, or 0
+//  11  uint8_t reserved
+//  12  uint32_t merkle_offset         into the Merkle section
+//  16  uint32_t merkle_leaf_count     0 if the ROM has no Merkle data
+//  20  uint32_t canonical_index       entry this is a layout of, or
+//                                     AMIGA_ROM_DATABASE_NO_CANONICAL
+//
+// Fingerprint records are six uint32_t words (file_size, header, version,
+// checksum, footer, rom_index), size class records are two (file_size,
+// unfingerprinted_count) and bank checksum records are four (rom_index,
+// bank, hi_crc32, lo_crc32), matching AmigaROMFingerprint, AmigaROMSizeClass
+// and AmigaROMBankChecksum.
+//
+// Module record (AMIGA_ROM_DATABASE_MODULE_SIZE bytes), sorted by hash:
+//   0  uint32_t hash_low
+//   4  uint32_t hash_high
+//   8  uint32_t name_offset           into the strings section
+//  12  uint32_t rom_index             entry the module was first found in
+//  16  uint8_t version
+//  17  uint8_t reserved[7]
+//
+// Similarity key record (AMIGA_ROM_DATABASE_SIMILARITY_KEY_SIZE bytes), one
+// per MinHash band of each ROM with Merkle leaves:
+//   0  uint32_t key_low
+//   4  uint32_t key_high
+//   8  uint32_t rom_index
+//  12  uint8_t reserved[4]
+//
+// The hash index uses the same minimal perfect hash as AmigaROMHashSlot().
+
+#define AMIGA_ROM_DATABASE_MAGIC               "AMIROMDB"
+#define AMIGA_ROM_DATABASE_FORMAT_VERSION      6
+#define AMIGA_ROM_DATABASE_HEADER_SIZE         96
+#define AMIGA_ROM_DATABASE_ENTRY_SIZE          24
+#define AMIGA_ROM_DATABASE_FINGERPRINT_SIZE    24
+#define AMIGA_ROM_DATABASE_SIZE_CLASS_SIZE     8
+#define AMIGA_ROM_DATABASE_MODULE_SIZE         24
+#define AMIGA_ROM_DATABASE_SIMILARITY_KEY_SIZE 16
+#define AMIGA_ROM_DATABASE_BANK_CHECKSUM_SIZE  16
+#define AMIGA_ROM_DATABASE_ALIGNMENT           8
+#define AMIGA_ROM_DATABASE_NO_CANONICAL        0xFFFFFFFF
+
+#endif
@@ -0,0 +1,777 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AmigaROMDigests.h"
+#include "teeny-sha256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define AMIGA_ROM_VIEWS_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AMIGA_ROM_VIEWS_NEON
+#endif
+
+// Size of the pieces UpdateAmigaROMDigestContext() hands to each algorithm
+// in turn.  Small enough to stay in L1/L2 between the algorithms.
+#define AMIGA_ROM_DIGEST_CHUNK_SIZE 16384
+
+// Merged bytes shuffled into the view buffers at a time by
+// CalculateAmigaROMViewDigests().  All five buffers fit in L1 together.
+#define AMIGA_ROM_VIEW_CHUNK_SIZE 4096
+
+#define ROTATE_LEFT_32(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
+
+static uint32_t crc32_tables[8][256];
+static bool crc32_tables_built = false;
+
+// Builds the slicing-by-8 tables for the reflected CRC32 polynomial.  Runs
+// before main() where the compiler supports constructors; elsewhere it runs
+// on first use, so start one digest before sharing the library between
+// threads.
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void BuildCRC32Tables(void)
+{
+	uint32_t crc;
+	size_t i, j;
+
+	for(i = 0; i < 256; i++)
+	{
+		crc = (uint32_t)i;
+
+		for(j = 0; j < 8; j++)
+		{
+			crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0);
+		}
+
+		crc32_tables[0][i] = crc;
+	}
+
+	for(i = 0; i < 256; i++)
+	{
+		for(j = 1; j < 8; j++)
+		{
+			crc32_tables[j][i] = (crc32_tables[j - 1][i] >> 8) ^ crc32_tables[0][crc32_tables[j - 1][i] & 0xFF];
+		}
+	}
+
+	crc32_tables_built = true;
+}
+
+// Updates a pre-inverted CRC32 with slicing-by-8, eight bytes per step
+static uint32_t UpdateCRC32(uint32_t crc, const uint8_t *data, size_t data_size)
+{
+	uint32_t low_word, high_word;
+
+	while(data_size >= 8)
+	{
+		low_word = crc ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+		high_word = (uint32_t)data[4] | ((uint32_t)data[5] << 8) | ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24);
+
+		crc = crc32_tables[7][low_word & 0xFF] ^
+			crc32_tables[6][(low_word >> 8) & 0xFF] ^
+			crc32_tables[5][(low_word >> 16) & 0xFF] ^
+			crc32_tables[4][low_word >> 24] ^
+			crc32_tables[3][high_word & 0xFF] ^
+			crc32_tables[2][(high_word >> 8) & 0xFF] ^
+			crc32_tables[1][(high_word >> 16) & 0xFF] ^
+			crc32_tables[0][high_word >> 24];
+
+		data += 8;
+		data_size -= 8;
+	}
+
+	while(data_size > 0)
+	{
+		crc = (crc >> 8) ^ crc32_tables[0][(crc ^ *data) & 0xFF];
+		data++;
+		data_size--;
+	}
+
+	return crc;
+}
+
+static const uint32_t MD5_SHIFTS[64] = {
+	7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+	5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
+	4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+	6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+};
+
+static const uint32_t MD5_CONSTANTS[64] = {
+	0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+	0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+	0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+	0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+	0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+	0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+	0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+	0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+};
+
+static void HashMD5Blocks(uint32_t *state, const uint8_t *blocks, size_t block_count)
+{
+	uint32_t words[16];
+	uint32_t a, b, c, d, f, temp;
+	size_t i, word_index;
+
+	while(block_count > 0)
+	{
+		for(i = 0; i < 16; i++)
+		{
+			words[i] = (uint32_t)blocks[i * 4] | ((uint32_t)blocks[(i * 4) + 1] << 8) | ((uint32_t)blocks[(i * 4) + 2] << 16) | ((uint32_t)blocks[(i * 4) + 3] << 24);
+		}
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+
+		for(i = 0; i < 64; i++)
+		{
+			if(i < 16)
+			{
+				f = (b & c) | (~b & d);
+				word_index = i;
+			}
+			else if(i < 32)
+			{
+				f = (d & b) | (~d & c);
+				word_index = ((5 * i) + 1) & 15;
+			}
+			else if(i < 48)
+			{
+				f = b ^ c ^ d;
+				word_index = ((3 * i) + 5) & 15;
+			}
+			else
+			{
+				f = c ^ (b | ~d);
+				word_index = (7 * i) & 15;
+			}
+
+			temp = d;
+			d = c;
+			c = b;
+			f = f + a + MD5_CONSTANTS[i] + words[word_index];
+			b = b + ROTATE_LEFT_32(f, MD5_SHIFTS[i]);
+			a = temp;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+
+		blocks += 64;
+		block_count--;
+	}
+}
+
+static void HashSHA1Blocks(uint32_t *state, const uint8_t *blocks, size_t block_count)
+{
+	uint32_t words[80];
+	uint32_t a, b, c, d, e, f, k, temp;
+	size_t i;
+
+	while(block_count > 0)
+	{
+		for(i = 0; i < 16; i++)
+		{
+			words[i] = ((uint32_t)blocks[i * 4] << 24) | ((uint32_t)blocks[(i * 4) + 1] << 16) | ((uint32_t)blocks[(i * 4) + 2] << 8) | (uint32_t)blocks[(i * 4) + 3];
+		}
+
+		for(i = 16; i < 80; i++)
+		{
+			temp = words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16];
+			words[i] = ROTATE_LEFT_32(temp, 1);
+		}
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+
+		for(i = 0; i < 80; i++)
+		{
+			if(i < 20)
+			{
+				f = (b & c) | (~b & d);
+				k = 0x5A827999;
+			}
+			else if(i < 40)
+			{
+				f = b ^ c ^ d;
+				k = 0x6ED9EBA1;
+			}
+			else if(i < 60)
+			{
+				f = (b & c) | (b & d) | (c & d);
+				k = 0x8F1BBCDC;
+			}
+			else
+			{
+				f = b ^ c ^ d;
+				k = 0xCA62C1D6;
+			}
+
+			temp = ROTATE_LEFT_32(a, 5) + f + e + k + words[i];
+			e = d;
+			d = c;
+			c = ROTATE_LEFT_32(b, 30);
+			b = a;
+			a = temp;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+
+		blocks += 64;
+		block_count--;
+	}
+}
+
+typedef void (*HashBlocksFunction)(uint32_t *state, const uint8_t *blocks, size_t block_count);
+
+// Shared Merkle-Damgard buffering for MD5 and SHA-1, which only differ in
+// their block function.
+static void UpdateBlockHash(uint32_t *state, uint64_t *length, uint8_t *buffer, size_t *buffer_length, const uint8_t *data, size_t data_size, HashBlocksFunction hash_blocks)
+{
+	size_t fill;
+
+	*length += data_size;
+
+	if(*buffer_length > 0)
+	{
+		fill = 64 - *buffer_length;
+		if(fill > data_size)
+		{
+			fill = data_size;
+		}
+
+		memcpy(buffer + *buffer_length, data, fill);
+		*buffer_length += fill;
+		data += fill;
+		data_size -= fill;
+
+		if(*buffer_length < 64)
+		{
+			return;
+		}
+
+		hash_blocks(state, buffer, 1);
+		*buffer_length = 0;
+	}
+
+	if(data_size >= 64)
+	{
+		hash_blocks(state, data, data_size / 64);
+		data += data_size & ~(size_t)63;
+		data_size &= 63;
+	}
+
+	if(data_size > 0)
+	{
+		memcpy(buffer, data, data_size);
+		*buffer_length = data_size;
+	}
+}
+
+// Pads the final block, storing the bit length little-endian for MD5 or
+// big-endian for SHA-1.
+static void FinalizeBlockHash(uint32_t *state, uint64_t length, uint8_t *buffer, size_t buffer_length, const bool big_endian_length, HashBlocksFunction hash_blocks)
+{
+	uint64_t bit_length = length * 8;
+	size_t i;
+
+	buffer[buffer_length++] = 0x80;
+
+	if(buffer_length > 56)
+	{
+		memset(buffer + buffer_length, 0, 64 - buffer_length);
+		hash_blocks(state, buffer, 1);
+		buffer_length = 0;
+	}
+
+	memset(buffer + buffer_length, 0, 56 - buffer_length);
+
+	for(i = 0; i < 8; i++)
+	{
+		buffer[56 + i] = (uint8_t)(bit_length >> (big_endian_length ? (56 - (8 * i)) : (8 * i)));
+	}
+
+	hash_blocks(state, buffer, 1);
+}
+
+// Starts a digest computation for every algorithm set in requested_digests.
+void InitAmigaROMDigestContext(AmigaROMDigestContext *digest_context, const uint8_t requested_digests)
+{
+	if(!digest_context)
+	{
+		return;
+	}
+
+	if(!crc32_tables_built)
+	{
+		BuildCRC32Tables();
+	}
+
+	digest_context->requested_digests = requested_digests & AMIGA_ROM_DIGEST_ALL;
+	digest_context->crc32 = 0xFFFFFFFF;
+
+	digest_context->md5.state[0] = 0x67452301;
+	digest_context->md5.state[1] = 0xefcdab89;
+	digest_context->md5.state[2] = 0x98badcfe;
+	digest_context->md5.state[3] = 0x10325476;
+	digest_context->md5.length = 0;
+	digest_context->md5.buffer_length = 0;
+
+	digest_context->sha1.state[0] = 0x67452301;
+	digest_context->sha1.state[1] = 0xEFCDAB89;
+	digest_context->sha1.state[2] = 0x98BADCFE;
+	digest_context->sha1.state[3] = 0x10325476;
+	digest_context->sha1.state[4] = 0xC3D2E1F0;
+	digest_context->sha1.length = 0;
+	digest_context->sha1.buffer_length = 0;
+
+	SHA256Init(&(digest_context->sha256));
+}
+
+// Feeds data into every requested algorithm.  Large inputs are consumed in
+// cache-sized chunks, with each chunk run through all of the algorithms
+// before moving on, so the data is only read from main memory once.
+void UpdateAmigaROMDigestContext(AmigaROMDigestContext *digest_context, const uint8_t *data, const size_t data_size)
+{
+	size_t offset, chunk_size;
+	uint8_t requested_digests;
+
+	if(!digest_context || !data)
+	{
+		return;
+	}
+
+	requested_digests = digest_context->requested_digests;
+
+	for(offset = 0; offset < data_size; offset += chunk_size)
+	{
+		chunk_size = data_size - offset;
+		if(chunk_size > AMIGA_ROM_DIGEST_CHUNK_SIZE)
+		{
+			chunk_size = AMIGA_ROM_DIGEST_CHUNK_SIZE;
+		}
+
+		if(requested_digests & AMIGA_ROM_DIGEST_CRC32)
+		{
+			digest_context->crc32 = UpdateCRC32(digest_context->crc32, data + offset, chunk_size);
+		}
+
+		if(requested_digests & AMIGA_ROM_DIGEST_MD5)
+		{
+			UpdateBlockHash(digest_context->md5.state, &(digest_context->md5.length), digest_context->md5.buffer, &(digest_context->md5.buffer_length), data + offset, chunk_size, HashMD5Blocks);
+		}
+
+		if(requested_digests & AMIGA_ROM_DIGEST_SHA1)
+		{
+			UpdateBlockHash(digest_context->sha1.state, &(digest_context->sha1.length), digest_context->sha1.buffer, &(digest_context->sha1.buffer_length), data + offset, chunk_size, HashSHA1Blocks);
+		}
+
+		if(requested_digests & AMIGA_ROM_DIGEST_SHA256)
+		{
+			SHA256Update(&(digest_context->sha256), data + offset, chunk_size);
+		}
+	}
+}
+
+// Finishes every requested algorithm and writes the results to digests.
+void FinalizeAmigaROMDigestContext(AmigaROMDigestContext *digest_context, AmigaROMDigests *digests)
+{
+	size_t i;
+
+	if(!digest_context || !digests)
+	{
+		return;
+	}
+
+	digests->computed_digests = digest_context->requested_digests;
+
+	if(digest_context->requested_digests & AMIGA_ROM_DIGEST_CRC32)
+	{
+		digests->crc32 = ~(digest_context->crc32);
+	}
+
+	if(digest_context->requested_digests & AMIGA_ROM_DIGEST_MD5)
+	{
+		FinalizeBlockHash(digest_context->md5.state, digest_context->md5.length, digest_context->md5.buffer, digest_context->md5.buffer_length, false, HashMD5Blocks);
+
+		for(i = 0; i < 16; i++)
+		{
+			digests->md5[i] = (uint8_t)(digest_context->md5.state[i / 4] >> (8 * (i % 4)));
+		}
+	}
+
+	if(digest_context->requested_digests & AMIGA_ROM_DIGEST_SHA1)
+	{
+		FinalizeBlockHash(digest_context->sha1.state, digest_context->sha1.length, digest_context->sha1.buffer, digest_context->sha1.buffer_length, true, HashSHA1Blocks);
+
+		for(i = 0; i < 20; i++)
+		{
+			digests->sha1[i] = (uint8_t)(digest_context->sha1.state[i / 4] >> (24 - (8 * (i % 4))));
+		}
+	}
+
+	if(digest_context->requested_digests & AMIGA_ROM_DIGEST_SHA256)
+	{
+		SHA256Final(&(digest_context->sha256), digests->sha256);
+	}
+}
+
+// Computes every algorithm set in requested_digests over data in one pass.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMDigestsFromData(const uint8_t *data, const size_t data_size, const uint8_t requested_digests, AmigaROMDigests *digests)
+{
+	AmigaROMDigestContext digest_context;
+
+	if(!data || !digests)
+	{
+		return false;
+	}
+
+	InitAmigaROMDigestContext(&digest_context, requested_digests);
+	UpdateAmigaROMDigestContext(&digest_context, data, data_size);
+	FinalizeAmigaROMDigestContext(&digest_context, digests);
+
+	return true;
+}
+
+// Shuffles size bytes of a merged image (a multiple of four) into the
+// byte swapped, Hi, Lo, byte swapped Hi and byte swapped Lo views.  Every
+// four merged bytes are Hi0 Hi1 Lo0 Lo1, so the Hi view takes the first
+// 16-bit word of each 32-bit word and the Lo view the second.
+static void ShuffleAmigaROMViews(const uint8_t *data, const size_t size, uint8_t *swapped, uint8_t *hi, uint8_t *lo, uint8_t *hi_swapped, uint8_t *lo_swapped)
+{
+	size_t i = 0;
+
+#if defined(AMIGA_ROM_VIEWS_SSE2)
+	__m128i first, second, hi_words, lo_words;
+
+	for(; i + 32 <= size; i += 32)
+	{
+		first = _mm_loadu_si128((const __m128i*)(data + i));
+		second = _mm_loadu_si128((const __m128i*)(data + i + 16));
+
+		_mm_storeu_si128((__m128i*)(swapped + i), _mm_or_si128(_mm_slli_epi16(first, 8), _mm_srli_epi16(first, 8)));
+		_mm_storeu_si128((__m128i*)(swapped + i + 16), _mm_or_si128(_mm_slli_epi16(second, 8), _mm_srli_epi16(second, 8)));
+
+		// Sign extending each 16-bit half keeps the signed-saturating pack exact
+		hi_words = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(first, 16), 16), _mm_srai_epi32(_mm_slli_epi32(second, 16), 16));
+		lo_words = _mm_packs_epi32(_mm_srai_epi32(first, 16), _mm_srai_epi32(second, 16));
+
+		_mm_storeu_si128((__m128i*)(hi + (i / 2)), hi_words);
+		_mm_storeu_si128((__m128i*)(lo + (i / 2)), lo_words);
+		_mm_storeu_si128((__m128i*)(hi_swapped + (i / 2)), _mm_or_si128(_mm_slli_epi16(hi_words, 8), _mm_srli_epi16(hi_words, 8)));
+		_mm_storeu_si128((__m128i*)(lo_swapped + (i / 2)), _mm_or_si128(_mm_slli_epi16(lo_words, 8), _mm_srli_epi16(lo_words, 8)));
+	}
+#elif defined(AMIGA_ROM_VIEWS_NEON)
+	uint8x16x2_t merged;
+	uint16x8x2_t words;
+
+	for(; i + 32 <= size; i += 32)
+	{
+		merged.val[0] = vld1q_u8(data + i);
+		merged.val[1] = vld1q_u8(data + i + 16);
+		vst1q_u8(swapped + i, vrev16q_u8(merged.val[0]));
+		vst1q_u8(swapped + i + 16, vrev16q_u8(merged.val[1]));
+
+		words = vld2q_u16((const uint16_t*)(const void*)(data + i));
+		vst1q_u8(hi + (i / 2), vreinterpretq_u8_u16(words.val[0]));
+		vst1q_u8(lo + (i / 2), vreinterpretq_u8_u16(words.val[1]));
+		vst1q_u8(hi_swapped + (i / 2), vrev16q_u8(vreinterpretq_u8_u16(words.val[0])));
+		vst1q_u8(lo_swapped + (i / 2), vrev16q_u8(vreinterpretq_u8_u16(words.val[1])));
+	}
+#endif
+
+	for(; i + 4 <= size; i += 4)
+	{
+		swapped[i] = data[i + 1];
+		swapped[i + 1] = data[i];
+		swapped[i + 2] = data[i + 3];
+		swapped[i + 3] = data[i + 2];
+
+		hi[i / 2] = data[i];
+		hi[(i / 2) + 1] = data[i + 1];
+		lo[i / 2] = data[i + 2];
+		lo[(i / 2) + 1] = data[i + 3];
+
+		hi_swapped[i / 2] = data[i + 1];
+		hi_swapped[(i / 2) + 1] = data[i];
+		lo_swapped[i / 2] = data[i + 3];
+		lo_swapped[(i / 2) + 1] = data[i + 2];
+	}
+}
+
+// Computes the SHA256 digest of every view set in requested_views in one pass
+// over the merged image, without materializing any of them.  Views which
+// don't apply to the data size (odd sizes for the byte swapped view, sizes
+// which aren't a multiple of four for the split views) are skipped.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMViewDigests(const uint8_t *data, const size_t data_size, const uint8_t requested_views, AmigaROMViewDigests *view_digests)
+{
+	SHA256Context view_contexts[AMIGA_ROM_VIEW_COUNT];
+	uint8_t swapped[AMIGA_ROM_VIEW_CHUNK_SIZE];
+	uint8_t hi[AMIGA_ROM_VIEW_CHUNK_SIZE / 2];
+	uint8_t lo[AMIGA_ROM_VIEW_CHUNK_SIZE / 2];
+	uint8_t hi_swapped[AMIGA_ROM_VIEW_CHUNK_SIZE / 2];
+	uint8_t lo_swapped[AMIGA_ROM_VIEW_CHUNK_SIZE / 2];
+	const uint8_t split_views = AMIGA_ROM_VIEW_HI | AMIGA_ROM_VIEW_LO | AMIGA_ROM_VIEW_HI_BYTE_SWAPPED | AMIGA_ROM_VIEW_LO_BYTE_SWAPPED;
+	uint8_t views = requested_views & AMIGA_ROM_VIEW_ALL;
+	uint8_t pass_views;
+	size_t offset, chunk_size, view, pass, i;
+	size_t split_passes = 1;
+
+	if(!data || data_size == 0 || !view_digests)
+	{
+		return false;
+	}
+
+	if(data_size % 2 != 0)
+	{
+		views &= (uint8_t)~AMIGA_ROM_VIEW_BYTE_SWAPPED;
+	}
+
+	if(data_size % 4 != 0)
+	{
+		views &= (uint8_t)~split_views;
+	}
+
+	// Small split views are repeated, which needs another read of the merged
+	// image for each repetition, but only the split views are fed again.
+	while((views & split_views) && (data_size / 2) * split_passes < AMIGA_ROM_MIN_SPLIT_VIEW_SIZE && AMIGA_ROM_MIN_SPLIT_VIEW_SIZE % ((data_size / 2) * split_passes * 2) == 0)
+	{
+		split_passes *= 2;
+	}
+
+	for(view = 0; view < AMIGA_ROM_VIEW_COUNT; view++)
+	{
+		SHA256Init(&(view_contexts[view]));
+	}
+
+	for(pass = 0; pass < split_passes; pass++)
+	{
+		pass_views = (pass == 0) ? views : (views & split_views);
+
+		if(pass_views == AMIGA_ROM_VIEW_NONE)
+		{
+			break;
+		}
+
+		for(offset = 0; offset < data_size; offset += chunk_size)
+		{
+			chunk_size = data_size - offset;
+			if(chunk_size > AMIGA_ROM_VIEW_CHUNK_SIZE)
+			{
+				chunk_size = AMIGA_ROM_VIEW_CHUNK_SIZE;
+			}
+
+			if(pass_views & AMIGA_ROM_VIEW_AS_IS)
+			{
+				SHA256Update(&(view_contexts[0]), data + offset, chunk_size);
+			}
+
+			if(pass_views & ~AMIGA_ROM_VIEW_AS_IS)
+			{
+				if(data_size % 4 == 0)
+				{
+					ShuffleAmigaROMViews(data + offset, chunk_size, swapped, hi, lo, hi_swapped, lo_swapped);
+				}
+				else
+				{
+					// Only the byte swapped view applies to this size
+					for(i = 0; i + 1 < chunk_size; i += 2)
+					{
+						swapped[i] = data[offset + i + 1];
+						swapped[i + 1] = data[offset + i];
+					}
+				}
+			}
+
+			if(pass_views & AMIGA_ROM_VIEW_BYTE_SWAPPED)
+			{
+				SHA256Update(&(view_contexts[1]), swapped, chunk_size);
+			}
+
+			if(pass_views & AMIGA_ROM_VIEW_HI)
+			{
+				SHA256Update(&(view_contexts[2]), hi, chunk_size / 2);
+			}
+
+			if(pass_views & AMIGA_ROM_VIEW_LO)
+			{
+				SHA256Update(&(view_contexts[3]), lo, chunk_size / 2);
+			}
+
+			if(pass_views & AMIGA_ROM_VIEW_HI_BYTE_SWAPPED)
+			{
+				SHA256Update(&(view_contexts[4]), hi_swapped, chunk_size / 2);
+			}
+
+			if(pass_views & AMIGA_ROM_VIEW_LO_BYTE_SWAPPED)
+			{
+				SHA256Update(&(view_contexts[5]), lo_swapped, chunk_size / 2);
+			}
+		}
+	}
+
+	view_digests->computed_views = views;
+
+	for(view = 0; view < AMIGA_ROM_VIEW_COUNT; view++)
+	{
+		if(views & (1 << view))
+		{
+			SHA256Final(&(view_contexts[view]), view_digests->sha256[view]);
+			view_digests->view_size[view] = (view < 2) ? data_size : (data_size / 2) * split_passes;
+		}
+		else
+		{
+			view_digests->view_size[view] = 0;
+		}
+	}
+
+	return true;
+}
+
+// Computes the CRC32 of every AMIGA_ROM_EPROM_BANK_SIZE byte bank of the Hi
+// and Lo halves of a merged image, as SplitAmigaROM() would write them for
+// the U34 and U35 EPROMs, in one pass over the merged image.  If
+// byte_swapped is true, every 16-bit word is swapped back first, so the
+// checksums are always of the unswapped halves.  The last bank may be short.
+// Returns false if data_size isn't a multiple of four or has more than
+// AMIGA_ROM_MAX_EPROM_BANKS banks per half.
+bool CalculateAmigaROMBankChecksums(const uint8_t *data, const size_t data_size, const bool byte_swapped, AmigaROMBankChecksums *bank_checksums)
+{
+	uint8_t hi[AMIGA_ROM_VIEW_CHUNK_SIZE / 2];
+	uint8_t lo[AMIGA_ROM_VIEW_CHUNK_SIZE / 2];
+	uint32_t hi_crc = 0xFFFFFFFF;
+	uint32_t lo_crc = 0xFFFFFFFF;
+	size_t offset, chunk_size, bank, i;
+	const size_t first = byte_swapped ? 1 : 0;
+	const size_t second = byte_swapped ? 0 : 1;
+
+	if(!data || !bank_checksums || data_size == 0 || data_size % 4 != 0)
+	{
+		return false;
+	}
+
+	bank_checksums->bank_count = ((data_size / 2) + AMIGA_ROM_EPROM_BANK_SIZE - 1) / AMIGA_ROM_EPROM_BANK_SIZE;
+	if(bank_checksums->bank_count > AMIGA_ROM_MAX_EPROM_BANKS)
+	{
+		return false;
+	}
+
+	if(!crc32_tables_built)
+	{
+		BuildCRC32Tables();
+	}
+
+	// Chunks never straddle a bank, as the chunk size divides the bank size
+	for(offset = 0; offset < data_size; offset += chunk_size)
+	{
+		chunk_size = (data_size - offset < AMIGA_ROM_VIEW_CHUNK_SIZE) ? data_size - offset : AMIGA_ROM_VIEW_CHUNK_SIZE;
+
+		for(i = 0; i < chunk_size; i += 4)
+		{
+			hi[i / 2] = data[offset + i + first];
+			hi[(i / 2) + 1] = data[offset + i + second];
+			lo[i / 2] = data[offset + i + 2 + first];
+			lo[(i / 2) + 1] = data[offset + i + 2 + second];
+		}
+
+		hi_crc = UpdateCRC32(hi_crc, hi, chunk_size / 2);
+		lo_crc = UpdateCRC32(lo_crc, lo, chunk_size / 2);
+
+		if(((offset + chunk_size) / 2) % AMIGA_ROM_EPROM_BANK_SIZE == 0 || offset + chunk_size == data_size)
+		{
+			bank = (offset / 2) / AMIGA_ROM_EPROM_BANK_SIZE;
+			bank_checksums->hi_crc32[bank] = ~hi_crc;
+			bank_checksums->lo_crc32[bank] = ~lo_crc;
+			hi_crc = 0xFFFFFFFF;
+			lo_crc = 0xFFFFFFFF;
+		}
+	}
+
+	return true;
+}
+
+// Returns a short description of a single AMIGA_ROM_VIEW_* bit.
+const char* GetAmigaROMViewName(const uint8_t view)
+{
+	switch(view)
+	{
+		case AMIGA_ROM_VIEW_AS_IS:
+			return "as-is";
+		case AMIGA_ROM_VIEW_BYTE_SWAPPED:
+			return "byte swapped";
+		case AMIGA_ROM_VIEW_HI:
+			return "Hi half";
+		case AMIGA_ROM_VIEW_LO:
+			return "Lo half";
+		case AMIGA_ROM_VIEW_HI_BYTE_SWAPPED:
+			return "byte swapped Hi half";
+		case AMIGA_ROM_VIEW_LO_BYTE_SWAPPED:
+			return "byte swapped Lo half";
+		default:
+			return "unknown view";
+	}
+}
+
+// Writes the lowercase hex form of a digest_length byte digest, plus a null
+// terminator, into hex_digest, which must hold (digest_length * 2) + 1 bytes.
+void FormatAmigaROMDigest(const uint8_t *digest, const size_t digest_length, char *hex_digest)
+{
+	static const char hex_chars[] = "0123456789abcdef";
+	size_t i;
+
+	if(!digest || !hex_digest)
+	{
+		return;
+	}
+
+	for(i = 0; i < digest_length; i++)
+	{
+		hex_digest[i * 2] = hex_chars[digest[i] >> 4];
+		hex_digest[(i * 2) + 1] = hex_chars[digest[i] & 0x0F];
+	}
+
+	hex_digest[digest_length * 2] = '\0';
+}
@@ -0,0 +1,164 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMDIGESTS_H
+#define AMIGAROMDIGESTS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "teeny-sha256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Bits used to request and report digest algorithms
+#define AMIGA_ROM_DIGEST_NONE   0x00
+#define AMIGA_ROM_DIGEST_CRC32  0x01
+#define AMIGA_ROM_DIGEST_MD5    0x02
+#define AMIGA_ROM_DIGEST_SHA1   0x04
+#define AMIGA_ROM_DIGEST_SHA256 0x08
+#define AMIGA_ROM_DIGEST_ALL    0x0F
+
+typedef struct {
+	uint32_t state[4];
+	uint64_t length;
+	uint8_t buffer[64];
+	size_t buffer_length;
+} AmigaROMMD5Context;
+
+typedef struct {
+	uint32_t state[5];
+	uint64_t length;
+	uint8_t buffer[64];
+	size_t buffer_length;
+} AmigaROMSHA1Context;
+
+// Bits used to request and report views of a merged ROM image for
+// CalculateAmigaROMViewDigests().  The Hi and Lo views are the halves that
+// SplitAmigaROM() would write for the U34 and U35 EPROMs, in the same byte
+// order as the merged image or with every 16-bit word byte swapped.
+#define AMIGA_ROM_VIEW_NONE            0x00
+#define AMIGA_ROM_VIEW_AS_IS           0x01
+#define AMIGA_ROM_VIEW_BYTE_SWAPPED    0x02
+#define AMIGA_ROM_VIEW_HI              0x04
+#define AMIGA_ROM_VIEW_LO              0x08
+#define AMIGA_ROM_VIEW_HI_BYTE_SWAPPED 0x10
+#define AMIGA_ROM_VIEW_LO_BYTE_SWAPPED 0x20
+#define AMIGA_ROM_VIEW_ALL             0x3F
+#define AMIGA_ROM_VIEW_COUNT           6
+
+// Not a view of its own.  Set with a Hi or Lo view in a known ROM's
+// derived_view when that half is repeated to the size of the merged image,
+// as SplitAmigaROM() writes it.
+#define AMIGA_ROM_VIEW_MIRRORED        0x40
+
+// Split views smaller than this are repeated until they reach it, matching
+// the way Hi and Lo dumps of 256KB ROMs fill a whole EPROM.
+#define AMIGA_ROM_MIN_SPLIT_VIEW_SIZE  262144
+
+// Bytes of each EPROM half covered by one bank checksum, and the most banks
+// a half can have
+#define AMIGA_ROM_EPROM_BANK_SIZE      65536
+#define AMIGA_ROM_MAX_EPROM_BANKS      32
+
+// CRC32s of each bank of the Hi (U34) and Lo (U35) halves of a merged image
+typedef struct {
+	size_t bank_count;
+	uint32_t hi_crc32[AMIGA_ROM_MAX_EPROM_BANKS];
+	uint32_t lo_crc32[AMIGA_ROM_MAX_EPROM_BANKS];
+} AmigaROMBankChecksums;
+
+// Running state for every requested algorithm.  Only the contexts selected
+// by requested_digests are touched.
+typedef struct {
+	uint8_t requested_digests;
+	uint32_t crc32;
+	AmigaROMMD5Context md5;
+	AmigaROMSHA1Context sha1;
+	SHA256Context sha256;
+} AmigaROMDigestContext;
+
+// Finished digests.  computed_digests says which of the fields are valid.
+typedef struct {
+	uint8_t computed_digests;
+	uint32_t crc32;
+	uint8_t md5[16];
+	uint8_t sha1[20];
+	uint8_t sha256[32];
+} AmigaROMDigests;
+
+// SHA256 digests of the views of a merged ROM image.  Bit n of
+// computed_views says whether sha256[n] and view_size[n] are valid.
+typedef struct {
+	uint8_t computed_views;
+	uint8_t sha256[AMIGA_ROM_VIEW_COUNT][32];
+	size_t view_size[AMIGA_ROM_VIEW_COUNT];
+} AmigaROMViewDigests;
+
+// Starts a digest computation for every algorithm set in requested_digests.
+void InitAmigaROMDigestContext(AmigaROMDigestContext *digest_context, const uint8_t requested_digests);
+
+// Feeds data into every requested algorithm.  Large inputs are consumed in
+// cache-sized chunks, with each chunk run through all of the algorithms
+// before moving on, so the data is only read from main memory once.
+void UpdateAmigaROMDigestContext(AmigaROMDigestContext *digest_context, const uint8_t *data, const size_t data_size);
+
+// Finishes every requested algorithm and writes the results to digests.
+void FinalizeAmigaROMDigestContext(AmigaROMDigestContext *digest_context, AmigaROMDigests *digests);
+
+// Computes every algorithm set in requested_digests over data in one pass.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMDigestsFromData(const uint8_t *data, const size_t data_size, const uint8_t requested_digests, AmigaROMDigests *digests);
+
+// Computes the SHA256 digest of every view set in requested_views in one pass
+// over the merged image, without materializing any of them.  Views which
+// don't apply to the data size (odd sizes for the byte swapped view, sizes
+// which aren't a multiple of four for the split views) are skipped.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMViewDigests(const uint8_t *data, const size_t data_size, const uint8_t requested_views, AmigaROMViewDigests *view_digests);
+
+// Computes the CRC32 of every AMIGA_ROM_EPROM_BANK_SIZE byte bank of the Hi
+// and Lo halves of a merged image, as SplitAmigaROM() would write them for
+// the U34 and U35 EPROMs, in one pass over the merged image.  If
+// byte_swapped is true, every 16-bit word is swapped back first, so the
+// checksums are always of the unswapped halves.  The last bank may be short.
+// Returns false if data_size isn't a multiple of four or has more than
+// AMIGA_ROM_MAX_EPROM_BANKS banks per half.
+bool CalculateAmigaROMBankChecksums(const uint8_t *data, const size_t data_size, const bool byte_swapped, AmigaROMBankChecksums *bank_checksums);
+
+// Returns a short description of a single AMIGA_ROM_VIEW_* bit.
+const char* GetAmigaROMViewName(const uint8_t view);
+
+// Writes the lowercase hex form of a digest_length byte digest, plus a null
+// terminator, into hex_digest, which must hold (digest_length * 2) + 1 bytes.
+void FormatAmigaROMDigest(const uint8_t *digest, const size_t digest_length, char *hex_digest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
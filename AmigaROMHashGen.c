@@ -0,0 +1,2346 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Build-time generator for AmigaROMHashes.h and AmigaROMHashes.c.  Reads the
+// plain-text ROM list, rejects malformed and duplicate entries, and writes a
+// header declaring, and a source defining, a minimal perfect hash over the
+// packed binary SHA256 digests along with the ROM metadata table laid out in
+// hash order.  ROM images given with -i are
+// matched to their entries by digest and contribute structural fingerprints
+// and Merkle leaf hashes.  Logiqx XML and clrmamepro DATs given with -d are
+// streamed in after the list, with ROMs already listed left as they are.
+// The same tables can also be written as a binary database file for
+// LoadAmigaROMDatabase().
+
+#include "AmigaROMDatImport.h"
+#include "AmigaROMDatabaseFormat.h"
+#include "AmigaROMDigests.h"
+#include "AmigaROMMerkle.h"
+#include "AmigaROMModules.h"
+#include "teeny-sha256.h"
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HASHGEN_MAX_LINE_LENGTH     512
+#define HASHGEN_MAX_VERSION_LENGTH  128
+#define HASHGEN_KEYS_PER_BUCKET     4
+#define HASHGEN_MAX_SEED_ATTEMPTS   0x01000000
+
+typedef struct {
+	uint8_t sha256_digest[32];
+	size_t file_size;
+	char type;
+	int byte_swap;
+	char version[HASHGEN_MAX_VERSION_LENGTH];
+	size_t line_number;
+	bool imported;
+	uint8_t derived_view;
+	size_t canonical_entry;
+	bool has_fingerprint;
+	uint32_t fingerprint[4];
+	size_t slot;
+	AmigaROMMerkleTree merkle_tree;
+	AmigaROMModule *modules;
+	size_t module_count;
+	AmigaROMBankChecksums bank_checksums;
+} AmigaROMHashGenEntry;
+
+typedef struct {
+	AmigaROMHashGenEntry *entries;
+	size_t entry_count;
+	size_t entry_capacity;
+} AmigaROMHashGenList;
+
+typedef struct {
+	size_t bucket;
+	size_t key_count;
+} AmigaROMHashGenBucket;
+
+typedef struct {
+	AmigaROMHashGenList *rom_list;
+	const char *dat_path;
+	size_t imported_count;
+	size_t skipped_count;
+} AmigaROMHashGenImport;
+
+// A distinct resident module and the known ROM it was first found in
+typedef struct {
+	const AmigaROMModule *module;
+	const AmigaROMHashGenEntry *entry;
+} AmigaROMHashGenModule;
+
+// One band of a ROM's MinHash signature, for the similarity index
+typedef struct {
+	uint64_t key;
+	size_t slot;
+} AmigaROMHashGenSimilarityKey;
+
+void print_help(void);
+bool ReadAmigaROMList(const char *list_path, AmigaROMHashGenList *rom_list);
+bool ReadAmigaROMDat(const char *dat_path, AmigaROMHashGenList *rom_list);
+size_t RemoveImportedDuplicates(AmigaROMHashGenList *rom_list);
+bool CheckAmigaROMListDuplicates(const AmigaROMHashGenList *rom_list);
+bool ReadAmigaROMImage(const char *image_path, AmigaROMHashGenList *rom_list);
+void DestroyAmigaROMList(AmigaROMHashGenList *rom_list);
+bool BuildAmigaROMPerfectHash(const AmigaROMHashGenList *rom_list, uint32_t *seeds, size_t bucket_count, size_t *slots);
+bool WriteAmigaROMHashesHeader(const char *header_path, const AmigaROMHashGenList *rom_list, size_t bucket_count, const AmigaROMHashGenEntry **slot_entries);
+bool WriteAmigaROMHashesSource(const char *source_path, const char *header_name, const AmigaROMHashGenList *rom_list, const uint32_t *seeds, size_t bucket_count, const AmigaROMHashGenEntry **slot_entries);
+bool WriteAmigaROMDatabase(const char *database_path, const AmigaROMHashGenList *rom_list, const uint32_t *seeds, size_t bucket_count, const AmigaROMHashGenEntry **slot_entries);
+
+// These two functions are also emitted into the generated header, and the
+// two copies must stay identical.
+static uint32_t AmigaROMHashKey(const uint8_t *bytes)
+{
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static uint32_t AmigaROMHashMix(uint32_t key, uint32_t seed)
+{
+	key ^= seed;
+	key *= 0x9E3779B1u;
+	key ^= key >> 15;
+	key *= 0x85EBCA77u;
+	key ^= key >> 13;
+
+	return key;
+}
+
+int main(int argc, char** argv)
+{
+	AmigaROMHashGenList rom_list = {NULL, 0, 0};
+	const char *list_path = NULL;
+	const char *header_path = NULL;
+	const char *source_path = NULL;
+	const char *header_name;
+	const char *database_path = NULL;
+	const char **image_paths = NULL;
+	const char **dat_paths = NULL;
+	const AmigaROMHashGenEntry **slot_entries = NULL;
+	size_t image_count = 0;
+	size_t dat_count = 0;
+	uint32_t *seeds = NULL;
+	size_t *slots = NULL;
+	size_t bucket_count = 0;
+	size_t j;
+	int i;
+	int result = 1;
+
+	image_paths = (const char**)malloc((size_t)argc * sizeof(char*));
+	dat_paths = (const char**)malloc((size_t)argc * sizeof(char*));
+	if(!image_paths || !dat_paths)
+	{
+		fprintf(stderr, "ERROR: Out of memory.\n");
+		free(image_paths);
+		free(dat_paths);
+		return 1;
+	}
+
+	for(i = 1; i < argc; i++)
+	{
+		if(strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+		{
+			list_path = argv[++i];
+		}
+		else if(strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+		{
+			header_path = argv[++i];
+		}
+		else if(strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+		{
+			source_path = argv[++i];
+		}
+		else if(strcmp(argv[i], "-b") == 0 && i + 1 < argc)
+		{
+			database_path = argv[++i];
+		}
+		else if(strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+		{
+			image_paths[image_count++] = argv[++i];
+		}
+		else if(strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+		{
+			dat_paths[dat_count++] = argv[++i];
+		}
+		else
+		{
+			print_help();
+			free(image_paths);
+			free(dat_paths);
+			return 1;
+		}
+	}
+
+	if((!list_path && dat_count == 0) || (!header_path && !database_path) || (!header_path != !source_path))
+	{
+		print_help();
+		free(image_paths);
+		free(dat_paths);
+		return 1;
+	}
+
+	if(list_path && !ReadAmigaROMList(list_path, &rom_list))
+	{
+		DestroyAmigaROMList(&rom_list);
+		free(image_paths);
+		free(dat_paths);
+		return 1;
+	}
+
+	for(i = 0; (size_t)i < dat_count; i++)
+	{
+		if(!ReadAmigaROMDat(dat_paths[i], &rom_list))
+		{
+			DestroyAmigaROMList(&rom_list);
+			free(image_paths);
+			free(dat_paths);
+			return 1;
+		}
+	}
+
+	if(rom_list.entry_count == 0)
+	{
+		fprintf(stderr, "ERROR: No ROMs to write.\n");
+		DestroyAmigaROMList(&rom_list);
+		free(image_paths);
+		free(dat_paths);
+		return 1;
+	}
+
+	if(dat_count > 0 && (j = RemoveImportedDuplicates(&rom_list)) > 0)
+	{
+		printf("Skipped %zu imported ROMs which were already known.\n", j);
+	}
+
+	if(!CheckAmigaROMListDuplicates(&rom_list))
+	{
+		DestroyAmigaROMList(&rom_list);
+		free(image_paths);
+		free(dat_paths);
+		return 1;
+	}
+
+	for(i = 0; (size_t)i < image_count; i++)
+	{
+		if(!ReadAmigaROMImage(image_paths[i], &rom_list))
+		{
+			DestroyAmigaROMList(&rom_list);
+			free(image_paths);
+			free(dat_paths);
+			return 1;
+		}
+	}
+
+	bucket_count = (rom_list.entry_count + HASHGEN_KEYS_PER_BUCKET - 1) / HASHGEN_KEYS_PER_BUCKET;
+	seeds = (uint32_t*)calloc(bucket_count, sizeof(uint32_t));
+	slots = (size_t*)malloc(rom_list.entry_count * sizeof(size_t));
+	slot_entries = (const AmigaROMHashGenEntry**)malloc(rom_list.entry_count * sizeof(AmigaROMHashGenEntry*));
+
+	if(seeds && slots && slot_entries && BuildAmigaROMPerfectHash(&rom_list, seeds, bucket_count, slots))
+	{
+		for(j = 0; j < rom_list.entry_count; j++)
+		{
+			rom_list.entries[j].slot = slots[j];
+			slot_entries[slots[j]] = &(rom_list.entries[j]);
+		}
+
+		result = 0;
+
+		if(header_path)
+		{
+			// The source includes the header by name, so the two are written
+			// side by side; the header goes last so it is never older.
+			header_name = strrchr(header_path, '/') ? strrchr(header_path, '/') + 1 : header_path;
+
+			if(WriteAmigaROMHashesSource(source_path, header_name, &rom_list, seeds, bucket_count, slot_entries) &&
+			   WriteAmigaROMHashesHeader(header_path, &rom_list, bucket_count, slot_entries))
+			{
+				printf("Wrote %zu ROMs to %s and %s.\n", rom_list.entry_count, header_path, source_path);
+			}
+			else
+			{
+				result = 1;
+			}
+		}
+
+		if(database_path && result == 0)
+		{
+			if(WriteAmigaROMDatabase(database_path, &rom_list, seeds, bucket_count, slot_entries))
+			{
+				printf("Wrote %zu ROMs to %s.\n", rom_list.entry_count, database_path);
+			}
+			else
+			{
+				result = 1;
+			}
+		}
+	}
+	else if(!seeds || !slots || !slot_entries)
+	{
+		fprintf(stderr, "ERROR: Out of memory.\n");
+	}
+
+	free(slot_entries);
+	free(slots);
+	free(seeds);
+	DestroyAmigaROMList(&rom_list);
+	free(image_paths);
+	free(dat_paths);
+
+	return result;
+}
+
+void print_help(void)
+{
+	printf("Usage: AmigaROMHashGen -l LIST [-d DAT]... [-o HEADER -c SOURCE] [-b DATABASE] [-i IMAGE]...\n");
+	printf("Options:\n");
+	printf("  -l FILE  Path to the plain-text ROM list\n");
+	printf("  -d FILE  Path to a Logiqx XML or clrmamepro DAT to import (repeatable)\n");
+	printf("  -o FILE  Path to the header to generate\n");
+	printf("  -c FILE  Path to the source defining the header's tables\n");
+	printf("  -b FILE  Path to the binary database file to generate\n");
+	printf("  -i FILE  Path to a ROM image in the list, for Merkle leaf hashes (repeatable)\n");
+}
+
+// Frees every entry in rom_list, along with any Merkle leaves and modules.
+void DestroyAmigaROMList(AmigaROMHashGenList *rom_list)
+{
+	size_t i;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		DestroyAmigaROMMerkleTree(&(rom_list->entries[i].merkle_tree));
+		free(rom_list->entries[i].modules);
+	}
+
+	free(rom_list->entries);
+	rom_list->entries = NULL;
+	rom_list->entry_count = 0;
+	rom_list->entry_capacity = 0;
+}
+
+static int HexCharToNibble(const char hex_char)
+{
+	if(hex_char >= '0' && hex_char <= '9')
+	{
+		return hex_char - '0';
+	}
+	else if(hex_char >= 'a' && hex_char <= 'f')
+	{
+		return hex_char - 'a' + 10;
+	}
+	else if(hex_char >= 'A' && hex_char <= 'F')
+	{
+		return hex_char - 'A' + 10;
+	}
+
+	return -1;
+}
+
+static bool ParseHexDigest(const char *hex_digest, uint8_t *digest)
+{
+	size_t i;
+	int high_nibble, low_nibble;
+
+	for(i = 0; i < 32; i++)
+	{
+		high_nibble = HexCharToNibble(hex_digest[i * 2]);
+		low_nibble = (high_nibble < 0) ? -1 : HexCharToNibble(hex_digest[(i * 2) + 1]);
+
+		if(high_nibble < 0 || low_nibble < 0)
+		{
+			return false;
+		}
+
+		digest[i] = (uint8_t)((high_nibble << 4) | low_nibble);
+	}
+
+	return (hex_digest[64] == ' ' || hex_digest[64] == '\t');
+}
+
+// Parses one non-comment line of the ROM list into entry.
+static bool ParseAmigaROMListLine(char *line, AmigaROMHashGenEntry *entry)
+{
+	char *field;
+	char *end;
+	size_t version_length;
+	unsigned long long file_size;
+
+	if(strlen(line) < 65 || !ParseHexDigest(line, entry->sha256_digest))
+	{
+		return false;
+	}
+
+	field = line + 64;
+	file_size = strtoull(field, &end, 10);
+	if(end == field || file_size == 0 || file_size > 0xFFFFFFFFULL)
+	{
+		return false;
+	}
+	entry->file_size = (size_t)file_size;
+
+	field = end + strspn(end, " \t");
+	if(!strchr("ABEMO", *field) || *field == '\0' || (field[1] != ' ' && field[1] != '\t'))
+	{
+		return false;
+	}
+	entry->type = *field;
+
+	field = field + 1 + strspn(field + 1, " \t");
+	if((*field != '0' && *field != '1') || (field[1] != ' ' && field[1] != '\t'))
+	{
+		return false;
+	}
+	entry->byte_swap = *field - '0';
+
+	field = field + 1 + strspn(field + 1, " \t");
+	version_length = strcspn(field, "\r\n");
+	while(version_length > 0 && (field[version_length - 1] == ' ' || field[version_length - 1] == '\t'))
+	{
+		version_length--;
+	}
+
+	if(version_length == 0 || version_length >= HASHGEN_MAX_VERSION_LENGTH || strcspn(field, "\"\\") < version_length)
+	{
+		return false;
+	}
+
+	memcpy(entry->version, field, version_length);
+	entry->version[version_length] = '\0';
+
+	return true;
+}
+
+// Makes room for one more entry and returns it, initialized but not yet
+// counted.  Returns NULL if it fails.
+static AmigaROMHashGenEntry* ReserveAmigaROMListEntry(AmigaROMHashGenList *rom_list, const size_t line_number)
+{
+	AmigaROMHashGenEntry *test_ptr;
+	AmigaROMHashGenEntry *entry;
+
+	if(rom_list->entry_count == rom_list->entry_capacity)
+	{
+		rom_list->entry_capacity = rom_list->entry_capacity ? rom_list->entry_capacity * 2 : 256;
+		test_ptr = realloc(rom_list->entries, rom_list->entry_capacity * sizeof(AmigaROMHashGenEntry));
+		if(!test_ptr)
+		{
+			return NULL;
+		}
+
+		rom_list->entries = test_ptr;
+	}
+
+	entry = &(rom_list->entries[rom_list->entry_count]);
+	memset(entry, 0, sizeof(AmigaROMHashGenEntry));
+	entry->line_number = line_number;
+	entry->merkle_tree = GetInitializedAmigaROMMerkleTree();
+
+	return entry;
+}
+
+// Reads every entry in the ROM list at list_path into rom_list.
+// Returns false, after reporting the offending line, if anything is malformed.
+bool ReadAmigaROMList(const char *list_path, AmigaROMHashGenList *rom_list)
+{
+	FILE *fp;
+	char line[HASHGEN_MAX_LINE_LENGTH];
+	AmigaROMHashGenEntry *entry;
+	size_t line_number = 0;
+	char *content;
+
+	fp = fopen(list_path, "r");
+	if(!fp)
+	{
+		fprintf(stderr, "ERROR: Unable to open ROM list at: %s\n", list_path);
+		return false;
+	}
+
+	while(fgets(line, sizeof(line), fp))
+	{
+		line_number++;
+
+		if(!strchr(line, '\n') && !feof(fp))
+		{
+			fprintf(stderr, "ERROR: %s:%zu: Line is too long.\n", list_path, line_number);
+			fclose(fp);
+			return false;
+		}
+
+		content = line + strspn(line, " \t");
+		if(*content == '#' || *content == '\r' || *content == '\n' || *content == '\0')
+		{
+			continue;
+		}
+
+		entry = ReserveAmigaROMListEntry(rom_list, line_number);
+		if(!entry)
+		{
+			fprintf(stderr, "ERROR: Out of memory reading ROM list.\n");
+			fclose(fp);
+			return false;
+		}
+
+		if(!ParseAmigaROMListLine(content, entry))
+		{
+			fprintf(stderr, "ERROR: %s:%zu: Malformed ROM entry.\n", list_path, line_number);
+			fclose(fp);
+			return false;
+		}
+
+		rom_list->entry_count++;
+	}
+
+	fclose(fp);
+
+	return true;
+}
+
+// Returns whether word appears in text as a whole word, ignoring case.
+// word must be lower case.
+static bool ContainsDatWord(const char *text, const char *word)
+{
+	size_t word_length = strlen(word);
+	size_t i;
+	const char *start;
+
+	for(start = text; *start; start++)
+	{
+		if(start != text && isalnum((unsigned char)start[-1]))
+		{
+			continue;
+		}
+
+		for(i = 0; i < word_length && start[i] && tolower((unsigned char)start[i]) == word[i]; i++)
+		{
+		}
+
+		if(i == word_length && !isalnum((unsigned char)start[word_length]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Works out the type and byte swap of an imported ROM from its name, as
+// DATs don't record either: halves marked "(Hi)" or U34 and "(Lo)" or U35
+// are split Kickstarts (stored byte swapped, like the split ROMs in the
+// list), Ext or Extended marks an extended ROM and Kickstart or AmigaOS a
+// merged one.  Anything else is other.  Otherwise only names saying
+// "swapped" are byte swapped.  A bare Hi or Lo isn't a half marker, as in
+// "Hi-Res" or "Lo-Fi".
+static void ClassifyImportedROM(const char *name, char *type, int *byte_swap)
+{
+	if(ContainsDatWord(name, "(hi)") || ContainsDatWord(name, "u34"))
+	{
+		*type = 'A';
+		*byte_swap = 1;
+		return;
+	}
+
+	if(ContainsDatWord(name, "(lo)") || ContainsDatWord(name, "u35"))
+	{
+		*type = 'B';
+		*byte_swap = 1;
+		return;
+	}
+
+	if(ContainsDatWord(name, "ext") || ContainsDatWord(name, "extended"))
+	{
+		*type = 'E';
+	}
+	else if(ContainsDatWord(name, "kickstart") || ContainsDatWord(name, "kick") || ContainsDatWord(name, "amigaos"))
+	{
+		*type = 'M';
+	}
+	else
+	{
+		*type = 'O';
+	}
+
+	*byte_swap = (ContainsDatWord(name, "swapped") || ContainsDatWord(name, "byteswapped")) ? 1 : 0;
+}
+
+// Builds the version string of an imported ROM: the game's description (or
+// name), or for a game with several hashed ROMs, the ROM's name without its
+// extension, prefixed with the game's unless it already starts with it.
+// Characters the generated header can't hold are replaced, and the string
+// is cut short on a UTF-8 character boundary if it's too long.
+static void BuildImportedROMVersion(const AmigaROMDatGame *game, const AmigaROMDatRom *rom, char *version)
+{
+	char full_name[(AMIGA_ROM_DAT_MAX_NAME_LENGTH * 2) + 1];
+	const char *game_name = game->description[0] ? game->description : game->name;
+	const char *extension;
+	size_t rom_name_length, length, i;
+	bool has_game_prefix;
+
+	rom_name_length = strlen(rom->name);
+	extension = strrchr(rom->name, '.');
+	if(extension && extension != rom->name)
+	{
+		rom_name_length = (size_t)(extension - rom->name);
+	}
+
+	has_game_prefix = (game->name[0] && strncmp(rom->name, game->name, strlen(game->name)) == 0) || (game->description[0] && strncmp(rom->name, game->description, strlen(game->description)) == 0);
+
+	if(game->hashed_rom_count > 1 && rom_name_length > 0 && (has_game_prefix || !game_name[0]))
+	{
+		snprintf(full_name, sizeof(full_name), "%.*s", (int)rom_name_length, rom->name);
+	}
+	else if(game->hashed_rom_count > 1 && rom_name_length > 0)
+	{
+		snprintf(full_name, sizeof(full_name), "%s %.*s", game_name, (int)rom_name_length, rom->name);
+	}
+	else if(game_name[0])
+	{
+		snprintf(full_name, sizeof(full_name), "%s", game_name);
+	}
+	else
+	{
+		snprintf(full_name, sizeof(full_name), "%.*s", (int)rom_name_length, rom->name);
+	}
+
+	length = strlen(full_name);
+	if(length >= HASHGEN_MAX_VERSION_LENGTH)
+	{
+		length = HASHGEN_MAX_VERSION_LENGTH - 1;
+		while(length > 0 && ((unsigned char)full_name[length] & 0xC0) == 0x80)
+		{
+			length--;
+		}
+	}
+
+	while(length > 0 && (full_name[length - 1] == ' ' || full_name[length - 1] == '\t'))
+	{
+		length--;
+	}
+
+	for(i = 0; i < length; i++)
+	{
+		if(full_name[i] == '"')
+		{
+			version[i] = '\'';
+		}
+		else if(full_name[i] == '\\')
+		{
+			version[i] = '/';
+		}
+		else if((unsigned char)full_name[i] < 0x20)
+		{
+			version[i] = ' ';
+		}
+		else
+		{
+			version[i] = full_name[i];
+		}
+	}
+
+	version[length] = '\0';
+}
+
+// Adds one ROM from a DAT to the list.  ROMs without a SHA256 digest or a
+// usable size can't be indexed and are only counted.
+static bool AddImportedROM(const AmigaROMDatGame *game, const AmigaROMDatRom *rom, void *context)
+{
+	AmigaROMHashGenImport *import = (AmigaROMHashGenImport*)context;
+	AmigaROMHashGenEntry *entry;
+	char classified_name[HASHGEN_MAX_VERSION_LENGTH + AMIGA_ROM_DAT_MAX_NAME_LENGTH + 1];
+
+	if(!(rom->has_sha256_digest) || !(rom->has_file_size) || rom->file_size == 0 || rom->file_size > 0xFFFFFFFFULL)
+	{
+		import->skipped_count++;
+		return true;
+	}
+
+	entry = ReserveAmigaROMListEntry(import->rom_list, rom->line_number);
+	if(!entry)
+	{
+		fprintf(stderr, "ERROR: Out of memory importing DAT at: %s\n", import->dat_path);
+		return false;
+	}
+
+	memcpy(entry->sha256_digest, rom->sha256_digest, 32);
+	entry->file_size = (size_t)(rom->file_size);
+	entry->imported = true;
+	BuildImportedROMVersion(game, rom, entry->version);
+	if(entry->version[0] == '\0')
+	{
+		import->skipped_count++;
+		return true;
+	}
+
+	// The ROM's own name can carry the Hi/Lo marking when the game's doesn't
+	snprintf(classified_name, sizeof(classified_name), "%s %s", entry->version, rom->name);
+	ClassifyImportedROM(classified_name, &(entry->type), &(entry->byte_swap));
+
+	import->rom_list->entry_count++;
+	import->imported_count++;
+
+	return true;
+}
+
+// Streams every ROM in the Logiqx XML or clrmamepro DAT at dat_path into
+// rom_list.  Returns false if the DAT can't be read or is malformed.
+bool ReadAmigaROMDat(const char *dat_path, AmigaROMHashGenList *rom_list)
+{
+	AmigaROMHashGenImport import = {rom_list, dat_path, 0, 0};
+
+	if(!ImportAmigaROMDat(dat_path, AddImportedROM, &import))
+	{
+		return false;
+	}
+
+	printf("Imported %zu ROMs from %s", import.imported_count, dat_path);
+	if(import.skipped_count > 0)
+	{
+		printf(" (skipped %zu without a SHA-256 digest or size)", import.skipped_count);
+	}
+	printf(".\n");
+
+	return true;
+}
+
+static int CompareEntryDigests(const void *left, const void *right)
+{
+	const AmigaROMHashGenEntry *left_entry = *(const AmigaROMHashGenEntry* const*)left;
+	const AmigaROMHashGenEntry *right_entry = *(const AmigaROMHashGenEntry* const*)right;
+
+	return memcmp(left_entry->sha256_digest, right_entry->sha256_digest, 32);
+}
+
+// Orders entries by digest, and entries with the same digest in list order.
+static int CompareEntryDigestsInOrder(const void *left, const void *right)
+{
+	const AmigaROMHashGenEntry *left_entry = *(const AmigaROMHashGenEntry* const*)left;
+	const AmigaROMHashGenEntry *right_entry = *(const AmigaROMHashGenEntry* const*)right;
+	int result = memcmp(left_entry->sha256_digest, right_entry->sha256_digest, 32);
+
+	if(result != 0)
+	{
+		return result;
+	}
+
+	return (left_entry > right_entry) - (left_entry < right_entry);
+}
+
+// Drops imported entries whose digest is already in the list or earlier in
+// the DATs, so a hand-written list entry always wins over an imported one.
+// Returns the number of entries dropped.
+size_t RemoveImportedDuplicates(AmigaROMHashGenList *rom_list)
+{
+	AmigaROMHashGenEntry **sorted_entries;
+	size_t removed_count = 0;
+	size_t i, kept;
+
+	sorted_entries = (AmigaROMHashGenEntry**)malloc(rom_list->entry_count * sizeof(AmigaROMHashGenEntry*));
+	if(!sorted_entries)
+	{
+		// CheckAmigaROMListDuplicates() will report them instead
+		return 0;
+	}
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		sorted_entries[i] = &(rom_list->entries[i]);
+	}
+
+	qsort(sorted_entries, rom_list->entry_count, sizeof(AmigaROMHashGenEntry*), CompareEntryDigestsInOrder);
+
+	// Imported entries are only ever read after the list, so the first entry
+	// with each digest is the one to keep.  Marked entries get a zero size.
+	for(i = 1; i < rom_list->entry_count; i++)
+	{
+		if(sorted_entries[i]->imported && memcmp(sorted_entries[i - 1]->sha256_digest, sorted_entries[i]->sha256_digest, 32) == 0)
+		{
+			sorted_entries[i]->file_size = 0;
+			removed_count++;
+		}
+	}
+
+	free(sorted_entries);
+
+	for(i = 0, kept = 0; i < rom_list->entry_count; i++)
+	{
+		if(rom_list->entries[i].file_size != 0)
+		{
+			rom_list->entries[kept++] = rom_list->entries[i];
+		}
+	}
+
+	rom_list->entry_count = kept;
+
+	return removed_count;
+}
+
+// Reports every digest which appears more than once in the list.
+// Returns true if there are no duplicates.
+bool CheckAmigaROMListDuplicates(const AmigaROMHashGenList *rom_list)
+{
+	const AmigaROMHashGenEntry **sorted_entries;
+	size_t i;
+	bool unique = true;
+
+	sorted_entries = (const AmigaROMHashGenEntry**)malloc(rom_list->entry_count * sizeof(AmigaROMHashGenEntry*));
+	if(!sorted_entries)
+	{
+		fprintf(stderr, "ERROR: Out of memory checking for duplicates.\n");
+		return false;
+	}
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		sorted_entries[i] = &(rom_list->entries[i]);
+	}
+
+	qsort(sorted_entries, rom_list->entry_count, sizeof(AmigaROMHashGenEntry*), CompareEntryDigests);
+
+	for(i = 1; i < rom_list->entry_count; i++)
+	{
+		if(memcmp(sorted_entries[i - 1]->sha256_digest, sorted_entries[i]->sha256_digest, 32) == 0)
+		{
+			fprintf(stderr, "ERROR: Duplicate digest on lines %zu and %zu (\"%s\" and \"%s\").\n", sorted_entries[i - 1]->line_number, sorted_entries[i]->line_number, sorted_entries[i - 1]->version, sorted_entries[i]->version);
+			unique = false;
+		}
+	}
+
+	free(sorted_entries);
+
+	return unique;
+}
+
+static uint32_t ReadBigEndianWord(const uint8_t *bytes)
+{
+	return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+// Adds one layout of the entry at canonical_entry to rom_list, tagged with
+// the AMIGA_ROM_VIEW_* bits it is of it.  A layout already in the list is
+// tagged where it is instead, unless it is another canonical image or is
+// already tagged, in which case it is dropped with a warning.
+static bool AddDerivedAmigaROMEntry(AmigaROMHashGenList *rom_list, const size_t canonical_entry, const uint8_t *digest, const size_t file_size, const uint8_t view)
+{
+	const AmigaROMHashGenEntry *canonical;
+	AmigaROMHashGenEntry *entry;
+	const char *half_name;
+	size_t i;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = &(rom_list->entries[i]);
+		if(memcmp(entry->sha256_digest, digest, 32) == 0)
+		{
+			if(entry->derived_view == AMIGA_ROM_VIEW_NONE && (entry->byte_swap != 0 || entry->type == 'A' || entry->type == 'B'))
+			{
+				entry->derived_view = view;
+				entry->canonical_entry = canonical_entry;
+			}
+			else
+			{
+				fprintf(stderr, "WARNING: Dropping the %s%s layout of %s, which is the same as %s.\n", (view & AMIGA_ROM_VIEW_MIRRORED) ? "mirrored " : "", GetAmigaROMViewName(view & AMIGA_ROM_VIEW_ALL), rom_list->entries[canonical_entry].version, entry->version);
+			}
+
+			return true;
+		}
+	}
+
+	entry = ReserveAmigaROMListEntry(rom_list, rom_list->entries[canonical_entry].line_number);
+	if(!entry)
+	{
+		fprintf(stderr, "ERROR: Out of memory adding derived ROM layouts.\n");
+		return false;
+	}
+	canonical = &(rom_list->entries[canonical_entry]);
+
+	memcpy(entry->sha256_digest, digest, 32);
+	entry->file_size = file_size;
+	entry->byte_swap = (view & (AMIGA_ROM_VIEW_BYTE_SWAPPED | AMIGA_ROM_VIEW_HI_BYTE_SWAPPED | AMIGA_ROM_VIEW_LO_BYTE_SWAPPED)) ? 1 : 0;
+	entry->imported = canonical->imported;
+	entry->derived_view = view;
+	entry->canonical_entry = canonical_entry;
+
+	// Named like the Hi and Lo entries in the list
+	if(view & (AMIGA_ROM_VIEW_HI | AMIGA_ROM_VIEW_HI_BYTE_SWAPPED))
+	{
+		entry->type = 'A';
+		half_name = " Hi";
+	}
+	else if(view & (AMIGA_ROM_VIEW_LO | AMIGA_ROM_VIEW_LO_BYTE_SWAPPED))
+	{
+		entry->type = 'B';
+		half_name = " Lo";
+	}
+	else
+	{
+		entry->type = canonical->type;
+		half_name = "";
+	}
+
+	memcpy(entry->version, canonical->version, sizeof(entry->version));
+	if(strlen(entry->version) + strlen(half_name) < sizeof(entry->version))
+	{
+		strcat(entry->version, half_name);
+	}
+
+	rom_list->entry_count++;
+
+	return true;
+}
+
+// Hashes the Hi or Lo half of image_data selected by view repeated to fill
+// image_size bytes, the way SplitAmigaROM() writes each EPROM image.
+static bool CalculateMirroredSplitDigest(const uint8_t *image_data, const size_t image_size, const uint8_t view, uint8_t *digest)
+{
+	SHA256Context context;
+	uint8_t *half;
+	size_t source_offset = (view & (AMIGA_ROM_VIEW_HI | AMIGA_ROM_VIEW_HI_BYTE_SWAPPED)) ? 0 : 2;
+	size_t i;
+
+	half = (uint8_t*)malloc(image_size / 2);
+	if(!half)
+	{
+		return false;
+	}
+
+	for(i = 0; i < image_size; i += 4)
+	{
+		if(view & (AMIGA_ROM_VIEW_HI_BYTE_SWAPPED | AMIGA_ROM_VIEW_LO_BYTE_SWAPPED))
+		{
+			half[i / 2] = image_data[i + source_offset + 1];
+			half[(i / 2) + 1] = image_data[i + source_offset];
+		}
+		else
+		{
+			memcpy(&half[i / 2], &image_data[i + source_offset], 2);
+		}
+	}
+
+	SHA256Init(&context);
+	SHA256Update(&context, half, image_size / 2);
+	SHA256Update(&context, half, image_size / 2);
+	SHA256Final(&context, digest);
+
+	free(half);
+
+	return true;
+}
+
+// Adds the digest of every other layout of the canonical ROM image at
+// canonical_entry to rom_list: byte swapped, and the Hi and Lo halves for
+// the U34 and U35 EPROMs in either byte order, both as the halves alone
+// (repeated to fill a 256KB EPROM if small) and mirrored to the size of the
+// merged image.  Only unswapped merged images are canonical.
+static bool AddDerivedAmigaROMEntries(AmigaROMHashGenList *rom_list, const size_t canonical_entry, const uint8_t *image_data, const size_t image_size)
+{
+	AmigaROMViewDigests view_digests;
+	const AmigaROMHashGenEntry *canonical = &(rom_list->entries[canonical_entry]);
+	const uint8_t split_views = AMIGA_ROM_VIEW_HI | AMIGA_ROM_VIEW_LO | AMIGA_ROM_VIEW_HI_BYTE_SWAPPED | AMIGA_ROM_VIEW_LO_BYTE_SWAPPED;
+	uint8_t digest[32];
+	uint8_t view;
+	size_t i;
+
+	if(canonical->byte_swap != 0 || canonical->type == 'A' || canonical->type == 'B' || canonical->derived_view != AMIGA_ROM_VIEW_NONE)
+	{
+		return true;
+	}
+
+	if(!CalculateAmigaROMViewDigests(image_data, image_size, AMIGA_ROM_VIEW_ALL & ~AMIGA_ROM_VIEW_AS_IS, &view_digests))
+	{
+		fprintf(stderr, "ERROR: Unable to hash the layouts of %s.\n", canonical->version);
+		return false;
+	}
+
+	for(i = 0; i < AMIGA_ROM_VIEW_COUNT; i++)
+	{
+		view = (uint8_t)(1 << i);
+		if(!(view_digests.computed_views & view))
+		{
+			continue;
+		}
+
+		if(!AddDerivedAmigaROMEntry(rom_list, canonical_entry, view_digests.sha256[i], view_digests.view_size[i], view))
+		{
+			return false;
+		}
+
+		if((view & split_views) && view_digests.view_size[i] < image_size)
+		{
+			if(!CalculateMirroredSplitDigest(image_data, image_size, view, digest))
+			{
+				fprintf(stderr, "ERROR: Out of memory adding derived ROM layouts.\n");
+				return false;
+			}
+
+			if(!AddDerivedAmigaROMEntry(rom_list, canonical_entry, digest, image_size, view | AMIGA_ROM_VIEW_MIRRORED))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+// Finds the resident modules of a Kickstart, extended or other ROM image
+// and keeps them with its entry.  Split Hi and Lo images are skipped, as
+// their modules are interleaved with each other.
+static bool ScanAmigaROMImageModules(AmigaROMHashGenEntry *entry, const uint8_t *image_data, const size_t image_size)
+{
+	AmigaROMModule *test_ptr;
+
+	if(entry->type == 'A' || entry->type == 'B')
+	{
+		return true;
+	}
+
+	entry->modules = (AmigaROMModule*)malloc(AMIGA_ROM_MAX_MODULES * sizeof(AmigaROMModule));
+	if(!(entry->modules))
+	{
+		return false;
+	}
+
+	entry->module_count = ScanAmigaROMModules(image_data, image_size, entry->byte_swap != 0, entry->modules, AMIGA_ROM_MAX_MODULES);
+	if(entry->module_count == 0)
+	{
+		free(entry->modules);
+		entry->modules = NULL;
+		return true;
+	}
+
+	test_ptr = realloc(entry->modules, entry->module_count * sizeof(AmigaROMModule));
+	if(test_ptr)
+	{
+		entry->modules = test_ptr;
+	}
+
+	return true;
+}
+
+// Reads the ROM image at image_path, finds the list entry with its digest and
+// stores the image's structural fingerprint, Merkle leaves, EPROM bank
+// checksums and resident modules with it.  Returns false if the image can't be read, isn't in the
+// list, or was already given.
+bool ReadAmigaROMImage(const char *image_path, AmigaROMHashGenList *rom_list)
+{
+	FILE *fp;
+	uint8_t *image_data;
+	uint8_t digest[32];
+	long image_size;
+	size_t i;
+	AmigaROMHashGenEntry *entry = NULL;
+
+	fp = fopen(image_path, "rb");
+	if(!fp)
+	{
+		fprintf(stderr, "ERROR: Unable to open ROM image at: %s\n", image_path);
+		return false;
+	}
+
+	if(fseek(fp, 0, SEEK_END) != 0 || (image_size = ftell(fp)) <= 0 || fseek(fp, 0, SEEK_SET) != 0)
+	{
+		fprintf(stderr, "ERROR: Unable to read ROM image at: %s\n", image_path);
+		fclose(fp);
+		return false;
+	}
+
+	image_data = (uint8_t*)malloc((size_t)image_size);
+	if(!image_data)
+	{
+		fprintf(stderr, "ERROR: Out of memory reading ROM image at: %s\n", image_path);
+		fclose(fp);
+		return false;
+	}
+
+	if(fread(image_data, 1, (size_t)image_size, fp) != (size_t)image_size)
+	{
+		fprintf(stderr, "ERROR: Unable to read ROM image at: %s\n", image_path);
+		free(image_data);
+		fclose(fp);
+		return false;
+	}
+
+	fclose(fp);
+
+	SHA256(image_data, (size_t)image_size, digest, NULL);
+
+	for(i = 0; i < rom_list->entry_count && !entry; i++)
+	{
+		if(memcmp(rom_list->entries[i].sha256_digest, digest, 32) == 0)
+		{
+			entry = &(rom_list->entries[i]);
+		}
+	}
+
+	if(!entry)
+	{
+		fprintf(stderr, "ERROR: ROM image at %s is not in the ROM list.\n", image_path);
+		free(image_data);
+		return false;
+	}
+
+	if(entry->merkle_tree.leaves)
+	{
+		fprintf(stderr, "ERROR: ROM image at %s was given more than once.\n", image_path);
+		free(image_data);
+		return false;
+	}
+
+	// The same raw big-endian words AmigaROMUtil's GetAmigaROMFingerprint() reads
+	if(image_size >= 24)
+	{
+		entry->fingerprint[0] = ReadBigEndianWord(&image_data[0]);
+		entry->fingerprint[1] = ReadBigEndianWord(&image_data[12]);
+		entry->fingerprint[2] = ReadBigEndianWord(&image_data[image_size - 24]);
+		entry->fingerprint[3] = ReadBigEndianWord(&image_data[image_size - 16]);
+		entry->has_fingerprint = true;
+	}
+
+	if(!CalculateAmigaROMMerkleTree(image_data, (size_t)image_size, 0, &(entry->merkle_tree)))
+	{
+		fprintf(stderr, "ERROR: Unable to hash ROM image at: %s\n", image_path);
+		free(image_data);
+		return false;
+	}
+
+	// Only merged images are ever split across two EPROMs
+	if(entry->type == 'M' && entry->byte_swap == 0 && !CalculateAmigaROMBankChecksums(image_data, (size_t)image_size, false, &(entry->bank_checksums)))
+	{
+		entry->bank_checksums.bank_count = 0;
+	}
+
+	if(!ScanAmigaROMImageModules(entry, image_data, (size_t)image_size))
+	{
+		fprintf(stderr, "ERROR: Out of memory reading ROM image at: %s\n", image_path);
+		free(image_data);
+		return false;
+	}
+
+	if(!AddDerivedAmigaROMEntries(rom_list, (size_t)(entry - rom_list->entries), image_data, (size_t)image_size))
+	{
+		free(image_data);
+		return false;
+	}
+
+	free(image_data);
+
+	return true;
+}
+
+static int CompareBucketSizes(const void *left, const void *right)
+{
+	const AmigaROMHashGenBucket *left_bucket = (const AmigaROMHashGenBucket*)left;
+	const AmigaROMHashGenBucket *right_bucket = (const AmigaROMHashGenBucket*)right;
+
+	if(left_bucket->key_count != right_bucket->key_count)
+	{
+		return (left_bucket->key_count < right_bucket->key_count) - (left_bucket->key_count > right_bucket->key_count);
+	}
+
+	return (left_bucket->bucket > right_bucket->bucket) - (left_bucket->bucket < right_bucket->bucket);
+}
+
+// Builds a minimal perfect hash using hash-and-displace: each digest falls in
+// the bucket picked by its first four bytes, and every bucket gets the first
+// seed that sends all of its digests (mixed with the next four bytes) to
+// distinct, unused slots.  Buckets are placed largest first.  On success,
+// slots[i] is the table index for rom_list->entries[i].
+bool BuildAmigaROMPerfectHash(const AmigaROMHashGenList *rom_list, uint32_t *seeds, size_t bucket_count, size_t *slots)
+{
+	AmigaROMHashGenBucket *buckets;
+	size_t *bucket_keys;
+	size_t *bucket_key_offsets;
+	bool *slot_used;
+	size_t candidate_slots[64];
+	size_t i, j, k, bucket, key_count;
+	uint32_t seed;
+	bool placed;
+	bool result = true;
+	size_t entry_count = rom_list->entry_count;
+
+	buckets = (AmigaROMHashGenBucket*)calloc(bucket_count, sizeof(AmigaROMHashGenBucket));
+	bucket_keys = (size_t*)malloc(entry_count * sizeof(size_t));
+	bucket_key_offsets = (size_t*)calloc(bucket_count + 1, sizeof(size_t));
+	slot_used = (bool*)calloc(entry_count, sizeof(bool));
+
+	if(!buckets || !bucket_keys || !bucket_key_offsets || !slot_used)
+	{
+		fprintf(stderr, "ERROR: Out of memory building the perfect hash.\n");
+		free(buckets);
+		free(bucket_keys);
+		free(bucket_key_offsets);
+		free(slot_used);
+		return false;
+	}
+
+	// Counting sort of the entries by bucket
+	for(i = 0; i < entry_count; i++)
+	{
+		bucket_key_offsets[(AmigaROMHashKey(rom_list->entries[i].sha256_digest) % bucket_count) + 1]++;
+	}
+
+	for(i = 0; i < bucket_count; i++)
+	{
+		buckets[i].bucket = i;
+		buckets[i].key_count = bucket_key_offsets[i + 1];
+		bucket_key_offsets[i + 1] += bucket_key_offsets[i];
+	}
+
+	for(i = 0; i < entry_count; i++)
+	{
+		bucket = AmigaROMHashKey(rom_list->entries[i].sha256_digest) % bucket_count;
+		bucket_keys[bucket_key_offsets[bucket]++] = i;
+	}
+
+	for(i = bucket_count; i > 0; i--)
+	{
+		bucket_key_offsets[i] = bucket_key_offsets[i - 1];
+	}
+	bucket_key_offsets[0] = 0;
+
+	qsort(buckets, bucket_count, sizeof(AmigaROMHashGenBucket), CompareBucketSizes);
+
+	for(i = 0; i < bucket_count && buckets[i].key_count > 0 && result; i++)
+	{
+		bucket = buckets[i].bucket;
+		key_count = buckets[i].key_count;
+
+		if(key_count > sizeof(candidate_slots) / sizeof(candidate_slots[0]))
+		{
+			fprintf(stderr, "ERROR: Too many ROMs share a perfect hash bucket.\n");
+			result = false;
+			break;
+		}
+
+		placed = false;
+
+		for(seed = 0; seed < HASHGEN_MAX_SEED_ATTEMPTS && !placed; seed++)
+		{
+			placed = true;
+
+			for(j = 0; j < key_count && placed; j++)
+			{
+				candidate_slots[j] = AmigaROMHashMix(AmigaROMHashKey(&(rom_list->entries[bucket_keys[bucket_key_offsets[bucket] + j]].sha256_digest[4])), seed) % entry_count;
+
+				if(slot_used[candidate_slots[j]])
+				{
+					placed = false;
+				}
+
+				for(k = 0; k < j && placed; k++)
+				{
+					if(candidate_slots[k] == candidate_slots[j])
+					{
+						placed = false;
+					}
+				}
+			}
+
+			if(placed)
+			{
+				seeds[bucket] = seed;
+
+				for(j = 0; j < key_count; j++)
+				{
+					slot_used[candidate_slots[j]] = true;
+					slots[bucket_keys[bucket_key_offsets[bucket] + j]] = candidate_slots[j];
+				}
+			}
+		}
+
+		if(!placed)
+		{
+			fprintf(stderr, "ERROR: Unable to find a perfect hash seed for bucket %zu.\n", bucket);
+			result = false;
+		}
+	}
+
+	free(buckets);
+	free(bucket_keys);
+	free(bucket_key_offsets);
+	free(slot_used);
+
+	return result;
+}
+
+static const char AMIGA_ROM_HASHES_LICENSE[] =
+	"/*\n"
+	"MIT License\n"
+	"\n"
+	"Copyright (c) 2026 Christopher Gelatt\n"
+	"\n"
+	"Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+	"of this software and associated documentation files (the \"Software\"), to deal\n"
+	"in the Software without restriction, including without limitation the rights\n"
+	"to use, copy, modify, merge, publish, distribute, sublicense, and/or sell\n"
+	"copies of the Software, and to permit persons to whom the Software is\n"
+	"furnished to do so, subject to the following conditions:\n"
+	"\n"
+	"The above copyright notice and this permission notice shall be included in all\n"
+	"copies or substantial portions of the Software.\n"
+	"\n"
+	"THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+	"IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+	"FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+	"AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+	"LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,\n"
+	"OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE\n"
+	"SOFTWARE.\n"
+	"*/\n";
+
+static int CompareEntryFingerprints(const void *left, const void *right)
+{
+	const AmigaROMHashGenEntry *left_entry = *(const AmigaROMHashGenEntry* const*)left;
+	const AmigaROMHashGenEntry *right_entry = *(const AmigaROMHashGenEntry* const*)right;
+	size_t i;
+
+	if(left_entry->file_size != right_entry->file_size)
+	{
+		return (left_entry->file_size > right_entry->file_size) - (left_entry->file_size < right_entry->file_size);
+	}
+
+	for(i = 0; i < 4; i++)
+	{
+		if(left_entry->fingerprint[i] != right_entry->fingerprint[i])
+		{
+			return (left_entry->fingerprint[i] > right_entry->fingerprint[i]) - (left_entry->fingerprint[i] < right_entry->fingerprint[i]);
+		}
+	}
+
+	return (left_entry->slot > right_entry->slot) - (left_entry->slot < right_entry->slot);
+}
+
+// Fills sorted_entries, which must hold entry_count pointers, with the
+// entries (only those with a fingerprint, if fingerprinted_only is true)
+// sorted by size and then by the fingerprint words.  Returns the count.
+static size_t SortAmigaROMFingerprintEntries(const AmigaROMHashGenList *rom_list, const AmigaROMHashGenEntry **slot_entries, const bool fingerprinted_only, const AmigaROMHashGenEntry **sorted_entries)
+{
+	size_t i;
+	size_t sorted_count = 0;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		if(slot_entries[i]->has_fingerprint || !fingerprinted_only)
+		{
+			sorted_entries[sorted_count++] = slot_entries[i];
+		}
+	}
+
+	qsort(sorted_entries, sorted_count, sizeof(AmigaROMHashGenEntry*), CompareEntryFingerprints);
+
+	return sorted_count;
+}
+
+// Returns the number of entries without a fingerprint in the run of
+// size-sorted entries starting at first, and sets *end to the end of the run.
+static size_t CountUnfingerprintedEntries(const AmigaROMHashGenEntry **sorted_entries, const size_t entry_count, const size_t first, size_t *end)
+{
+	size_t unfingerprinted_count = 0;
+	size_t i;
+
+	for(i = first; i < entry_count && sorted_entries[i]->file_size == sorted_entries[first]->file_size; i++)
+	{
+		if(!(sorted_entries[i]->has_fingerprint))
+		{
+			unfingerprinted_count++;
+		}
+	}
+
+	*end = i;
+
+	return unfingerprinted_count;
+}
+
+// Counts the fingerprinted entries and the distinct file sizes.
+static bool CountAmigaROMFingerprintTables(const AmigaROMHashGenList *rom_list, const AmigaROMHashGenEntry **slot_entries, size_t *fingerprint_count, size_t *size_class_count)
+{
+	const AmigaROMHashGenEntry **sorted_entries;
+	size_t i, j;
+
+	sorted_entries = (const AmigaROMHashGenEntry**)malloc(rom_list->entry_count * sizeof(AmigaROMHashGenEntry*));
+	if(!sorted_entries)
+	{
+		fprintf(stderr, "ERROR: Out of memory counting fingerprints.\n");
+		return false;
+	}
+
+	*fingerprint_count = 0;
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		if(slot_entries[i]->has_fingerprint)
+		{
+			(*fingerprint_count)++;
+		}
+	}
+
+	*size_class_count = 0;
+	SortAmigaROMFingerprintEntries(rom_list, slot_entries, false, sorted_entries);
+	for(i = 0; i < rom_list->entry_count; i = j)
+	{
+		CountUnfingerprintedEntries(sorted_entries, rom_list->entry_count, i, &j);
+		(*size_class_count)++;
+	}
+
+	free(sorted_entries);
+
+	return true;
+}
+
+// Writes the fingerprint index, sorted by size and then by the fingerprint
+// words, followed by every known file size and how many ROMs of that size
+// have no fingerprint.
+static bool WriteAmigaROMFingerprints(FILE *fp, const AmigaROMHashGenList *rom_list, const AmigaROMHashGenEntry **slot_entries)
+{
+	const AmigaROMHashGenEntry **sorted_entries;
+	const AmigaROMHashGenEntry *entry;
+	size_t fingerprint_count;
+	size_t unfingerprinted_count;
+	size_t i, j;
+
+	sorted_entries = (const AmigaROMHashGenEntry**)malloc(rom_list->entry_count * sizeof(AmigaROMHashGenEntry*));
+	if(!sorted_entries)
+	{
+		fprintf(stderr, "ERROR: Out of memory writing the fingerprints.\n");
+		return false;
+	}
+
+	fingerprint_count = SortAmigaROMFingerprintEntries(rom_list, slot_entries, true, sorted_entries);
+
+	fprintf(fp, "const AmigaROMFingerprint AMIGA_ROM_FINGERPRINTS[AMIGA_ROM_FINGERPRINT_COUNT + 1] = {\n");
+	for(i = 0; i < fingerprint_count; i++)
+	{
+		entry = sorted_entries[i];
+		fprintf(fp, "\t{%zu, 0x%08lX, 0x%08lX, 0x%08lX, 0x%08lX, %zu},\n", entry->file_size, (unsigned long)entry->fingerprint[0], (unsigned long)entry->fingerprint[1], (unsigned long)entry->fingerprint[2], (unsigned long)entry->fingerprint[3], entry->slot);
+	}
+	fprintf(fp, "\t{0, 0, 0, 0, 0, 0}\n};\n\n");
+
+	SortAmigaROMFingerprintEntries(rom_list, slot_entries, false, sorted_entries);
+
+	fprintf(fp, "const AmigaROMSizeClass AMIGA_ROM_SIZE_CLASSES[AMIGA_ROM_SIZE_CLASS_COUNT] = {\n");
+	for(i = 0; i < rom_list->entry_count; i = j)
+	{
+		unfingerprinted_count = CountUnfingerprintedEntries(sorted_entries, rom_list->entry_count, i, &j);
+		fprintf(fp, "\t{%zu, %zu}%s\n", sorted_entries[i]->file_size, unfingerprinted_count, (j < rom_list->entry_count) ? "," : "");
+	}
+	fprintf(fp, "};\n");
+
+	free(sorted_entries);
+
+	return true;
+}
+
+static void WriteAmigaROMDigestBytes(FILE *fp, const uint8_t *digest)
+{
+	size_t i;
+
+	for(i = 0; i < 32; i++)
+	{
+		fprintf(fp, "%s0x%02x", (i == 0) ? "" : ",", digest[i]);
+	}
+}
+
+// Writes a version string as a list of character constants, which unlike
+// one long string literal has no length limit.
+static void WriteAmigaROMVersionChars(FILE *fp, const char *version)
+{
+	const unsigned char *c;
+
+	fprintf(fp, "\t");
+	for(c = (const unsigned char*)version; *c; c++)
+	{
+		if(*c == '\'' || *c < 0x20 || *c >= 0x7F)
+		{
+			fprintf(fp, "'\\x%02X',", *c);
+		}
+		else
+		{
+			fprintf(fp, "'%c',", *c);
+		}
+	}
+	fprintf(fp, "'\\0',\n");
+}
+
+static size_t GetAmigaROMVersionStringsSize(const AmigaROMHashGenList *rom_list)
+{
+	size_t strings_size = 0;
+	size_t i;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		strings_size += strlen(rom_list->entries[i].version) + 1;
+	}
+
+	return strings_size;
+}
+
+static int CompareHashGenModules(const void *left, const void *right)
+{
+	const AmigaROMHashGenModule *left_module = (const AmigaROMHashGenModule*)left;
+	const AmigaROMHashGenModule *right_module = (const AmigaROMHashGenModule*)right;
+	int name_order;
+
+	if(left_module->module->hash != right_module->module->hash)
+	{
+		return (left_module->module->hash > right_module->module->hash) - (left_module->module->hash < right_module->module->hash);
+	}
+
+	name_order = strcmp(left_module->module->name, right_module->module->name);
+	if(name_order != 0)
+	{
+		return name_order;
+	}
+
+	if(left_module->module->version != right_module->module->version)
+	{
+		return (int)left_module->module->version - (int)right_module->module->version;
+	}
+
+	// Earlier list entries first, so they are the ones kept
+	return (left_module->entry > right_module->entry) - (left_module->entry < right_module->entry);
+}
+
+static bool IsSameHashGenModule(const AmigaROMHashGenModule *left, const AmigaROMHashGenModule *right)
+{
+	return (left->module->hash == right->module->hash && left->module->version == right->module->version && strcmp(left->module->name, right->module->name) == 0);
+}
+
+// Collects the distinct resident modules of every ROM image given, each with
+// the first canonical ROM in the list it was found in, sorted by hash, name
+// and version.  *module_table is NULL if there are none.
+// Returns false if it fails.
+static bool BuildAmigaROMModuleTable(const AmigaROMHashGenList *rom_list, AmigaROMHashGenModule **module_table, size_t *module_count)
+{
+	AmigaROMHashGenModule *modules;
+	const AmigaROMHashGenEntry *entry;
+	size_t total_count = 0;
+	size_t i, j;
+
+	*module_table = NULL;
+	*module_count = 0;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		total_count += rom_list->entries[i].module_count;
+	}
+
+	if(total_count == 0)
+	{
+		return true;
+	}
+
+	modules = (AmigaROMHashGenModule*)malloc(total_count * sizeof(AmigaROMHashGenModule));
+	if(!modules)
+	{
+		fprintf(stderr, "ERROR: Out of memory building the module table.\n");
+		return false;
+	}
+
+	total_count = 0;
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = &(rom_list->entries[i]);
+		for(j = 0; j < entry->module_count; j++)
+		{
+			modules[total_count].module = &(entry->modules[j]);
+			modules[total_count].entry = (entry->derived_view != AMIGA_ROM_VIEW_NONE) ? &(rom_list->entries[entry->canonical_entry]) : entry;
+			total_count++;
+		}
+	}
+
+	qsort(modules, total_count, sizeof(AmigaROMHashGenModule), CompareHashGenModules);
+
+	for(i = 0; i < total_count; i++)
+	{
+		if(*module_count == 0 || !IsSameHashGenModule(&modules[*module_count - 1], &modules[i]))
+		{
+			modules[(*module_count)++] = modules[i];
+		}
+	}
+
+	*module_table = modules;
+
+	return true;
+}
+
+// Writes a module name as a string literal.  Names only hold printable
+// characters, but quotes, backslashes and question marks (which could
+// start a trigraph) are escaped.
+static void WriteAmigaROMModuleName(FILE *fp, const char *name)
+{
+	const char *c;
+
+	fprintf(fp, "\"");
+	for(c = name; *c; c++)
+	{
+		if(*c == '"' || *c == '\\' || *c == '?')
+		{
+			fprintf(fp, "\\");
+		}
+		fprintf(fp, "%c", *c);
+	}
+	fprintf(fp, "\"");
+}
+
+// Writes the resident module index, sorted by hash, name and version.
+static bool WriteAmigaROMModules(FILE *fp, const AmigaROMHashGenList *rom_list)
+{
+	AmigaROMHashGenModule *module_table;
+	size_t module_count;
+	size_t i;
+
+	if(!BuildAmigaROMModuleTable(rom_list, &module_table, &module_count))
+	{
+		return false;
+	}
+
+	fprintf(fp, "const AmigaROMModuleInfo AMIGA_ROM_MODULES[AMIGA_ROM_MODULE_COUNT + 1] = {\n");
+	for(i = 0; i < module_count; i++)
+	{
+		fprintf(fp, "\t{UINT64_C(0x%016llX), ", (unsigned long long)module_table[i].module->hash);
+		WriteAmigaROMModuleName(fp, module_table[i].module->name);
+		fprintf(fp, ", &AMIGA_ROM_INFO[%zu], %u}, // %s\n", module_table[i].entry->slot, (unsigned int)module_table[i].module->version, module_table[i].entry->version);
+	}
+	fprintf(fp, "\t{0, NULL, NULL, 0}\n};\n");
+
+	free(module_table);
+
+	return true;
+}
+
+// Returns how many bank checksum records the merged ROMs in rom_list have.
+static size_t CountAmigaROMBankChecksums(const AmigaROMHashGenList *rom_list)
+{
+	size_t bank_checksum_count = 0;
+	size_t i;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		bank_checksum_count += rom_list->entries[i].bank_checksums.bank_count;
+	}
+
+	return bank_checksum_count;
+}
+
+// Writes the EPROM bank checksums of every merged ROM generated from an
+// image, in slot and then bank order.
+static void WriteAmigaROMBankChecksums(FILE *fp, const AmigaROMHashGenList *rom_list, const AmigaROMHashGenEntry **slot_entries)
+{
+	const AmigaROMHashGenEntry *entry;
+	size_t i, j;
+
+	fprintf(fp, "const AmigaROMBankChecksum AMIGA_ROM_BANK_CHECKSUMS[AMIGA_ROM_BANK_CHECKSUM_COUNT + 1] = {\n");
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = slot_entries[i];
+		for(j = 0; j < entry->bank_checksums.bank_count; j++)
+		{
+			fprintf(fp, "\t{%zu, %zu, 0x%08lX, 0x%08lX}, // %s\n", i, j, (unsigned long)entry->bank_checksums.hi_crc32[j], (unsigned long)entry->bank_checksums.lo_crc32[j], entry->version);
+		}
+	}
+	fprintf(fp, "\t{0, 0, 0, 0}\n};\n");
+}
+
+static int CompareHashGenSimilarityKeys(const void *left, const void *right)
+{
+	const AmigaROMHashGenSimilarityKey *left_key = (const AmigaROMHashGenSimilarityKey*)left;
+	const AmigaROMHashGenSimilarityKey *right_key = (const AmigaROMHashGenSimilarityKey*)right;
+
+	if(left_key->key != right_key->key)
+	{
+		return (left_key->key > right_key->key) - (left_key->key < right_key->key);
+	}
+
+	return (left_key->slot > right_key->slot) - (left_key->slot < right_key->slot);
+}
+
+// Collects the band keys of the MinHash signature of every ROM with Merkle
+// leaves, sorted by key and then slot.  *key_table is NULL if there are
+// none.  Returns false if it fails.
+static bool BuildAmigaROMSimilarityKeys(const AmigaROMHashGenList *rom_list, AmigaROMHashGenSimilarityKey **key_table, size_t *key_count)
+{
+	AmigaROMHashGenSimilarityKey *keys;
+	const AmigaROMHashGenEntry *entry;
+	uint32_t minhash[AMIGA_ROM_MERKLE_MINHASH_SIZE];
+	size_t merkle_count = 0;
+	size_t i, j;
+
+	*key_table = NULL;
+	*key_count = 0;
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		if(rom_list->entries[i].merkle_tree.leaves)
+		{
+			merkle_count++;
+		}
+	}
+
+	if(merkle_count == 0)
+	{
+		return true;
+	}
+
+	keys = (AmigaROMHashGenSimilarityKey*)malloc(merkle_count * AMIGA_ROM_MERKLE_MINHASH_BANDS * sizeof(AmigaROMHashGenSimilarityKey));
+	if(!keys)
+	{
+		fprintf(stderr, "ERROR: Out of memory building the similarity index.\n");
+		return false;
+	}
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = &(rom_list->entries[i]);
+		if(!(entry->merkle_tree.leaves))
+		{
+			continue;
+		}
+
+		CalculateAmigaROMMinHash((const uint8_t (*)[32])entry->merkle_tree.leaves, entry->merkle_tree.leaf_count, minhash);
+		for(j = 0; j < AMIGA_ROM_MERKLE_MINHASH_BANDS; j++)
+		{
+			keys[*key_count].key = GetAmigaROMMinHashBandKey(minhash, j);
+			keys[*key_count].slot = entry->slot;
+			(*key_count)++;
+		}
+	}
+
+	qsort(keys, *key_count, sizeof(AmigaROMHashGenSimilarityKey), CompareHashGenSimilarityKeys);
+
+	*key_table = keys;
+
+	return true;
+}
+
+// Writes the similarity index, sorted by key and then ROM.
+static bool WriteAmigaROMSimilarityKeys(FILE *fp, const AmigaROMHashGenList *rom_list)
+{
+	AmigaROMHashGenSimilarityKey *key_table;
+	size_t key_count;
+	size_t i;
+
+	if(!BuildAmigaROMSimilarityKeys(rom_list, &key_table, &key_count))
+	{
+		return false;
+	}
+
+	fprintf(fp, "const AmigaROMSimilarityKey AMIGA_ROM_SIMILARITY_KEYS[AMIGA_ROM_SIMILARITY_KEY_COUNT + 1] = {\n");
+	for(i = 0; i < key_count; i++)
+	{
+		fprintf(fp, "\t{UINT64_C(0x%016llX), %zu},\n", (unsigned long long)key_table[i].key, key_table[i].slot);
+	}
+	fprintf(fp, "\t{0, 0}\n};\n");
+
+	free(key_table);
+
+	return true;
+}
+
+// Writes the generated header, which declares the tables defined once in
+// the generated source.
+bool WriteAmigaROMHashesHeader(const char *header_path, const AmigaROMHashGenList *rom_list, size_t bucket_count, const AmigaROMHashGenEntry **slot_entries)
+{
+	FILE *fp;
+	AmigaROMHashGenModule *module_table;
+	AmigaROMHashGenSimilarityKey *key_table;
+	size_t fingerprint_count, size_class_count, module_count, key_count;
+
+	if(!CountAmigaROMFingerprintTables(rom_list, slot_entries, &fingerprint_count, &size_class_count))
+	{
+		return false;
+	}
+
+	if(!BuildAmigaROMModuleTable(rom_list, &module_table, &module_count))
+	{
+		return false;
+	}
+	free(module_table);
+
+	if(!BuildAmigaROMSimilarityKeys(rom_list, &key_table, &key_count))
+	{
+		return false;
+	}
+	free(key_table);
+
+	fp = fopen(header_path, "w");
+	if(!fp)
+	{
+		fprintf(stderr, "ERROR: Unable to write header at: %s\n", header_path);
+		return false;
+	}
+
+	fprintf(fp, "%s\n", AMIGA_ROM_HASHES_LICENSE);
+	fprintf(fp, "// Generated by AmigaROMHashGen from AmigaROMHashes.txt.  Do not edit this\n");
+	fprintf(fp, "// file by hand; edit the list and run \"make hashes\" instead.\n\n");
+	fprintf(fp, "#ifndef AMIGAROMHASHES_H\n#define AMIGAROMHASHES_H\n\n");
+	fprintf(fp, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+	fprintf(fp, "#include <stddef.h>\n#include <stdint.h>\n\n");
+
+	fprintf(fp, "// Merkle fingerprint of a known ROM image, as built by\n");
+	fprintf(fp, "// CalculateAmigaROMMerkleTree() over AMIGA_ROM_MERKLE_LEAF_SIZE byte leaves,\n");
+	fprintf(fp, "// and the CalculateAmigaROMMinHash() signature of its leaves.\n");
+	fprintf(fp, "typedef struct {\n");
+	fprintf(fp, "\tconst uint8_t root[32];\n");
+	fprintf(fp, "\tconst uint32_t leaf_count;\n");
+	fprintf(fp, "\tconst uint8_t (*leaves)[32];\n");
+	fprintf(fp, "\tconst uint32_t minhash[%d];\n", AMIGA_ROM_MERKLE_MINHASH_SIZE);
+	fprintf(fp, "} AmigaROMMerkleInfo;\n\n");
+
+	fprintf(fp, "// A known ROM.  sha256_digest points into the packed digest column\n");
+	fprintf(fp, "// (AMIGA_ROM_DIGESTS, or a loaded database's) and version into a shared\n");
+	fprintf(fp, "// string pool, so digest lookups never touch these records.  For a layout\n");
+	fprintf(fp, "// of another known ROM (derived from its image at build time, or listed\n");
+	fprintf(fp, "// separately), canonical is that ROM and derived_view holds the\n");
+	fprintf(fp, "// AMIGA_ROM_VIEW_* bits from AmigaROMDigests.h saying which layout this is:\n");
+	fprintf(fp, "// undo the byte swap, or merge with the other half, to recover canonical.\n");
+	fprintf(fp, "// Otherwise canonical is NULL and derived_view is AMIGA_ROM_VIEW_NONE.\n");
+	fprintf(fp, "typedef struct AmigaROMInfo {\n");
+	fprintf(fp, "\tconst uint8_t *sha256_digest;\n");
+	fprintf(fp, "\tconst char *version;\n");
+	fprintf(fp, "\tconst uint32_t file_size;\n");
+	fprintf(fp, "\tconst char type;\n");
+	fprintf(fp, "\tconst int8_t byte_swap;\n");
+	fprintf(fp, "\tconst uint8_t derived_view;\n");
+	fprintf(fp, "\tconst AmigaROMMerkleInfo *merkle;\n");
+	fprintf(fp, "\tconst struct AmigaROMInfo *canonical;\n");
+	fprintf(fp, "} AmigaROMInfo;\n\n");
+
+	fprintf(fp, "// Structural fingerprint of a ROM image: raw big-endian words read straight\n");
+	fprintf(fp, "// from the file at offsets 0 (header), 12 (major and minor version),\n");
+	fprintf(fp, "// file_size - 24 (checksum) and file_size - 16 (footer), so byte swapped\n");
+	fprintf(fp, "// images fingerprint as stored.  rom_index is the entry in AMIGA_ROM_INFO.\n");
+	fprintf(fp, "typedef struct {\n");
+	fprintf(fp, "\tuint32_t file_size;\n");
+	fprintf(fp, "\tuint32_t header;\n");
+	fprintf(fp, "\tuint32_t version;\n");
+	fprintf(fp, "\tuint32_t checksum;\n");
+	fprintf(fp, "\tuint32_t footer;\n");
+	fprintf(fp, "\tuint32_t rom_index;\n");
+	fprintf(fp, "} AmigaROMFingerprint;\n\n");
+
+	fprintf(fp, "typedef struct {\n");
+	fprintf(fp, "\tconst uint32_t file_size;\n");
+	fprintf(fp, "\tconst uint32_t unfingerprinted_count;\n");
+	fprintf(fp, "} AmigaROMSizeClass;\n\n");
+
+	fprintf(fp, "// A resident module of a known ROM image, with the relocation independent\n");
+	fprintf(fp, "// hash ScanAmigaROMModules() in AmigaROMModules.h gives it, and the first\n");
+	fprintf(fp, "// known ROM it was found in.\n");
+	fprintf(fp, "typedef struct AmigaROMModuleInfo {\n");
+	fprintf(fp, "\tconst uint64_t hash;\n");
+	fprintf(fp, "\tconst char *name;\n");
+	fprintf(fp, "\tconst AmigaROMInfo *rom;\n");
+	fprintf(fp, "\tconst uint8_t version;\n");
+	fprintf(fp, "} AmigaROMModuleInfo;\n\n");
+
+	fprintf(fp, "// CRC32s of one AMIGA_ROM_EPROM_BANK_SIZE byte bank of the Hi (U34) and Lo\n");
+	fprintf(fp, "// (U35) EPROM halves of a known merged ROM, as\n");
+	fprintf(fp, "// CalculateAmigaROMBankChecksums() gives them.  rom_index is the entry in\n");
+	fprintf(fp, "// AMIGA_ROM_INFO.\n");
+	fprintf(fp, "typedef struct {\n");
+	fprintf(fp, "\tuint32_t rom_index;\n");
+	fprintf(fp, "\tuint32_t bank;\n");
+	fprintf(fp, "\tuint32_t hi_crc32;\n");
+	fprintf(fp, "\tuint32_t lo_crc32;\n");
+	fprintf(fp, "} AmigaROMBankChecksum;\n\n");
+
+	fprintf(fp, "// One band of the MinHash signature of a known ROM's Merkle leaves, as\n");
+	fprintf(fp, "// GetAmigaROMMinHashBandKey() gives it.  rom_index is the entry in\n");
+	fprintf(fp, "// AMIGA_ROM_INFO.\n");
+	fprintf(fp, "typedef struct {\n");
+	fprintf(fp, "\tconst uint64_t key;\n");
+	fprintf(fp, "\tconst uint32_t rom_index;\n");
+	fprintf(fp, "} AmigaROMSimilarityKey;\n\n");
+
+	fprintf(fp, "#define AMIGA_ROM_INFO_COUNT %zu\n", rom_list->entry_count);
+	fprintf(fp, "#define AMIGA_ROM_HASH_BUCKET_COUNT %zu\n", bucket_count);
+	fprintf(fp, "#define AMIGA_ROM_VERSION_STRINGS_SIZE %zu\n", GetAmigaROMVersionStringsSize(rom_list));
+	fprintf(fp, "#define AMIGA_ROM_FINGERPRINT_COUNT %zu\n", fingerprint_count);
+	fprintf(fp, "#define AMIGA_ROM_SIZE_CLASS_COUNT %zu\n", size_class_count);
+	fprintf(fp, "#define AMIGA_ROM_MODULE_COUNT %zu\n", module_count);
+	fprintf(fp, "#define AMIGA_ROM_SIMILARITY_KEY_COUNT %zu\n", key_count);
+	fprintf(fp, "#define AMIGA_ROM_BANK_CHECKSUM_COUNT %zu\n\n", CountAmigaROMBankChecksums(rom_list));
+
+	fprintf(fp, "// Defined once, in the generated AmigaROMHashes.c.\n\n");
+	fprintf(fp, "// Per-bucket seeds for the minimal perfect hash in AmigaROMHashSlot()\n");
+	fprintf(fp, "extern const uint32_t AMIGA_ROM_HASH_SEEDS[AMIGA_ROM_HASH_BUCKET_COUNT];\n\n");
+	fprintf(fp, "// SHA256 digests of the known ROMs, packed in perfect hash order: a digest\n");
+	fprintf(fp, "// can only ever be found at the index AmigaROMHashSlot() returns for it.\n");
+	fprintf(fp, "extern const uint8_t AMIGA_ROM_DIGESTS[AMIGA_ROM_INFO_COUNT][32];\n\n");
+	fprintf(fp, "// Null-terminated version strings, one after another\n");
+	fprintf(fp, "extern const char AMIGA_ROM_VERSION_STRINGS[AMIGA_ROM_VERSION_STRINGS_SIZE];\n\n");
+	fprintf(fp, "// Known ROMs, in the same order as AMIGA_ROM_DIGESTS\n");
+	fprintf(fp, "extern const AmigaROMInfo AMIGA_ROM_INFO[AMIGA_ROM_INFO_COUNT];\n\n");
+	fprintf(fp, "// Fingerprints of the known ROMs generated from an image, sorted by\n");
+	fprintf(fp, "// file_size, header, version, checksum and footer, plus a zeroed sentinel.\n");
+	fprintf(fp, "extern const AmigaROMFingerprint AMIGA_ROM_FINGERPRINTS[AMIGA_ROM_FINGERPRINT_COUNT + 1];\n\n");
+	fprintf(fp, "// Every known ROM size in ascending order, with the number of ROMs of that\n");
+	fprintf(fp, "// size which have no fingerprint and so can only be identified by digest.\n");
+	fprintf(fp, "extern const AmigaROMSizeClass AMIGA_ROM_SIZE_CLASSES[AMIGA_ROM_SIZE_CLASS_COUNT];\n\n");
+	fprintf(fp, "// Resident modules of the known ROMs generated from an image, sorted by\n");
+	fprintf(fp, "// hash, name and version, plus a zeroed sentinel.\n");
+	fprintf(fp, "extern const AmigaROMModuleInfo AMIGA_ROM_MODULES[AMIGA_ROM_MODULE_COUNT + 1];\n\n");
+	fprintf(fp, "// Every band key of every known ROM with Merkle leaves, sorted by key and\n");
+	fprintf(fp, "// then rom_index, plus a zeroed sentinel.  ROMs which share a key are\n");
+	fprintf(fp, "// candidates for being similar.\n");
+	fprintf(fp, "extern const AmigaROMSimilarityKey AMIGA_ROM_SIMILARITY_KEYS[AMIGA_ROM_SIMILARITY_KEY_COUNT + 1];\n\n");
+	fprintf(fp, "// EPROM bank checksums of the known merged ROMs generated from an image,\n");
+	fprintf(fp, "// sorted by rom_index and bank, plus a zeroed sentinel.\n");
+	fprintf(fp, "extern const AmigaROMBankChecksum AMIGA_ROM_BANK_CHECKSUMS[AMIGA_ROM_BANK_CHECKSUM_COUNT + 1];\n\n");
+
+	fprintf(fp, "// Returns the only index in a table of entry_count ROMs, laid out with the\n");
+	fprintf(fp, "// given bucket seeds, at which digest can appear.  The caller must still\n");
+	fprintf(fp, "// compare the digest stored there.  Binary database files use the same\n");
+	fprintf(fp, "// hash as AMIGA_ROM_DIGESTS and AMIGA_ROM_HASH_SEEDS.\n");
+	fprintf(fp, "static inline size_t AmigaROMHashSlot(const uint8_t *digest, const uint32_t *seeds, const size_t bucket_count, const size_t entry_count)\n");
+	fprintf(fp, "{\n");
+	fprintf(fp, "\tuint32_t bucket_key = (uint32_t)digest[0] | ((uint32_t)digest[1] << 8) | ((uint32_t)digest[2] << 16) | ((uint32_t)digest[3] << 24);\n");
+	fprintf(fp, "\tuint32_t slot_key = (uint32_t)digest[4] | ((uint32_t)digest[5] << 8) | ((uint32_t)digest[6] << 16) | ((uint32_t)digest[7] << 24);\n\n");
+	fprintf(fp, "\tslot_key ^= seeds[bucket_key %% bucket_count];\n");
+	fprintf(fp, "\tslot_key *= 0x9E3779B1u;\n");
+	fprintf(fp, "\tslot_key ^= slot_key >> 15;\n");
+	fprintf(fp, "\tslot_key *= 0x85EBCA77u;\n");
+	fprintf(fp, "\tslot_key ^= slot_key >> 13;\n\n");
+	fprintf(fp, "\treturn slot_key %% entry_count;\n");
+	fprintf(fp, "}\n\n");
+
+	fprintf(fp, "#ifdef __cplusplus\n}\n#endif\n\n#endif\n");
+
+	if(fclose(fp) != 0)
+	{
+		fprintf(stderr, "ERROR: Unable to write header at: %s\n", header_path);
+		return false;
+	}
+
+	return true;
+}
+
+// Writes the generated source defining every table, ordered by slot.
+// header_name is the name it includes the generated header by.
+bool WriteAmigaROMHashesSource(const char *source_path, const char *header_name, const AmigaROMHashGenList *rom_list, const uint32_t *seeds, size_t bucket_count, const AmigaROMHashGenEntry **slot_entries)
+{
+	FILE *fp;
+	const AmigaROMHashGenEntry *entry;
+	uint32_t minhash[AMIGA_ROM_MERKLE_MINHASH_SIZE];
+	size_t string_position;
+	size_t i, j;
+
+	fp = fopen(source_path, "w");
+	if(!fp)
+	{
+		fprintf(stderr, "ERROR: Unable to write source at: %s\n", source_path);
+		return false;
+	}
+
+	fprintf(fp, "%s\n", AMIGA_ROM_HASHES_LICENSE);
+	fprintf(fp, "// Generated by AmigaROMHashGen from AmigaROMHashes.txt.  Do not edit this\n");
+	fprintf(fp, "// file by hand; edit the list and run \"make hashes\" instead.\n\n");
+	fprintf(fp, "#include \"%s\"\n\n", header_name);
+	fprintf(fp, "#include <stddef.h>\n#include <stdint.h>\n\n");
+
+	fprintf(fp, "const uint32_t AMIGA_ROM_HASH_SEEDS[AMIGA_ROM_HASH_BUCKET_COUNT] = {");
+	for(i = 0; i < bucket_count; i++)
+	{
+		fprintf(fp, "%s%s%lu", (i == 0) ? "" : ",", (i % 12 == 0) ? "\n\t" : " ", (unsigned long)seeds[i]);
+	}
+	fprintf(fp, "\n};\n\n");
+
+	fprintf(fp, "const uint8_t AMIGA_ROM_DIGESTS[AMIGA_ROM_INFO_COUNT][32] = {\n");
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		fprintf(fp, "\t{");
+		WriteAmigaROMDigestBytes(fp, slot_entries[i]->sha256_digest);
+		fprintf(fp, "}%s\n", (i + 1 < rom_list->entry_count) ? "," : "");
+	}
+	fprintf(fp, "};\n\n");
+
+	fprintf(fp, "const char AMIGA_ROM_VERSION_STRINGS[AMIGA_ROM_VERSION_STRINGS_SIZE] = {\n");
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		WriteAmigaROMVersionChars(fp, slot_entries[i]->version);
+	}
+	fprintf(fp, "};\n\n");
+
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = slot_entries[i];
+		if(!(entry->merkle_tree.leaves))
+		{
+			continue;
+		}
+
+		fprintf(fp, "// %s\n", entry->version);
+		fprintf(fp, "static const uint8_t AMIGA_ROM_MERKLE_LEAVES_%zu[%zu][32] = {\n", i, entry->merkle_tree.leaf_count);
+		for(j = 0; j < entry->merkle_tree.leaf_count; j++)
+		{
+			fprintf(fp, "\t{");
+			WriteAmigaROMDigestBytes(fp, entry->merkle_tree.leaves[j]);
+			fprintf(fp, "}%s\n", (j + 1 < entry->merkle_tree.leaf_count) ? "," : "");
+		}
+		fprintf(fp, "};\n\n");
+
+		CalculateAmigaROMMinHash((const uint8_t (*)[32])entry->merkle_tree.leaves, entry->merkle_tree.leaf_count, minhash);
+
+		fprintf(fp, "static const AmigaROMMerkleInfo AMIGA_ROM_MERKLE_%zu = {{", i);
+		WriteAmigaROMDigestBytes(fp, entry->merkle_tree.root);
+		fprintf(fp, "}, %zu, AMIGA_ROM_MERKLE_LEAVES_%zu, {", entry->merkle_tree.leaf_count, i);
+		for(j = 0; j < AMIGA_ROM_MERKLE_MINHASH_SIZE; j++)
+		{
+			fprintf(fp, "%s%lu", (j == 0) ? "" : ", ", (unsigned long)minhash[j]);
+		}
+		fprintf(fp, "}};\n\n");
+	}
+
+	fprintf(fp, "const AmigaROMInfo AMIGA_ROM_INFO[AMIGA_ROM_INFO_COUNT] = {\n");
+	string_position = 0;
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = slot_entries[i];
+
+		fprintf(fp, "\t{AMIGA_ROM_DIGESTS[%zu], &AMIGA_ROM_VERSION_STRINGS[%zu], %zu, '%c', %d, 0x%02X, ", i, string_position, entry->file_size, entry->type, entry->byte_swap, entry->derived_view);
+		if(entry->merkle_tree.leaves)
+		{
+			fprintf(fp, "&AMIGA_ROM_MERKLE_%zu, ", i);
+		}
+		else
+		{
+			fprintf(fp, "NULL, ");
+		}
+
+		if(entry->derived_view != AMIGA_ROM_VIEW_NONE)
+		{
+			fprintf(fp, "&AMIGA_ROM_INFO[%zu]", rom_list->entries[entry->canonical_entry].slot);
+		}
+		else
+		{
+			fprintf(fp, "NULL");
+		}
+		fprintf(fp, "}%s // %s\n", (i + 1 < rom_list->entry_count) ? "," : "", entry->version);
+
+		string_position += strlen(entry->version) + 1;
+	}
+	fprintf(fp, "};\n\n");
+
+	if(!WriteAmigaROMFingerprints(fp, rom_list, slot_entries))
+	{
+		fclose(fp);
+		return false;
+	}
+
+	fprintf(fp, "\n");
+	if(!WriteAmigaROMModules(fp, rom_list))
+	{
+		fclose(fp);
+		return false;
+	}
+
+	fprintf(fp, "\n");
+	if(!WriteAmigaROMSimilarityKeys(fp, rom_list))
+	{
+		fclose(fp);
+		return false;
+	}
+
+	fprintf(fp, "\n");
+	WriteAmigaROMBankChecksums(fp, rom_list, slot_entries);
+
+	if(fclose(fp) != 0)
+	{
+		fprintf(stderr, "ERROR: Unable to write source at: %s\n", source_path);
+		return false;
+	}
+
+	return true;
+}
+
+static size_t AlignDatabaseOffset(const size_t offset)
+{
+	return (offset + AMIGA_ROM_DATABASE_ALIGNMENT - 1) & ~(size_t)(AMIGA_ROM_DATABASE_ALIGNMENT - 1);
+}
+
+static void PutLittleEndianWord(uint8_t *bytes, const size_t value)
+{
+	bytes[0] = (uint8_t)(value & 0xFF);
+	bytes[1] = (uint8_t)((value >> 8) & 0xFF);
+	bytes[2] = (uint8_t)((value >> 16) & 0xFF);
+	bytes[3] = (uint8_t)((value >> 24) & 0xFF);
+}
+
+// Writes the same tables as the generated source into a binary database file laid out
+// as described in AmigaROMDatabaseFormat.h.
+bool WriteAmigaROMDatabase(const char *database_path, const AmigaROMHashGenList *rom_list, const uint32_t *seeds, size_t bucket_count, const AmigaROMHashGenEntry **slot_entries)
+{
+	FILE *fp;
+	uint8_t *database;
+	uint8_t *record;
+	const AmigaROMHashGenEntry **sorted_entries;
+	const AmigaROMHashGenEntry *entry;
+	AmigaROMHashGenModule *module_table;
+	AmigaROMHashGenSimilarityKey *key_table;
+	uint32_t minhash[AMIGA_ROM_MERKLE_MINHASH_SIZE];
+	size_t fingerprint_count, size_class_count, unfingerprinted_count, module_count, key_count, bank_checksum_count;
+	size_t seeds_offset, digests_offset, entries_offset, fingerprints_offset, size_classes_offset, modules_offset, similarity_keys_offset, bank_checksums_offset;
+	size_t strings_offset, strings_size, merkle_offset, merkle_size, database_size;
+	size_t string_position, merkle_position;
+	size_t i, j;
+	bool result = true;
+
+	if(!CountAmigaROMFingerprintTables(rom_list, slot_entries, &fingerprint_count, &size_class_count))
+	{
+		return false;
+	}
+
+	if(!BuildAmigaROMModuleTable(rom_list, &module_table, &module_count))
+	{
+		return false;
+	}
+
+	if(!BuildAmigaROMSimilarityKeys(rom_list, &key_table, &key_count))
+	{
+		free(module_table);
+		return false;
+	}
+
+	sorted_entries = (const AmigaROMHashGenEntry**)malloc(rom_list->entry_count * sizeof(AmigaROMHashGenEntry*));
+	if(!sorted_entries)
+	{
+		fprintf(stderr, "ERROR: Out of memory writing the database.\n");
+		free(module_table);
+		free(key_table);
+		return false;
+	}
+
+	bank_checksum_count = CountAmigaROMBankChecksums(rom_list);
+
+	// Module names follow the version strings
+	strings_size = GetAmigaROMVersionStringsSize(rom_list);
+	for(i = 0; i < module_count; i++)
+	{
+		strings_size += strlen(module_table[i].module->name) + 1;
+	}
+
+	merkle_size = 0;
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		if(slot_entries[i]->merkle_tree.leaves)
+		{
+			merkle_size += ((slot_entries[i]->merkle_tree.leaf_count + 1) * 32) + (AMIGA_ROM_MERKLE_MINHASH_SIZE * 4);
+		}
+	}
+
+	seeds_offset = AMIGA_ROM_DATABASE_HEADER_SIZE;
+	digests_offset = AlignDatabaseOffset(seeds_offset + (bucket_count * 4));
+	entries_offset = AlignDatabaseOffset(digests_offset + (rom_list->entry_count * 32));
+	fingerprints_offset = AlignDatabaseOffset(entries_offset + (rom_list->entry_count * AMIGA_ROM_DATABASE_ENTRY_SIZE));
+	size_classes_offset = AlignDatabaseOffset(fingerprints_offset + (fingerprint_count * AMIGA_ROM_DATABASE_FINGERPRINT_SIZE));
+	modules_offset = AlignDatabaseOffset(size_classes_offset + (size_class_count * AMIGA_ROM_DATABASE_SIZE_CLASS_SIZE));
+	similarity_keys_offset = AlignDatabaseOffset(modules_offset + (module_count * AMIGA_ROM_DATABASE_MODULE_SIZE));
+	bank_checksums_offset = AlignDatabaseOffset(similarity_keys_offset + (key_count * AMIGA_ROM_DATABASE_SIMILARITY_KEY_SIZE));
+	strings_offset = AlignDatabaseOffset(bank_checksums_offset + (bank_checksum_count * AMIGA_ROM_DATABASE_BANK_CHECKSUM_SIZE));
+	merkle_offset = AlignDatabaseOffset(strings_offset + strings_size);
+	database_size = AlignDatabaseOffset(merkle_offset + merkle_size);
+
+	if(database_size > 0xFFFFFFFF)
+	{
+		fprintf(stderr, "ERROR: The database is too large.\n");
+		free(sorted_entries);
+		free(module_table);
+		free(key_table);
+		return false;
+	}
+
+	database = (uint8_t*)calloc(database_size, 1);
+	if(!database)
+	{
+		fprintf(stderr, "ERROR: Out of memory writing the database.\n");
+		free(sorted_entries);
+		free(module_table);
+		free(key_table);
+		return false;
+	}
+
+	memcpy(database, AMIGA_ROM_DATABASE_MAGIC, 8);
+	PutLittleEndianWord(&database[8], AMIGA_ROM_DATABASE_FORMAT_VERSION);
+	PutLittleEndianWord(&database[12], AMIGA_ROM_DATABASE_HEADER_SIZE);
+	PutLittleEndianWord(&database[16], database_size);
+	PutLittleEndianWord(&database[20], rom_list->entry_count);
+	PutLittleEndianWord(&database[24], bucket_count);
+	PutLittleEndianWord(&database[28], fingerprint_count);
+	PutLittleEndianWord(&database[32], size_class_count);
+	PutLittleEndianWord(&database[36], seeds_offset);
+	PutLittleEndianWord(&database[40], entries_offset);
+	PutLittleEndianWord(&database[44], fingerprints_offset);
+	PutLittleEndianWord(&database[48], size_classes_offset);
+	PutLittleEndianWord(&database[52], strings_offset);
+	PutLittleEndianWord(&database[56], strings_size);
+	PutLittleEndianWord(&database[60], merkle_offset);
+	PutLittleEndianWord(&database[64], merkle_size);
+	PutLittleEndianWord(&database[68], digests_offset);
+	PutLittleEndianWord(&database[72], module_count);
+	PutLittleEndianWord(&database[76], modules_offset);
+	PutLittleEndianWord(&database[80], key_count);
+	PutLittleEndianWord(&database[84], similarity_keys_offset);
+	PutLittleEndianWord(&database[88], bank_checksum_count);
+	PutLittleEndianWord(&database[92], bank_checksums_offset);
+
+	for(i = 0; i < bucket_count; i++)
+	{
+		PutLittleEndianWord(&database[seeds_offset + (i * 4)], seeds[i]);
+	}
+
+	string_position = 0;
+	merkle_position = 0;
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = slot_entries[i];
+		record = &database[entries_offset + (i * AMIGA_ROM_DATABASE_ENTRY_SIZE)];
+
+		memcpy(&database[digests_offset + (i * 32)], entry->sha256_digest, 32);
+		PutLittleEndianWord(&record[0], string_position);
+		PutLittleEndianWord(&record[4], entry->file_size);
+		record[8] = (uint8_t)entry->type;
+		record[9] = (uint8_t)entry->byte_swap;
+		record[10] = entry->derived_view;
+		PutLittleEndianWord(&record[20], (entry->derived_view != AMIGA_ROM_VIEW_NONE) ? rom_list->entries[entry->canonical_entry].slot : AMIGA_ROM_DATABASE_NO_CANONICAL);
+
+		memcpy(&database[strings_offset + string_position], entry->version, strlen(entry->version) + 1);
+		string_position += strlen(entry->version) + 1;
+
+		if(entry->merkle_tree.leaves)
+		{
+			PutLittleEndianWord(&record[12], merkle_position);
+			PutLittleEndianWord(&record[16], entry->merkle_tree.leaf_count);
+
+			CalculateAmigaROMMinHash((const uint8_t (*)[32])entry->merkle_tree.leaves, entry->merkle_tree.leaf_count, minhash);
+
+			memcpy(&database[merkle_offset + merkle_position], entry->merkle_tree.root, 32);
+			merkle_position += 32;
+			for(j = 0; j < AMIGA_ROM_MERKLE_MINHASH_SIZE; j++)
+			{
+				PutLittleEndianWord(&database[merkle_offset + merkle_position], minhash[j]);
+				merkle_position += 4;
+			}
+			memcpy(&database[merkle_offset + merkle_position], entry->merkle_tree.leaves, entry->merkle_tree.leaf_count * 32);
+			merkle_position += entry->merkle_tree.leaf_count * 32;
+		}
+	}
+
+	SortAmigaROMFingerprintEntries(rom_list, slot_entries, true, sorted_entries);
+	for(i = 0; i < fingerprint_count; i++)
+	{
+		entry = sorted_entries[i];
+		record = &database[fingerprints_offset + (i * AMIGA_ROM_DATABASE_FINGERPRINT_SIZE)];
+
+		PutLittleEndianWord(&record[0], entry->file_size);
+		PutLittleEndianWord(&record[4], entry->fingerprint[0]);
+		PutLittleEndianWord(&record[8], entry->fingerprint[1]);
+		PutLittleEndianWord(&record[12], entry->fingerprint[2]);
+		PutLittleEndianWord(&record[16], entry->fingerprint[3]);
+		PutLittleEndianWord(&record[20], entry->slot);
+	}
+
+	SortAmigaROMFingerprintEntries(rom_list, slot_entries, false, sorted_entries);
+	record = &database[size_classes_offset];
+	for(i = 0; i < rom_list->entry_count; i = j)
+	{
+		unfingerprinted_count = CountUnfingerprintedEntries(sorted_entries, rom_list->entry_count, i, &j);
+
+		PutLittleEndianWord(&record[0], sorted_entries[i]->file_size);
+		PutLittleEndianWord(&record[4], unfingerprinted_count);
+		record += AMIGA_ROM_DATABASE_SIZE_CLASS_SIZE;
+	}
+
+	free(sorted_entries);
+
+	for(i = 0; i < module_count; i++)
+	{
+		record = &database[modules_offset + (i * AMIGA_ROM_DATABASE_MODULE_SIZE)];
+
+		PutLittleEndianWord(&record[0], (size_t)(module_table[i].module->hash & 0xFFFFFFFF));
+		PutLittleEndianWord(&record[4], (size_t)(module_table[i].module->hash >> 32));
+		PutLittleEndianWord(&record[8], string_position);
+		PutLittleEndianWord(&record[12], module_table[i].entry->slot);
+		record[16] = module_table[i].module->version;
+
+		memcpy(&database[strings_offset + string_position], module_table[i].module->name, strlen(module_table[i].module->name) + 1);
+		string_position += strlen(module_table[i].module->name) + 1;
+	}
+
+	free(module_table);
+
+	for(i = 0; i < key_count; i++)
+	{
+		record = &database[similarity_keys_offset + (i * AMIGA_ROM_DATABASE_SIMILARITY_KEY_SIZE)];
+
+		PutLittleEndianWord(&record[0], (size_t)(key_table[i].key & 0xFFFFFFFF));
+		PutLittleEndianWord(&record[4], (size_t)(key_table[i].key >> 32));
+		PutLittleEndianWord(&record[8], key_table[i].slot);
+	}
+
+	free(key_table);
+
+	record = &database[bank_checksums_offset];
+	for(i = 0; i < rom_list->entry_count; i++)
+	{
+		entry = slot_entries[i];
+		for(j = 0; j < entry->bank_checksums.bank_count; j++)
+		{
+			PutLittleEndianWord(&record[0], i);
+			PutLittleEndianWord(&record[4], j);
+			PutLittleEndianWord(&record[8], entry->bank_checksums.hi_crc32[j]);
+			PutLittleEndianWord(&record[12], entry->bank_checksums.lo_crc32[j]);
+			record += AMIGA_ROM_DATABASE_BANK_CHECKSUM_SIZE;
+		}
+	}
+
+	fp = fopen(database_path, "wb");
+	if(!fp)
+	{
+		fprintf(stderr, "ERROR: Unable to write database at: %s\n", database_path);
+		free(database);
+		return false;
+	}
+
+	if(fwrite(database, 1, database_size, fp) != database_size)
+	{
+		result = false;
+	}
+
+	if(fclose(fp) != 0)
+	{
+		result = false;
+	}
+
+	if(!result)
+	{
+		fprintf(stderr, "ERROR: Unable to write database at: %s\n", database_path);
+	}
+
+	free(database);
+
+	return result;
+}
@@ -0,0 +1,700 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Generated by AmigaROMHashGen from AmigaROMHashes.txt.  Do not edit this
+// file by hand; edit the list and run "make hashes" instead.
+
+#include "AmigaROMHashes.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+const uint32_t AMIGA_ROM_HASH_SEEDS[AMIGA_ROM_HASH_BUCKET_COUNT] = {
+	1, 19, 0, 23, 69, 6, 1, 12, 269, 121, 1, 18,
+	0, 3, 76, 24, 333, 16, 239, 0, 2, 239, 0, 7,
+	158, 30, 43, 159, 201, 15, 0, 1285, 7, 523, 185, 76,
+	19, 403, 359, 102, 0, 9, 143, 187, 355, 2692, 138, 589,
+	120, 30, 4, 60, 44
+};
+
+const uint8_t AMIGA_ROM_DIGESTS[AMIGA_ROM_INFO_COUNT][32] = {
+	{0x6d,0x43,0x84,0x0d,0x40,0x99,0xa7,0x41,0x70,0xea,0x0f,0x04,0x25,0xb6,0x25,0x7c,0x38,0x91,0xeb,0xca,0xa3,0x9c,0x4d,0x18,0x40,0x07,0x5a,0x9a,0xb2,0x2b,0x57,0x07},
+	{0x86,0xa0,0xde,0x3a,0x6e,0x39,0x0f,0xe0,0x80,0x4e,0x8d,0x8e,0x3d,0x39,0x09,0x15,0x52,0xf3,0xf5,0x02,0x0d,0x8b,0xd4,0x98,0x9a,0x77,0xbb,0x99,0x6b,0xbc,0x50,0xb7},
+	{0x21,0xf9,0xf1,0x2e,0x50,0x58,0xdd,0x0f,0xca,0xc4,0xcf,0x83,0xfc,0x0b,0x92,0x7c,0x57,0xc5,0x7c,0xe8,0xeb,0x4d,0xab,0xa0,0x24,0x67,0xea,0x1a,0xd2,0xb6,0xcf,0x8e},
+	{0x87,0xcd,0xdb,0x1f,0x49,0x9e,0x32,0x75,0x8d,0xe2,0x01,0x45,0xe7,0x30,0x31,0xa8,0x4b,0xab,0x29,0x9e,0x3f,0x6e,0x5c,0x84,0x87,0xe7,0x6d,0x02,0xb2,0xee,0x9d,0x16},
+	{0xb4,0x7f,0x76,0x84,0xb0,0x17,0xc9,0xfc,0x8e,0x11,0x68,0x0f,0x85,0xe5,0xe4,0xee,0xdf,0x0b,0x4a,0xdc,0xb8,0x42,0x73,0xc9,0x34,0xfa,0xe4,0xe9,0xca,0xc6,0x42,0x05},
+	{0x51,0xa7,0xbc,0x2e,0x77,0x5a,0x97,0xb0,0x4c,0xb9,0xe1,0x23,0x64,0x10,0x95,0xf1,0xa2,0xd8,0x12,0x3a,0x5c,0xce,0x19,0xd6,0x70,0x37,0x88,0x6b,0xfe,0xa4,0x28,0xdf},
+	{0x09,0xe8,0x1c,0xd3,0xf5,0x54,0x08,0xeb,0x51,0x5f,0x0b,0x26,0xe8,0x12,0x13,0xff,0xcc,0x9c,0xe7,0x70,0x64,0x14,0x33,0x6f,0xab,0xe0,0xf8,0xc2,0x59,0x00,0x9c,0xef},
+	{0xe1,0x3f,0xcf,0xdb,0xc3,0xb6,0xff,0x82,0x9a,0xef,0x6f,0x49,0x11,0x07,0xee,0xfe,0x73,0xe0,0x4d,0x39,0x8d,0x8f,0xa2,0x0d,0xb7,0x35,0xe2,0x89,0x20,0xd5,0x22,0x70},
+	{0xc9,0x07,0x52,0x52,0xba,0x66,0x8c,0xd2,0x0e,0x28,0x3e,0xb4,0x94,0x9a,0xf7,0xbf,0xd2,0x80,0xc6,0xf2,0x55,0x10,0x6c,0xac,0x8c,0x9b,0xb8,0xb2,0x40,0xfa,0x41,0x9f},
+	{0x71,0x33,0x17,0x69,0x04,0x1b,0x3d,0x9e,0xb9,0x46,0xf3,0xc0,0x0d,0xe5,0xb2,0x39,0xf6,0x9b,0x64,0x19,0x5a,0xe3,0x1e,0x22,0x60,0x78,0xcd,0xa5,0xf0,0x37,0xec,0x73},
+	{0x9b,0x68,0x3f,0x83,0x18,0xf6,0x12,0x86,0x0b,0xec,0xcc,0xab,0x96,0x5e,0x41,0xf2,0x79,0x39,0x6b,0x92,0x7a,0x1d,0x62,0x4c,0xf6,0xf4,0x1e,0x9f,0xcc,0xa8,0x37,0xf4},
+	{0x7b,0x40,0xfe,0x2e,0x48,0xa2,0x4a,0x4d,0x3a,0x6f,0x3f,0x89,0x77,0x40,0xc7,0x86,0xf7,0x06,0xfd,0x4d,0x2c,0xb8,0x55,0x89,0x95,0x79,0x30,0xce,0xd8,0x30,0xd0,0x8b},
+	{0x4d,0x4f,0x2a,0xac,0x98,0x6f,0x0f,0xfa,0x8d,0xa2,0xba,0x23,0xc7,0xda,0x3d,0x53,0x1a,0x88,0x00,0x27,0xec,0xf3,0x6a,0x63,0xae,0x48,0x35,0x2c,0x9c,0xdf,0xd9,0xb4},
+	{0x6a,0x89,0x20,0x43,0x59,0x7f,0xa2,0xe2,0x2e,0x57,0xf3,0x77,0x7d,0x3f,0xad,0x46,0xb6,0x66,0x2c,0x92,0x06,0xbc,0xb7,0x15,0x57,0x99,0x71,0xda,0x09,0xf9,0x20,0xf2},
+	{0x8d,0x57,0xd6,0xe9,0xd9,0x76,0xdf,0x42,0xd9,0x1f,0xf9,0xd1,0x0a,0x5e,0xed,0xae,0xde,0x1a,0x00,0xe3,0xb4,0xb3,0x4c,0xad,0x75,0x0c,0xa5,0xff,0x72,0x29,0xf2,0x8a},
+	{0x77,0x7d,0xda,0x55,0x72,0x88,0x28,0xa2,0x4e,0x1e,0x84,0x56,0x0a,0xdd,0xbe,0x74,0xc1,0xf7,0x2d,0x39,0xc3,0xbe,0x99,0xe5,0xf4,0x43,0xe1,0xb3,0x93,0x74,0x0b,0xd0},
+	{0xca,0x46,0xd9,0x1c,0x45,0xa9,0xa4,0xf1,0xb3,0x29,0xb1,0xde,0x26,0xd1,0xfa,0x6a,0x3b,0x3d,0x1f,0xfc,0x0d,0x41,0x7a,0xa2,0xd4,0x73,0x76,0xc4,0x04,0xf0,0x5d,0xa6},
+	{0xf7,0x97,0xdb,0x0b,0x99,0x85,0x6d,0x9c,0x82,0x19,0xee,0x1f,0x11,0xe1,0x62,0x85,0xfd,0x7d,0xbd,0xc0,0xcb,0xca,0x2e,0x14,0x9b,0xef,0xd3,0xa3,0x98,0x6e,0xb0,0x07},
+	{0xc2,0x06,0xf1,0x4c,0x20,0xbe,0x3c,0xee,0xfc,0x68,0x9c,0x38,0xf9,0x24,0x5c,0xdd,0xa8,0xfd,0xd4,0x45,0x8c,0xd8,0x03,0x4a,0x41,0x89,0x09,0x2f,0x91,0x98,0xbe,0x0d},
+	{0x6d,0x4c,0xe7,0x48,0xd6,0x69,0xab,0x4b,0x98,0x19,0x55,0x81,0x5d,0x46,0x76,0x20,0x34,0x72,0x58,0xb9,0xec,0x0e,0xe2,0xbc,0xcb,0x42,0x8c,0x3a,0x47,0x4c,0xef,0xc8},
+	{0x0e,0xa0,0x94,0x3d,0x93,0xa6,0xfd,0xb5,0x6a,0xb5,0xda,0x42,0x98,0xbe,0xee,0x84,0x63,0xf1,0xbb,0x11,0xd3,0x72,0x1a,0xc0,0x6e,0x62,0x1a,0x2d,0xed,0x20,0xed,0xb1},
+	{0xd9,0x64,0x82,0x64,0x32,0x55,0x99,0x94,0xff,0xe3,0x29,0xf6,0x43,0xfd,0x4e,0x42,0xdb,0xbf,0xf3,0x13,0x36,0x2d,0x94,0x34,0x94,0x57,0x25,0xd7,0x11,0x9c,0xae,0x87},
+	{0xa3,0xfa,0x47,0x27,0xd5,0xee,0x3e,0x1c,0x1d,0x65,0x8c,0x41,0xbb,0x4d,0x45,0x2d,0xec,0x79,0x98,0x56,0x30,0xda,0x52,0xbc,0x52,0x64,0x84,0xc1,0x29,0x70,0x3a,0xc2},
+	{0xb6,0x9d,0x0e,0xa7,0xa5,0x3d,0xd4,0xa7,0x57,0x07,0x11,0x5d,0xe4,0x48,0xbe,0x9d,0x66,0xa0,0x24,0x78,0xe9,0x8f,0x71,0x36,0xcf,0xaa,0xd3,0x92,0x11,0x48,0xd8,0x95},
+	{0x38,0xca,0x27,0x79,0x6b,0xa9,0xc3,0xed,0xb4,0x60,0x1f,0xd4,0xb3,0xc5,0x89,0x65,0x50,0x4c,0x09,0x28,0x69,0x75,0xb4,0x59,0x3d,0xa6,0x9a,0xd1,0xd4,0x23,0xc3,0x44},
+	{0x87,0x9a,0x7b,0x2d,0xc9,0x73,0x5f,0xd6,0x28,0xdc,0x0c,0x52,0xe8,0xd9,0x7f,0xb3,0x07,0x13,0xfa,0x52,0xa6,0xd9,0x08,0x56,0x11,0x36,0x10,0xc2,0xea,0x93,0x6e,0x14},
+	{0xc1,0xa7,0x9a,0x2f,0x46,0x7a,0xe5,0x99,0xdf,0x89,0x41,0x36,0x20,0x04,0xa2,0x58,0x0a,0x0c,0x6f,0x0d,0xac,0xe2,0x8c,0x1e,0x2c,0x74,0xb4,0x72,0x16,0x2a,0xb1,0xc8},
+	{0xa3,0xaf,0x35,0x10,0x87,0x3e,0x4e,0x5b,0xcf,0x9c,0x9d,0xf8,0x71,0xa7,0x89,0x9a,0x6e,0xf6,0x33,0x5b,0xb1,0x0f,0xd3,0x97,0xad,0xac,0xd5,0xf8,0x4c,0x50,0xec,0x04},
+	{0x18,0x4b,0xde,0x33,0xf2,0x3b,0xf9,0x1d,0xe3,0x4d,0x72,0xa0,0xba,0x07,0x41,0xf9,0x33,0x87,0x29,0xbd,0xb2,0xd6,0xbe,0xa4,0x4f,0x31,0x7a,0xf6,0x2f,0x39,0x7d,0x51},
+	{0x21,0xb6,0x31,0x58,0xae,0xd2,0xf1,0xaa,0x65,0xc2,0xf4,0xf6,0x95,0x0a,0x5e,0x9d,0x5c,0x26,0x0d,0xe2,0x24,0x96,0xb7,0x71,0x84,0x66,0x9c,0xa8,0x09,0x49,0x97,0x70},
+	{0xba,0x5b,0x08,0xc5,0xc4,0x1b,0x0a,0x80,0x53,0x10,0x95,0x76,0x48,0x38,0xc8,0x50,0xda,0xa5,0x26,0xf0,0x65,0x1e,0x9f,0xb0,0x43,0x25,0x56,0x89,0xa4,0xab,0xb4,0x64},
+	{0x0a,0x19,0xcc,0x57,0xbb,0xff,0xd5,0x23,0x74,0xda,0x97,0xa4,0x2c,0x38,0x70,0xe0,0x3d,0x55,0x29,0xaa,0x71,0x23,0x47,0xd4,0x47,0xf5,0x3f,0xa6,0x88,0xed,0x5f,0x9f},
+	{0xf0,0x8f,0x9c,0x90,0x5f,0x23,0xa0,0xa5,0x3a,0x1c,0xd6,0x9f,0x72,0xab,0x04,0xe0,0xcc,0x48,0xed,0x83,0xbe,0xe2,0x19,0x1a,0xd6,0x39,0x61,0x6e,0x87,0x76,0x96,0x7f},
+	{0x0e,0x59,0x13,0x6a,0x7b,0xa0,0x59,0xf9,0x74,0xf0,0x62,0x6b,0x9b,0x98,0x66,0x86,0x43,0xd2,0xa0,0xe3,0xf5,0x45,0x10,0x92,0xc9,0xf2,0x5f,0xd7,0x32,0x93,0xfb,0xbe},
+	{0x35,0x86,0x35,0x55,0x14,0x94,0x7b,0x5a,0xb4,0x8c,0x87,0x55,0xdc,0x00,0x4f,0xab,0x94,0xf1,0x88,0xb1,0x9e,0x7b,0xce,0x49,0x1c,0x8f,0x96,0x93,0x49,0x9e,0x83,0x0b},
+	{0x5d,0x97,0xb7,0x89,0xe4,0x6b,0x1d,0xf1,0xc8,0xb9,0x35,0x4f,0x36,0x3e,0xb0,0x7f,0x54,0x2b,0xc6,0x18,0xf7,0x9f,0xb4,0xce,0x4b,0xfb,0xfb,0x93,0xe4,0x48,0xdd,0x85},
+	{0xae,0xff,0x7d,0xea,0x66,0xba,0x1d,0xc5,0x2f,0x1b,0x03,0x7d,0xd0,0x90,0x46,0x08,0x4b,0xaa,0x6c,0xff,0xe9,0x7e,0x83,0xf6,0xdb,0x00,0x05,0x85,0xd4,0x8d,0x4b,0xb8},
+	{0xd5,0xc6,0xce,0x79,0xf0,0x96,0xa2,0x40,0x86,0xd2,0xd7,0x3b,0xfc,0x76,0xf1,0x1d,0xaa,0x82,0x86,0xa6,0x6f,0x75,0xc0,0x20,0xf6,0xaa,0xcb,0x14,0xc9,0x00,0x84,0x36},
+	{0xe8,0x4e,0x75,0x64,0x94,0xdf,0x38,0x9e,0x72,0x3d,0x97,0xb6,0x6f,0x17,0x6e,0xef,0x40,0xda,0x20,0x5c,0x4d,0xef,0x7d,0x1f,0xb0,0xe1,0x14,0x9c,0x6e,0xe0,0x67,0xeb},
+	{0xdb,0x82,0xfd,0xaf,0xde,0xbf,0x50,0x1f,0x69,0x42,0x83,0xd4,0x93,0xf0,0x55,0xcb,0xc4,0x11,0xb7,0x58,0x6b,0xd1,0x14,0xe9,0x61,0x92,0xc6,0x68,0x74,0x46,0xa3,0x52},
+	{0x03,0x46,0xea,0x67,0x4f,0x20,0x5b,0x64,0x24,0x86,0x63,0xec,0x5d,0x58,0xa8,0xec,0x50,0xae,0x8a,0x8b,0xc2,0x3a,0xbb,0x1c,0xc6,0x52,0xb9,0xf3,0xe3,0x67,0xfb,0xd5},
+	{0x37,0x5f,0x4a,0x60,0x9d,0x99,0xaa,0x14,0x2b,0xcc,0xc5,0xe5,0x21,0xf1,0x74,0xaa,0x53,0xba,0x7f,0x7d,0xce,0xc4,0xa7,0xed,0x12,0xc3,0x80,0xe0,0xb9,0xd0,0x84,0xdd},
+	{0xf2,0xc9,0x30,0x7a,0xac,0xb9,0x2b,0x20,0x3a,0x31,0x35,0xa3,0x51,0x85,0xde,0xff,0xad,0x6c,0x66,0xcf,0xa8,0xd7,0x99,0x20,0xb2,0x35,0xd7,0xcf,0x9a,0x52,0x22,0xc4},
+	{0xe8,0xa2,0xfc,0x00,0xec,0x2b,0xa3,0xb2,0x74,0x11,0x2d,0xd9,0xb3,0x2f,0x6d,0xf8,0xd2,0x85,0x82,0x9c,0x32,0x54,0xe0,0x83,0xcf,0x44,0x84,0x74,0xe4,0x6a,0x54,0x65},
+	{0x56,0x3f,0x94,0x8a,0xf1,0x9c,0x09,0xda,0xed,0x1f,0x06,0xb8,0x76,0x02,0x21,0xff,0x4b,0x27,0x89,0xc1,0x69,0x0c,0xdc,0xfb,0xce,0x2c,0x94,0x11,0x57,0xaf,0x23,0xd1},
+	{0x15,0x1f,0x19,0x84,0xfa,0x56,0x7a,0x18,0x3d,0x76,0x13,0x78,0xaf,0x80,0x50,0xe3,0x5c,0xd8,0x69,0x4b,0x16,0x9c,0xff,0x2b,0xcb,0x49,0xdd,0x53,0x9e,0xb0,0xf8,0x6d},
+	{0x01,0x19,0x59,0xb1,0x4b,0x57,0xc6,0x18,0xdd,0x49,0x90,0x18,0xb5,0x41,0xc3,0x98,0x22,0x91,0xdd,0xca,0xe6,0x18,0xae,0x74,0x9a,0xa5,0x5c,0x86,0x7e,0x06,0x8b,0xd8},
+	{0xe2,0x06,0xbb,0x45,0x80,0xff,0xe5,0x2d,0x04,0x04,0x56,0x32,0x09,0x93,0x9c,0xfd,0x5d,0xe9,0x65,0xba,0xf5,0xe8,0xfe,0x61,0xf7,0x34,0x90,0x22,0x84,0x97,0xba,0xad},
+	{0xd6,0x87,0x79,0xb4,0xc9,0x96,0x2d,0xc8,0x0e,0xd5,0x7c,0xdb,0xa8,0xbc,0xe3,0xbd,0x89,0xdb,0x57,0x5f,0xba,0xbb,0x8d,0x3a,0xa3,0xe9,0x14,0xb8,0x42,0x4a,0xdd,0x7b},
+	{0x36,0x67,0x8e,0x75,0x20,0x1e,0xe9,0x66,0x17,0x2d,0x02,0x37,0x2c,0xc3,0x15,0x40,0xe0,0xda,0xd6,0x4f,0x86,0xae,0x32,0x8f,0x47,0x21,0x04,0x6a,0x33,0xac,0x92,0xcd},
+	{0x67,0x3a,0x12,0x3c,0xd2,0xef,0xec,0xc9,0x44,0xbf,0x24,0x2b,0x66,0x93,0x78,0x18,0x6a,0x26,0x0e,0x0f,0xcf,0x7b,0x06,0xec,0x7e,0xb8,0x40,0xd7,0xb0,0x36,0x2d,0x69},
+	{0xe6,0x68,0x23,0xf4,0xba,0xaf,0x2c,0x93,0xea,0x6a,0xc6,0x00,0xc0,0x70,0x14,0xcc,0xdd,0xad,0xc4,0x4c,0xc5,0x82,0x81,0xc5,0x64,0xba,0xf1,0x65,0xe2,0x03,0x5b,0x47},
+	{0x00,0xaa,0xde,0x66,0x62,0x0d,0x0b,0x18,0x85,0xaa,0x05,0x4e,0xbe,0xdf,0x6b,0x41,0x42,0x20,0xe0,0x21,0x9e,0x98,0xee,0xe7,0x7c,0x2b,0x0d,0x80,0x5d,0xec,0x04,0x2c},
+	{0x1b,0x44,0x2c,0x77,0x6e,0x45,0x4c,0x76,0x70,0xd3,0x7c,0xb5,0xff,0x22,0x93,0x0d,0x17,0xff,0xc4,0xa7,0x15,0x9f,0xff,0xfc,0x74,0x8d,0x43,0x25,0xeb,0xb9,0x9a,0x60},
+	{0xeb,0x35,0xe4,0x34,0xc9,0x73,0x41,0xa8,0xef,0xd5,0xe4,0x50,0xf0,0xef,0xda,0x33,0x89,0xa4,0x59,0xd9,0x32,0x68,0xfc,0x49,0x88,0x6b,0x02,0x1d,0xf2,0x92,0xe9,0x19},
+	{0xca,0x52,0x08,0x1b,0xe6,0x80,0x9a,0x9e,0xc3,0x44,0x90,0x8c,0x73,0x81,0x09,0xd7,0x9d,0xbf,0x34,0x1e,0x20,0xa7,0x16,0x9a,0x29,0xb5,0xa3,0x4f,0x15,0x0c,0x08,0xb3},
+	{0x2e,0x23,0x60,0x55,0x88,0x92,0x86,0x8e,0xc5,0xd3,0x36,0xf5,0xdc,0x27,0xa8,0x14,0xb9,0xe3,0xbb,0x7f,0x7f,0x01,0xc8,0xf0,0xe5,0x78,0x5a,0x4c,0xba,0xac,0x7d,0xc9},
+	{0xe2,0xa9,0x3d,0x34,0x50,0x8a,0xb8,0xb1,0xf9,0x23,0xb1,0x60,0xa0,0x47,0x80,0x33,0x81,0x6a,0xeb,0xdf,0xa4,0xcd,0x5e,0x75,0xaf,0x64,0xe2,0x32,0x38,0xfe,0x6d,0x47},
+	{0x08,0xd5,0x64,0xe7,0x82,0x97,0x2b,0x59,0xe1,0x6d,0xb0,0x13,0x04,0x91,0x17,0xf9,0xc7,0x3a,0x65,0x0d,0x94,0x6a,0x52,0xd2,0xab,0xe7,0x36,0xf2,0x7e,0x47,0x13,0xd7},
+	{0xa1,0xd3,0x74,0xe9,0x47,0x32,0xe8,0x0d,0x9c,0x83,0xab,0xc0,0xcf,0xa4,0xd7,0xd9,0xed,0x05,0x0d,0x08,0xeb,0x89,0x9f,0x01,0xa8,0xd5,0x1f,0x23,0xcb,0x3f,0x85,0x78},
+	{0x68,0x0e,0x65,0x48,0x80,0xc8,0x91,0xa3,0xb0,0x3e,0x61,0x07,0xed,0x30,0xb1,0x09,0x03,0xef,0xca,0x16,0xc1,0xda,0xc1,0xb4,0xc8,0xe7,0x83,0x5f,0x4e,0x37,0xac,0xb6},
+	{0x82,0x84,0xeb,0x47,0xb0,0x07,0x9a,0x78,0xe1,0xd7,0xf7,0x77,0x11,0x1f,0x61,0xe4,0x6e,0xff,0x23,0x3b,0x45,0xf0,0x25,0x9a,0xc1,0xd3,0xf1,0xe5,0xee,0x86,0x22,0x93},
+	{0x01,0x10,0xb8,0x56,0x67,0x85,0xb2,0x3b,0x43,0x99,0xc9,0x44,0x15,0x2a,0x94,0x50,0x6e,0x07,0x62,0xb4,0x33,0x31,0x26,0xae,0x76,0x35,0x80,0x28,0xd5,0xff,0x78,0xd8},
+	{0xba,0xd9,0xea,0xe2,0x1d,0x4b,0x8c,0xd4,0x77,0xe1,0xb4,0xd1,0x74,0xd1,0x0b,0x19,0x5c,0x8c,0x37,0x1a,0x26,0x90,0xd5,0x65,0xd0,0x4e,0x60,0x56,0xdc,0x86,0x23,0x99},
+	{0x2f,0x48,0xc3,0x99,0x17,0x48,0xf4,0xd8,0x12,0xf1,0xc0,0xd1,0x3a,0x99,0x58,0x1c,0xc1,0x7a,0x05,0x82,0x61,0xd7,0x38,0x56,0xae,0xe9,0xba,0xfd,0xa2,0xd0,0x7f,0xee},
+	{0xe0,0x5c,0x2a,0x50,0xed,0xef,0xe2,0x16,0x55,0xc2,0x29,0x95,0x50,0xfe,0xb9,0x0c,0x9d,0xab,0xa2,0xbd,0x93,0xda,0xae,0x55,0xad,0x1e,0x89,0x21,0x12,0x9e,0x51,0x87},
+	{0xd3,0xe8,0x27,0x28,0x56,0x13,0x89,0xf5,0xb0,0x8e,0x37,0x26,0x54,0xac,0x93,0x0a,0x23,0x91,0xe2,0x84,0xe2,0x53,0x22,0x7e,0x7f,0xc5,0x29,0x55,0x50,0x87,0x08,0xd3},
+	{0xa3,0x0e,0xc8,0xc1,0x69,0x70,0x82,0xb0,0x4e,0x4a,0x7b,0xa6,0xb1,0x3a,0x1c,0xc4,0xb2,0x6c,0x98,0x71,0xe3,0x32,0x27,0x8c,0x87,0xcc,0xb1,0xb1,0x9b,0x4c,0x9e,0x51},
+	{0xfb,0xa6,0x77,0x6f,0x9a,0x0a,0x39,0x18,0xde,0x47,0x18,0x08,0xd9,0xfc,0x2d,0xda,0x57,0x69,0x52,0xfe,0x2a,0x8f,0x5d,0x6d,0x9b,0x68,0x64,0x12,0xea,0x20,0x96,0xf8},
+	{0x99,0x04,0x61,0xca,0xfb,0xbb,0x99,0x05,0x04,0xb2,0x5f,0x20,0xdd,0x42,0xa5,0xfc,0xb0,0x7d,0xe9,0x6f,0xdd,0x5e,0x51,0xd1,0x0c,0x36,0xea,0x12,0xb4,0x6c,0x7c,0xb8},
+	{0xa3,0xf7,0x5c,0x79,0x58,0xd0,0xd0,0xb0,0x58,0x2f,0xde,0xc5,0x1f,0x49,0xa1,0x31,0x5a,0xf9,0x99,0x32,0x18,0x5b,0x59,0x4b,0x03,0x20,0x83,0x32,0x9f,0xbb,0xd8,0x40},
+	{0x86,0xbf,0x24,0x70,0xe6,0x79,0xcb,0x4c,0x7d,0x9e,0x0c,0x4b,0x93,0xbd,0x4d,0xfe,0xbb,0x6d,0x28,0x6e,0x49,0x57,0x7e,0x20,0x83,0x8e,0xb8,0x17,0xa2,0x6b,0x29,0x88},
+	{0x0b,0x17,0xe1,0x39,0x9b,0x6b,0xa9,0xf7,0x1e,0x13,0xf0,0x2a,0x7f,0x11,0xdd,0x34,0xeb,0xfa,0x0c,0xa1,0x6e,0x21,0xa5,0xb8,0xaf,0xb5,0x10,0x3e,0xa0,0x05,0x8c,0x54},
+	{0x05,0xff,0x54,0x67,0x05,0x86,0x22,0xeb,0xcb,0x4f,0x1e,0xb8,0x70,0x93,0x97,0x9f,0x5d,0x7c,0xcd,0x6e,0x1c,0x4b,0x2b,0x38,0x4d,0x78,0xd5,0x26,0x66,0xa7,0xeb,0xfa},
+	{0x41,0x18,0x77,0x32,0xf4,0x08,0x56,0xf1,0x97,0xbd,0xcd,0xbb,0xe3,0xda,0x93,0x95,0xc6,0xa4,0xdc,0x15,0x67,0xd4,0x25,0xb5,0x2f,0x07,0x57,0x7b,0xb7,0x13,0x85,0xd4},
+	{0x27,0xdd,0xaf,0x0a,0x46,0x0e,0x2e,0xe8,0x59,0x35,0x13,0x9c,0xba,0xc1,0xdf,0x23,0x4c,0x28,0x3b,0x39,0x79,0xc5,0x05,0x26,0xd1,0x18,0xe9,0xa5,0x5c,0x61,0x10,0x0a},
+	{0x14,0xe8,0x4e,0xe1,0xb1,0x5c,0x07,0x3c,0x21,0xbf,0x22,0x61,0xa7,0xc4,0x52,0x3e,0xda,0xa1,0x62,0x70,0x96,0x8b,0x45,0x39,0x8d,0x54,0x04,0x50,0x4c,0x90,0xc0,0x6b},
+	{0x83,0x6f,0xf0,0x2a,0xae,0x5f,0xe4,0x96,0xf0,0xb1,0x74,0xa1,0xc8,0x5e,0xff,0x37,0xab,0x72,0x8c,0x58,0x10,0x02,0x62,0x14,0xb4,0xb9,0xa2,0x1b,0xc1,0x20,0x81,0xc0},
+	{0xdb,0x39,0x37,0x5d,0xa4,0xe0,0xc6,0xf4,0xd7,0xa7,0x6c,0xdf,0xba,0xac,0xf8,0xbc,0xea,0x07,0x07,0x6a,0xf0,0xad,0x7e,0xab,0x54,0x5a,0x2e,0x18,0xa3,0xb6,0x3c,0xb7},
+	{0x2a,0x7d,0x0f,0xa9,0x3e,0xbb,0x40,0x84,0x03,0x8c,0x82,0x48,0x6d,0xa3,0xad,0x72,0x46,0x7a,0x59,0x2a,0x4b,0x65,0xf0,0x67,0x5a,0x38,0xe7,0xcc,0xd8,0x4c,0x71,0x28},
+	{0x63,0xd9,0x93,0xac,0xd4,0x8f,0xe7,0x3e,0xa0,0xec,0x7f,0x2e,0x90,0x15,0x3c,0x72,0xa1,0xa9,0x26,0xa6,0x34,0x1e,0x67,0x78,0x45,0xfe,0x82,0xec,0xce,0x8d,0x6a,0x18},
+	{0xbe,0xe1,0x4d,0xf8,0x80,0x50,0x76,0x09,0x9e,0xc8,0x4e,0x1a,0x78,0x1d,0x55,0x13,0x7f,0x7f,0x99,0x3d,0x36,0xb5,0xfa,0x4a,0x01,0x29,0xb6,0x40,0xee,0x50,0xb9,0xf1},
+	{0x5e,0xa7,0x74,0xc6,0x92,0x6e,0x2a,0xef,0xd2,0x00,0xff,0x03,0x28,0x17,0xc5,0xc7,0x98,0x79,0x47,0x98,0x37,0x1e,0xf8,0xad,0x4b,0x8d,0x6b,0x98,0x74,0xb5,0xaa,0x0d},
+	{0x44,0x02,0xd9,0x0c,0x0a,0xb5,0xba,0xa3,0x25,0xc8,0xca,0xa7,0x82,0x42,0x78,0x30,0x0e,0x69,0xb9,0xec,0x09,0x05,0xd2,0x4d,0x9f,0xe3,0xb7,0x59,0x96,0x5f,0x56,0xc7},
+	{0x89,0xeb,0x27,0xcb,0x5a,0xfd,0x8e,0xb9,0x38,0x6f,0xd0,0x0b,0x05,0x09,0x27,0x6f,0x05,0xbf,0x54,0x5b,0x77,0x0c,0x36,0xe4,0x17,0x2d,0x3f,0x2a,0xe6,0x9d,0xec,0xad},
+	{0xe5,0xf8,0x7e,0xa8,0x95,0x3d,0x84,0x0d,0xb0,0xe0,0x5d,0x09,0x73,0x62,0xad,0x1b,0xe9,0x8a,0x1b,0xf3,0x29,0x2c,0xf7,0xf3,0x59,0x19,0x0a,0xf6,0x15,0x56,0xd0,0x36},
+	{0x2d,0x69,0x74,0x5a,0x43,0xa3,0x32,0x33,0xb9,0x68,0xba,0x93,0xbd,0x3d,0xc8,0xc7,0x24,0xfe,0xf5,0xf3,0xcd,0x42,0x2b,0x76,0xb5,0x4a,0x7d,0xc9,0x20,0x6a,0xfe,0xa9},
+	{0xc4,0xe8,0x2c,0xd0,0xa5,0xb6,0x5c,0x2b,0x66,0x68,0x38,0xd1,0x2e,0x66,0xef,0xb9,0x05,0xd3,0x85,0xc1,0x3c,0x03,0xf6,0x8d,0x16,0xc6,0xe9,0xd9,0x95,0x68,0x7a,0x34},
+	{0x2a,0xe9,0xfc,0x90,0xfd,0xf0,0x19,0xe7,0xe1,0x50,0x06,0xd9,0xca,0xd6,0x3d,0x02,0x68,0xed,0x7b,0x21,0x44,0xeb,0xf9,0x7e,0xd9,0x98,0xce,0x06,0xda,0x3b,0xde,0xc5},
+	{0x35,0xac,0xee,0x27,0xd5,0xc7,0x41,0x0e,0xf0,0xa5,0x7a,0x89,0x11,0xcd,0x4e,0xae,0xd4,0xfd,0xd7,0xee,0xf8,0x5b,0x29,0xed,0x67,0x4b,0xcc,0x59,0x0a,0xa2,0x76,0xdf},
+	{0xf7,0xa8,0x27,0xe9,0x41,0xdc,0xee,0xf4,0xef,0x6a,0xee,0xee,0x75,0x5e,0x35,0xcf,0x6d,0xf0,0xb5,0x8f,0xb9,0x87,0x84,0x6b,0x9d,0xea,0x80,0x9b,0xfc,0xc3,0x96,0xd0},
+	{0xac,0xe7,0xe0,0x4e,0x1e,0x6e,0xa4,0x9f,0x03,0x14,0x81,0x5a,0x0a,0x42,0xb1,0xa3,0xa9,0x0a,0x0f,0xe0,0xc0,0xaf,0xe8,0xc3,0x2c,0x2a,0xde,0x80,0x08,0x11,0x15,0x88},
+	{0x71,0xd0,0xdc,0x2e,0xe2,0x18,0x71,0x9e,0xd2,0x41,0x94,0x6a,0x94,0x3d,0x59,0xa6,0x39,0x19,0x52,0x2b,0x7c,0xea,0xbc,0xcd,0x7c,0xe5,0x54,0x1f,0xec,0x9d,0x6a,0x23},
+	{0x21,0xc2,0xe0,0xe4,0x07,0xa6,0x84,0xbd,0xa3,0x40,0x38,0xbe,0xf8,0x55,0xd9,0xd3,0xe8,0x7d,0xc6,0x6c,0x7f,0xa6,0xad,0xd3,0x95,0x7c,0x7d,0x3a,0xf7,0x51,0xf2,0xd1},
+	{0xf9,0xec,0xde,0x32,0x7f,0x55,0xa2,0x41,0x2e,0x81,0x67,0xa3,0xd2,0x63,0xa0,0x00,0x04,0xab,0x12,0xc4,0x62,0x60,0x5f,0x29,0x27,0x04,0x44,0xb4,0xaa,0x55,0x62,0x65},
+	{0x25,0x23,0x06,0xbc,0x00,0x16,0x30,0x05,0x51,0x8a,0xf9,0x79,0x20,0x20,0xe3,0x77,0x5c,0xe6,0x60,0x83,0x5b,0x20,0xfb,0xd7,0x26,0x29,0x6e,0xfd,0x4d,0x9a,0x65,0x70},
+	{0x22,0x8c,0xb8,0x07,0x1a,0x8d,0xff,0x68,0xdc,0x91,0x12,0x3a,0x28,0xd6,0xae,0x2d,0xb5,0xd7,0xdc,0x15,0xe6,0x6b,0xe8,0xd6,0x4b,0x59,0xf4,0x60,0x5d,0xe5,0x06,0xe3},
+	{0x93,0x3e,0x90,0x1f,0xc7,0x54,0x6a,0xc6,0xa4,0xe5,0xa5,0xe0,0xb4,0xad,0x73,0x0d,0x53,0x61,0x09,0xfc,0x9b,0x08,0x33,0x8b,0x81,0x88,0x35,0xe2,0xbe,0x8f,0xe1,0x5f},
+	{0x13,0xfe,0x2e,0x53,0x8a,0xa8,0xa3,0xaf,0x6c,0xd6,0x64,0x10,0xf6,0x00,0x04,0x99,0xc6,0x4d,0x37,0x53,0xf7,0x59,0x59,0x84,0x39,0xa0,0xe1,0xa7,0x60,0x04,0x56,0x04},
+	{0x96,0xe4,0x28,0x03,0xe2,0x2a,0x5b,0x05,0x67,0x4e,0x5f,0x3a,0xda,0x3c,0x39,0x3b,0x2e,0xd7,0xc2,0x47,0x47,0xdb,0x21,0x4c,0x22,0x7a,0x2e,0xc5,0x08,0x61,0x69,0x16},
+	{0x6f,0xf0,0xec,0xe4,0x06,0x8c,0x26,0xee,0x7d,0x43,0x46,0xc2,0x49,0x14,0x3f,0x95,0x9b,0x57,0x0d,0x2b,0x3a,0x4e,0xcd,0xf9,0x6d,0xbb,0x01,0x12,0x84,0xfb,0xd6,0x94},
+	{0xb1,0x78,0xe6,0x70,0x03,0x0d,0x5e,0x9b,0x27,0x0d,0x43,0xfc,0xa7,0x24,0xd5,0x18,0x69,0xff,0x09,0xfb,0x21,0x18,0x59,0xc8,0x73,0x95,0xd0,0xf6,0xd7,0x39,0x85,0x60},
+	{0x88,0x6d,0xc0,0xbc,0x60,0x89,0xd8,0x8e,0xd7,0x65,0x97,0xdc,0x07,0xdd,0x23,0x8f,0x6b,0xde,0x9d,0x09,0xd6,0x5e,0x94,0x23,0xd3,0x79,0x5a,0xe2,0x98,0x9f,0x1d,0xee},
+	{0x4a,0xcc,0x21,0x6e,0xfa,0x6d,0xbe,0xe7,0x62,0x5c,0x60,0x75,0xb4,0x04,0x46,0x22,0x7d,0x31,0xf4,0xf7,0x8e,0xfa,0x3d,0xaf,0x45,0x42,0x0e,0xb0,0x2e,0xf7,0x79,0xcf},
+	{0xe6,0x35,0xcc,0x7a,0x73,0x7d,0x67,0x2e,0x67,0xc0,0x3f,0x8b,0x58,0x52,0x7e,0x59,0x70,0x4a,0x5c,0xfe,0x87,0xbe,0x1f,0xbc,0xa6,0xae,0xf0,0x1a,0xd5,0x52,0xfc,0xcd},
+	{0x2a,0xc6,0xec,0x57,0x7e,0xb8,0x73,0x09,0x1a,0xe2,0x23,0xc1,0x31,0xaf,0x99,0xac,0xaa,0x1c,0xb8,0xa5,0xfc,0xfd,0xd1,0xe7,0x10,0x77,0xf2,0x6a,0x44,0xc2,0x17,0xad},
+	{0x10,0x61,0xcc,0xca,0xbc,0xcd,0x56,0x15,0xae,0x1c,0x79,0xde,0x17,0xf2,0x28,0xc2,0xf6,0xd3,0x92,0x97,0x30,0x16,0x01,0xe8,0xb8,0x7c,0xd2,0xe0,0xe5,0x15,0x6c,0x91},
+	{0x5b,0x72,0x19,0x2a,0x22,0xd1,0x0f,0x3e,0xae,0x7c,0xf8,0xb6,0x14,0x6d,0x28,0x91,0x65,0xfa,0x72,0xdd,0x0f,0xab,0xb0,0x32,0xe1,0x15,0xf0,0x10,0xfd,0x6e,0xa3,0xd5},
+	{0x5c,0x8c,0xb5,0x0b,0x7e,0x44,0xca,0x75,0x9d,0xb0,0x16,0x8d,0xc2,0x5c,0xea,0x4a,0x90,0xbd,0x7c,0x2f,0xb2,0xdc,0x14,0xb1,0xec,0xb6,0x7b,0x7c,0x6d,0x87,0x67,0xce},
+	{0xa8,0xab,0xb7,0xf1,0xe8,0xe2,0x7d,0x1f,0x6c,0x65,0x50,0x0b,0x35,0x47,0xa3,0x40,0x32,0x88,0x8e,0x0e,0xc5,0xbd,0x76,0xb9,0x65,0x39,0x2f,0x17,0x90,0x9e,0x7c,0xb2},
+	{0x68,0xf9,0xd3,0xa3,0x6c,0x28,0x66,0xd0,0x54,0xf4,0x1c,0x29,0xb6,0x00,0x61,0x86,0x42,0xa4,0x80,0x7d,0xfb,0x6b,0xca,0x73,0x54,0xd4,0x87,0x9a,0x36,0xc9,0xaa,0x7c},
+	{0x39,0x13,0xea,0x41,0x24,0xcc,0x1d,0x0b,0x24,0xbc,0xa3,0xe9,0xd7,0xb6,0xf8,0xfd,0x59,0x35,0xf4,0x1d,0x8d,0xcf,0xb1,0x77,0x81,0xc1,0xca,0x09,0x42,0x4c,0xf1,0x20},
+	{0x99,0x2b,0x5e,0x04,0x3b,0x46,0xed,0x81,0xbf,0x72,0x53,0x6a,0x5e,0xe7,0xf2,0x8d,0x91,0x8b,0x05,0x21,0x9b,0x07,0xe7,0xfd,0x92,0xe2,0xdf,0x0f,0xac,0x70,0x3e,0xfb},
+	{0x14,0xf8,0xf8,0xe6,0x9e,0x30,0xc0,0x7c,0x0a,0xd7,0x80,0x12,0x4f,0x2d,0x64,0x04,0xe4,0x23,0xbf,0x27,0x59,0xb9,0x3c,0x4a,0x8e,0xaa,0xe7,0xe7,0x99,0xab,0x8e,0x8c},
+	{0xee,0x56,0xaf,0x80,0x2e,0x82,0x84,0xfa,0x18,0xbd,0xf8,0xe5,0x00,0x9a,0x9d,0xea,0xb4,0x92,0x40,0x91,0xf4,0xca,0xd5,0xc0,0xa6,0x88,0x6c,0x45,0xb6,0x65,0xc4,0x22},
+	{0x09,0x3a,0xfb,0x8b,0x5a,0x3d,0xd2,0x87,0x40,0x15,0xcd,0x81,0x31,0xaf,0xcb,0xde,0x4b,0xf0,0x39,0x63,0x33,0xd1,0x6c,0x28,0xcc,0x7b,0x04,0x04,0x67,0x4b,0xbc,0xc2},
+	{0xd9,0xaa,0x68,0xb4,0x41,0xb6,0x6d,0x38,0x97,0x11,0x54,0xa9,0x32,0xce,0x78,0xa0,0x8e,0x90,0xbf,0xae,0xc6,0xd9,0x56,0x85,0x5b,0x44,0x3d,0xf0,0xd3,0x12,0xa3,0xbf},
+	{0x16,0xef,0xfa,0x14,0xe3,0x48,0x55,0x52,0x4d,0xf6,0xd0,0xd0,0x53,0xdb,0x3b,0xee,0x14,0xfd,0x97,0xde,0x5f,0x61,0x25,0xd2,0x5e,0x55,0x58,0xf6,0x20,0xba,0xaa,0x14},
+	{0xcb,0x1a,0x8e,0x9a,0x23,0x65,0x78,0xcb,0x12,0xaf,0xb6,0xa0,0xf8,0x45,0x59,0x40,0x6e,0x7d,0xb6,0x58,0x56,0x75,0x83,0x0d,0x51,0x73,0x76,0x2a,0xac,0xb2,0xdf,0x8e},
+	{0xc5,0xe0,0x83,0xdb,0xae,0xe0,0x97,0x3a,0x61,0xf8,0x1a,0xa0,0x3e,0x35,0x47,0x52,0xfd,0xc8,0xd5,0xe3,0x4d,0xa8,0xde,0x96,0x51,0x76,0x38,0xba,0xcc,0x60,0x4e,0x05},
+	{0xb3,0x5a,0x90,0x73,0xb0,0x1f,0x58,0xe1,0xbb,0xc6,0xb4,0x21,0x57,0x8c,0x01,0xb0,0x02,0x3b,0xbf,0x01,0xed,0xa5,0x0f,0x01,0x84,0x7d,0x6f,0xe5,0xaa,0x9c,0xc6,0x5a},
+	{0xec,0x20,0xb6,0x24,0xc2,0x62,0x5d,0xbd,0x61,0xbe,0x24,0x57,0x24,0x57,0x0a,0xc6,0x4b,0x5d,0x10,0x6e,0xd0,0xb9,0x79,0x98,0xb0,0x35,0x5e,0x1b,0x4d,0xc1,0x18,0x8d},
+	{0xbc,0xe3,0x36,0x12,0x36,0x58,0xc0,0x50,0xc9,0x7f,0xdd,0xfb,0x6a,0x1a,0xfe,0x2a,0x95,0x6c,0x29,0x6c,0x5a,0x84,0x07,0xb0,0x4f,0x0c,0x89,0x1a,0xba,0x5d,0x30,0xe0},
+	{0x33,0x9d,0xee,0xba,0xb6,0x2f,0x77,0x27,0x75,0xd7,0xaf,0xb2,0x7b,0xd5,0x0d,0xbb,0x56,0x39,0x14,0x80,0xc9,0x11,0x11,0x4c,0x72,0xb0,0xa0,0x67,0x09,0x18,0x1c,0xa4},
+	{0xe2,0xf0,0xad,0xd8,0xb1,0x0b,0x7a,0xc9,0x8c,0x40,0x68,0x3b,0x5e,0x54,0xae,0x97,0x64,0x2e,0x8c,0x7e,0x4c,0x38,0xbb,0x92,0xd5,0x05,0xda,0xc3,0x56,0xe6,0x9d,0xac},
+	{0x74,0x6a,0x66,0xdb,0xa5,0x7f,0x45,0x00,0xa5,0x4e,0x2c,0x46,0x37,0xe1,0xa8,0xfb,0x2c,0x82,0x79,0xf1,0x56,0xcb,0x23,0x1b,0x35,0xf0,0xd7,0xd1,0x3e,0x50,0x3c,0xcc},
+	{0x8c,0x8a,0x0c,0xf0,0x4f,0x91,0xb8,0x8e,0xaf,0x0c,0x4f,0x11,0x26,0x04,0x19,0x87,0x06,0x7e,0x22,0x86,0xa8,0xee,0x59,0x0b,0xdb,0xae,0x44,0x7a,0x80,0x00,0xc5,0xee},
+	{0x2a,0x13,0x55,0x27,0x6d,0x04,0x75,0x7c,0x58,0x48,0x42,0x96,0xb6,0x02,0x87,0x4b,0xfa,0x94,0x9a,0xb4,0xc6,0x86,0x58,0xe9,0xf2,0x98,0x3d,0xfd,0xbc,0x98,0xa7,0xfc},
+	{0xae,0x79,0x1d,0xea,0xe4,0xfe,0x01,0x2c,0x76,0x2b,0xaa,0x90,0xcb,0xa1,0xfc,0x61,0xa9,0x53,0x76,0xbf,0x16,0x9a,0x4d,0xb4,0xfa,0x6c,0x9c,0xb6,0x5c,0x02,0x19,0x2d},
+	{0xff,0xcf,0x69,0x93,0xc1,0xa2,0xdf,0x03,0x2f,0xee,0x11,0x25,0x03,0x6e,0x21,0x92,0xcf,0x29,0xf7,0x0a,0xdd,0x54,0x7a,0x50,0xfc,0x2c,0xff,0xf8,0xf4,0xfb,0x9f,0x7a},
+	{0xc5,0xa2,0x01,0xac,0xed,0x1b,0x3a,0x4b,0x2c,0xb5,0x0a,0x83,0xad,0xe8,0x04,0xac,0xeb,0xf4,0x8e,0x2a,0xe8,0x60,0x62,0xf2,0x2c,0x53,0x5f,0x76,0x3d,0xb2,0x4d,0x36},
+	{0xd4,0x0c,0x59,0x06,0xc8,0xbf,0x05,0x0e,0x12,0x1b,0x3d,0x4f,0x53,0xe7,0xa6,0x96,0xc2,0x36,0x42,0x52,0x30,0x32,0xcc,0x5e,0x27,0xe6,0xdd,0xcb,0x18,0xda,0x43,0x00},
+	{0x39,0xe8,0x8e,0x7a,0xcc,0x9e,0x19,0x80,0x6b,0xa6,0x18,0x17,0xd7,0x50,0xa2,0x26,0x79,0xdc,0x10,0xab,0x9b,0xea,0xda,0xde,0xd0,0x82,0x87,0x24,0x7d,0x2a,0xe7,0x21},
+	{0x6e,0x48,0xbb,0x76,0x85,0x39,0xe8,0xda,0xe3,0x52,0x55,0x3e,0x5f,0xdf,0xa8,0x60,0x68,0x2e,0xda,0xf9,0xe2,0x6b,0x10,0x5f,0xad,0xd8,0xe2,0x61,0x03,0x17,0x17,0x65},
+	{0xe7,0x2e,0x2f,0xe5,0xaa,0x48,0x87,0x26,0x9b,0x36,0x05,0x06,0x6d,0x1c,0xe7,0x4a,0x91,0x5c,0xcf,0x6c,0xb0,0x7a,0x3d,0x8a,0x50,0x66,0xaf,0x87,0xb0,0x82,0x61,0xc4},
+	{0x6f,0xe5,0xe7,0xfe,0xba,0x9b,0x0a,0x17,0xd2,0xdb,0xed,0xe4,0xa2,0x15,0x9b,0x9b,0x8e,0xb2,0x26,0x8d,0x6a,0xf4,0x34,0x54,0xe3,0x20,0x4d,0xec,0x3b,0xdd,0x00,0x6c},
+	{0x6e,0x8e,0xa1,0xbd,0x87,0x8b,0xf1,0xf6,0xc5,0x88,0xa7,0x36,0x6d,0x08,0xac,0xa0,0x0c,0x9a,0x25,0x70,0x5d,0x86,0x85,0xae,0x29,0x98,0x3b,0xb6,0x44,0x40,0x38,0x46},
+	{0x02,0xee,0x8f,0x14,0x6c,0x84,0x34,0x3a,0x33,0x09,0x59,0x38,0x5b,0x05,0xbf,0xe4,0xa0,0xaf,0xb9,0x86,0x72,0xb3,0xb1,0x87,0x24,0x39,0x43,0x5c,0xa6,0xfa,0xbf,0x75},
+	{0x92,0x2f,0xfb,0x2d,0x3d,0xdb,0xc0,0xb8,0xef,0x89,0xd8,0xdd,0xea,0xdb,0x1a,0x5a,0x68,0x9c,0x72,0x36,0xc9,0xb5,0xef,0x79,0x93,0xb3,0xdd,0x9f,0x50,0xe9,0xb3,0xec},
+	{0xd0,0xb7,0x0e,0x8a,0x17,0x72,0x61,0x4b,0x89,0x7f,0x92,0xc3,0x3c,0xb2,0x99,0xbe,0xd3,0xfc,0x8e,0x3d,0xe4,0x88,0xfc,0x12,0xf6,0x7f,0x97,0xfc,0x24,0x86,0xeb,0x79},
+	{0x13,0xd9,0xaa,0xdd,0x2b,0x97,0xdc,0x7d,0xcd,0x66,0xd2,0x0b,0xaf,0x51,0xa8,0x33,0x82,0x88,0x56,0x6e,0x30,0xb4,0x2f,0xdc,0xde,0x16,0xbf,0xfc,0x30,0x77,0x24,0xd0},
+	{0x67,0xd8,0x34,0xce,0x9d,0x49,0x59,0xe1,0x71,0x6d,0x3d,0x83,0xb2,0x7e,0x5c,0x3a,0xcb,0xa0,0x89,0x6e,0x9b,0x25,0x38,0xea,0x20,0x5f,0xc1,0x68,0x1e,0xdf,0x6b,0x88},
+	{0x84,0xdd,0x96,0x3b,0x7d,0x92,0x0b,0xf1,0xc0,0x3e,0x24,0xd2,0x7d,0x9b,0xdb,0x8f,0xda,0xa4,0xd9,0xf2,0x8b,0xf5,0x01,0x5c,0x39,0xa0,0x8f,0xec,0xc3,0x88,0xad,0x28},
+	{0xd8,0x41,0x40,0x99,0x4c,0x7a,0x88,0xdf,0xf7,0x23,0x91,0x77,0xdf,0x40,0xe2,0xbf,0xa5,0x1e,0xa1,0x7d,0xf7,0x67,0xba,0x7b,0x48,0x38,0x83,0xe9,0x1d,0x75,0x3e,0xf9},
+	{0xaf,0xb3,0xbd,0xf7,0x62,0xe4,0x61,0x82,0x54,0x0c,0x80,0x99,0x06,0xad,0x08,0xdf,0x5b,0x5c,0x10,0x5d,0x03,0x1f,0xf8,0x29,0x87,0xaf,0x6b,0x8a,0x16,0xce,0xcd,0xa7},
+	{0x2b,0x6f,0xbf,0xbc,0x9f,0x43,0xad,0x62,0x51,0x7d,0x0f,0x37,0xe9,0xa5,0xd9,0xa6,0xa5,0xe0,0x4d,0xd7,0x1a,0xee,0xcd,0x55,0x6c,0x2f,0x60,0x3c,0x64,0x37,0xbe,0x1b},
+	{0xfa,0xfb,0x34,0x9f,0x61,0x37,0xea,0xac,0x97,0xaa,0x54,0xce,0xf2,0x25,0x12,0x47,0xd1,0x77,0x0b,0x8d,0xa9,0x0b,0x41,0x26,0x66,0x82,0xcf,0x6a,0x82,0xfb,0xe3,0xec},
+	{0x71,0x18,0xdc,0xb9,0x86,0x23,0x00,0x14,0x51,0x45,0x6a,0x5f,0x97,0xf4,0x39,0xc8,0xdd,0x04,0x98,0xd7,0xf3,0x21,0xbd,0x47,0x3e,0x83,0xba,0xf0,0x34,0x4c,0xf1,0x7a},
+	{0xcc,0x74,0x0e,0x4e,0x22,0xa9,0xec,0xa7,0x16,0xd8,0x6b,0xdb,0xd5,0x0f,0x32,0xe3,0x0f,0x61,0x40,0x08,0x72,0xcd,0x8e,0xc3,0xcd,0x0d,0x0c,0xa0,0x09,0xb1,0x7b,0x39},
+	{0xb2,0xe2,0xfd,0x60,0x02,0x06,0x90,0x94,0xf6,0x50,0xcd,0xd7,0x05,0xb3,0xf1,0xec,0xc7,0x2d,0xfd,0x34,0x55,0x18,0xc3,0x47,0x0f,0x67,0x75,0xe1,0xc1,0x7d,0xff,0xda},
+	{0x91,0xd0,0xc2,0x4d,0x13,0x28,0x61,0xdd,0x74,0x86,0xaf,0x43,0x7e,0x7c,0xae,0x38,0xeb,0x1e,0x28,0x07,0x73,0x30,0x85,0x8f,0x8a,0x43,0xb2,0x18,0xd3,0xfd,0xa7,0x4d},
+	{0xf8,0xa4,0x92,0x08,0x30,0xf0,0xc9,0x35,0x70,0xb5,0x5d,0x56,0x2f,0x6e,0x26,0x1d,0x43,0x1d,0x28,0xc5,0xa4,0xeb,0x37,0x75,0xac,0x34,0x70,0x88,0x45,0x3d,0x39,0xd9},
+	{0xfb,0x5f,0x32,0x32,0x81,0x3d,0xc1,0x32,0xd5,0xbe,0xfb,0x94,0xe2,0x1c,0x35,0xdc,0xb6,0x40,0x6a,0x88,0x35,0x0e,0x6f,0x25,0xe5,0x5e,0x54,0xa8,0xe4,0x63,0x6d,0xaa},
+	{0x93,0x8b,0xc1,0x60,0x2c,0xbe,0x50,0x38,0xf0,0x69,0xfd,0xdd,0xde,0xee,0x9d,0x6f,0x8f,0x65,0x2d,0x91,0x63,0x68,0x5d,0x62,0x0b,0xf6,0x65,0x1d,0x00,0x0c,0xc6,0x5e},
+	{0x29,0x3b,0xee,0xa5,0x9d,0x7d,0xe4,0xca,0xab,0x3e,0x07,0x22,0x3d,0x66,0xe8,0x44,0xad,0x52,0x68,0xeb,0x06,0xa0,0x4f,0x40,0x5b,0x52,0x3a,0x0a,0x15,0x43,0xd6,0x4c},
+	{0x9b,0x2a,0x1c,0xc0,0x49,0xbb,0xef,0x20,0xfd,0x36,0x52,0x56,0xab,0x69,0xaa,0x7e,0x52,0x5a,0xdc,0x3a,0xe3,0x8e,0xe3,0x83,0x09,0xb0,0x03,0x66,0x9f,0x3f,0x4b,0x11},
+	{0x5a,0x74,0x8b,0x91,0xb6,0x27,0x31,0x70,0x72,0x27,0x82,0xf9,0xb0,0x97,0x89,0xb0,0xc6,0xdb,0xe4,0x6b,0x4d,0x60,0xcc,0x23,0xff,0x2e,0x15,0xae,0x59,0x72,0xe4,0xf3},
+	{0xea,0xfa,0xbe,0x0a,0xf2,0x58,0x80,0xcf,0x21,0xd0,0xc8,0x00,0xc6,0xab,0x12,0xe3,0x9d,0x7e,0x87,0x0c,0xe1,0x37,0x0a,0xb8,0x8a,0x22,0x57,0x2f,0xf5,0x68,0xaf,0x74},
+	{0x3c,0x6d,0x26,0xcf,0x5c,0x62,0x01,0xca,0xf8,0xe1,0xfd,0x31,0x09,0x1b,0x96,0x6a,0x89,0x16,0xa2,0x8e,0x4d,0xea,0x2e,0x2f,0x27,0xb8,0xbe,0x96,0x61,0xb9,0xb8,0x09},
+	{0xba,0x8f,0xa6,0x29,0xb4,0x5f,0x59,0x46,0x26,0x5a,0xad,0xc8,0x00,0x16,0x4c,0xed,0x85,0x96,0xcf,0xff,0xfa,0x54,0x2e,0xbe,0x33,0x16,0x6e,0xd4,0xe9,0x42,0xe8,0x30},
+	{0x93,0x77,0xb5,0x2b,0xae,0x07,0x0a,0xf8,0x7c,0xcd,0xe4,0x91,0xa4,0x8b,0x3c,0x11,0xa7,0x8a,0x7f,0x2c,0x08,0x2e,0xba,0x3a,0x4c,0x10,0x11,0x03,0xf6,0x09,0xda,0xda},
+	{0xd6,0xcb,0x3e,0x07,0x75,0x9f,0x48,0xf5,0xb1,0x37,0x5f,0xa2,0xc8,0x19,0x50,0xac,0xd3,0x66,0x29,0x84,0xb7,0xfc,0xf9,0x26,0x41,0x17,0xbb,0x41,0xde,0xb1,0xc6,0x0b},
+	{0xee,0x05,0x86,0x2d,0x81,0x02,0xa0,0x84,0x36,0xac,0x40,0x56,0xda,0x7d,0x54,0x9d,0xb3,0x16,0x25,0xc7,0xd4,0x7b,0x24,0xdf,0xb7,0xb3,0xc9,0xa5,0xc1,0x13,0xca,0x53},
+	{0x64,0xbd,0x1c,0xbe,0x95,0x67,0x08,0x82,0x96,0xd8,0x32,0xbe,0xda,0x5f,0x0a,0x46,0xec,0x58,0xe4,0xbe,0x6e,0xbc,0x6e,0x13,0x89,0xe4,0xd0,0x7c,0x5e,0xc3,0x43,0xbf},
+	{0x84,0xe4,0x68,0xdc,0x6f,0xdc,0x04,0xf3,0x58,0x40,0x08,0xb5,0xac,0x77,0x0c,0xe9,0x7c,0x1e,0x5e,0x6b,0x57,0xa1,0xc6,0x1d,0x24,0xda,0x3a,0xd6,0x1a,0xce,0xc0,0x81},
+	{0xa4,0xac,0x48,0x63,0x88,0x58,0x89,0x95,0xd8,0xf3,0xa6,0x9a,0x0d,0x83,0x00,0xd8,0xfa,0xca,0x10,0x26,0x21,0x2c,0x18,0x2f,0xb8,0xb7,0x5b,0xdf,0x7f,0x34,0x4c,0x83},
+	{0x4d,0xc3,0x62,0x3d,0xe8,0x40,0x15,0xbb,0x25,0x4f,0xb3,0x56,0xf8,0x42,0x9e,0x35,0x92,0x46,0xea,0xcd,0x18,0x85,0xe3,0x21,0xca,0x45,0x20,0xb0,0xa5,0x26,0x8f,0x31},
+	{0xaf,0x25,0x40,0x71,0xf1,0x22,0xbf,0xab,0xf8,0xaf,0x9d,0x8b,0xe1,0x3b,0x2a,0xe6,0x0d,0x44,0xcd,0x33,0x3c,0xfe,0x8b,0x58,0x0d,0x57,0x08,0x32,0xa7,0xe3,0xa8,0x97},
+	{0x50,0xb1,0x7f,0x15,0xe3,0xfa,0xb1,0xda,0x82,0xef,0x3e,0x42,0xe1,0x3c,0xc1,0xad,0xe2,0xcc,0x4f,0xb4,0xe3,0x2a,0x16,0xc7,0xb3,0x1b,0xab,0x41,0xc2,0x58,0x38,0x41},
+	{0xb2,0x0b,0x65,0xc0,0xaa,0x10,0xfe,0x85,0x0d,0x37,0x6e,0x29,0xcb,0xad,0x72,0x74,0x62,0x67,0xeb,0x05,0x58,0x88,0xc2,0x7a,0x2d,0x5b,0x37,0xf5,0xd6,0x75,0xa2,0x7b},
+	{0xb8,0x59,0xd9,0xfb,0x3d,0x86,0x8a,0x83,0x28,0xa4,0xa3,0x63,0xd4,0x49,0x34,0xeb,0x1e,0xe1,0xc7,0x39,0x55,0xaa,0x98,0x57,0x6c,0x7f,0xfe,0x3f,0xee,0xd3,0xd3,0xff},
+	{0x82,0x53,0xe4,0x63,0xf1,0x88,0x19,0x73,0x59,0xec,0xa9,0xa9,0xdd,0x07,0x2b,0xdc,0xeb,0xa5,0x63,0x09,0xf8,0x56,0x88,0xf5,0xd5,0xd5,0x09,0x9c,0xfe,0x8d,0xb8,0x58},
+	{0xb6,0x65,0xa6,0xd1,0xc0,0xa2,0x81,0xdc,0x1f,0x1c,0xe5,0x86,0x7e,0x4c,0x4d,0x14,0xb1,0xb5,0x57,0x1a,0xb3,0xb3,0x92,0xbd,0x36,0xeb,0x0f,0x7d,0x7e,0xc8,0x01,0x75},
+	{0x9e,0xcb,0x8c,0x80,0x70,0xe3,0x5c,0x4c,0xe0,0xf3,0xb6,0x56,0x7b,0x59,0x94,0xbd,0x08,0x2d,0xb1,0xe0,0xd0,0xf0,0xe1,0x7c,0x25,0x9d,0x1b,0x36,0xc4,0x7a,0x6b,0x62},
+	{0x24,0x90,0x0b,0x6b,0xa5,0x48,0x13,0x27,0x6f,0x72,0xdd,0xab,0x5f,0x25,0xa0,0xe5,0x21,0xed,0x0b,0x12,0x6c,0xdb,0xfe,0x05,0x8f,0x41,0xf2,0xdb,0x23,0x01,0x46,0x2e},
+	{0x98,0x3e,0x8d,0xda,0xa9,0xab,0x6a,0x4b,0xac,0x17,0xd3,0x76,0x89,0x4f,0xea,0xbe,0xaf,0x05,0x95,0x75,0x26,0x4b,0x4a,0x45,0xb9,0x82,0x72,0x2e,0x96,0x12,0xe9,0x47},
+	{0x59,0xe7,0xdf,0x32,0x7a,0x7a,0x68,0x0e,0x4f,0x2f,0x18,0x5e,0x17,0x16,0x1e,0x32,0x57,0xbf,0x41,0x24,0x79,0x11,0xf3,0x4d,0xdf,0x65,0x64,0x39,0x96,0x45,0xd7,0x03},
+	{0x99,0x02,0x72,0xa0,0xe5,0x3a,0xcc,0xc5,0xcd,0xe6,0x98,0x92,0x10,0xaf,0x0f,0x0b,0xd4,0x0e,0x42,0x89,0x46,0xc2,0xc7,0x69,0xe1,0x1f,0x0f,0xef,0x87,0x5c,0xe7,0x59},
+	{0xf0,0xec,0xb1,0xb0,0x00,0xbc,0x03,0x17,0xc8,0x86,0xe6,0xd4,0xd4,0xb3,0x66,0x5a,0xac,0x0a,0x26,0xc9,0x38,0x8b,0xb1,0x87,0x4e,0xff,0x51,0xc6,0x47,0x0d,0xc0,0x3f},
+	{0x0e,0xb5,0x51,0xf4,0x47,0x5b,0xc4,0x30,0x2d,0x3c,0x9d,0x13,0x38,0xbf,0xa4,0xa4,0xbf,0x5f,0x53,0xf7,0xca,0xd4,0x5b,0xcd,0xd9,0x9a,0xd4,0x18,0xe6,0xf0,0xae,0x44},
+	{0x58,0xdf,0x01,0x0f,0x58,0x5f,0x05,0x9f,0xd6,0xc8,0x88,0x54,0x4b,0x42,0xb5,0xe0,0x75,0x3c,0xf9,0xca,0x97,0xc0,0x58,0xae,0xcd,0xdb,0x6f,0x6d,0xd4,0x7e,0xf1,0x4f},
+	{0xb8,0xcf,0x8e,0xb2,0x0b,0xa1,0xfa,0xf8,0x44,0xe8,0xce,0xae,0x2a,0xc6,0x31,0x86,0x01,0xf1,0xc9,0xa6,0xc9,0xb9,0xb6,0x83,0x81,0x65,0x50,0xb2,0x92,0xfb,0x7b,0xf1},
+	{0xe5,0xb6,0x50,0x82,0xe6,0x07,0x17,0x2b,0xb6,0x30,0xb7,0xec,0x6a,0xd3,0x3a,0x69,0xbd,0xc6,0x75,0x95,0x3a,0x60,0x2f,0xda,0xb7,0x60,0x9e,0xbb,0x60,0x86,0x1f,0xae},
+	{0x9b,0xb8,0xd2,0x50,0x03,0x3d,0xcd,0xd6,0xcb,0x09,0x10,0x76,0x50,0xe4,0x5b,0x62,0x04,0x7a,0x66,0xf3,0x26,0x63,0x35,0x4d,0x3c,0xe6,0x4e,0xa9,0xc7,0x36,0x4e,0x6e},
+	{0xe7,0xf8,0x48,0xaa,0xea,0x61,0x3c,0xff,0xe5,0x7b,0x76,0x8a,0xe8,0x06,0xe6,0xbb,0xba,0x42,0xf2,0x59,0xeb,0x5b,0xfd,0x80,0x32,0xbe,0xe9,0x9d,0xd6,0xe1,0x9a,0xe0},
+	{0xa6,0xea,0x2f,0x5d,0x79,0x19,0x51,0xf0,0x0e,0x0a,0x8c,0x9a,0x4e,0x0f,0xb5,0x03,0x48,0x27,0xf4,0x5c,0xd3,0x48,0x8e,0xe5,0x14,0xd2,0x11,0x8f,0xb8,0x9d,0x9c,0xd7},
+	{0xe3,0xb0,0xc4,0x42,0x98,0xfc,0x1c,0x14,0x9a,0xfb,0xf4,0xc8,0x99,0x6f,0xb9,0x24,0x27,0xae,0x41,0xe4,0x64,0x9b,0x93,0x4c,0xa4,0x95,0x99,0x1b,0x78,0x52,0xb8,0x55},
+	{0x7c,0xfe,0xbe,0x13,0x9e,0x2b,0x74,0xff,0x80,0xfc,0x40,0x2f,0x1e,0x50,0x3c,0x9c,0x38,0x90,0xea,0xa1,0x6d,0x8a,0xbf,0xed,0xa6,0xa4,0x97,0x58,0x06,0x72,0x35,0xc7},
+	{0x53,0x0c,0x0f,0x3e,0x0e,0x87,0x2b,0x35,0x24,0xd8,0x4a,0x3c,0xda,0x22,0x43,0xfd,0x35,0x1d,0x45,0x09,0x4e,0x98,0x01,0x94,0xaf,0x5e,0x34,0x73,0x6d,0xad,0xb3,0x33},
+	{0x0a,0x18,0x8b,0x59,0xb6,0x57,0x49,0x6e,0xa5,0xfc,0xc9,0xd5,0xe8,0x4a,0x21,0x52,0xf5,0xc3,0xaa,0xea,0xf2,0x70,0xa3,0x13,0x11,0x6c,0xe8,0x0e,0x77,0x94,0x1e,0xf7},
+	{0x6d,0xbc,0x25,0x67,0xe9,0xe6,0x9f,0xac,0x65,0xb9,0xac,0x8c,0xf8,0xcc,0x08,0x79,0x70,0x40,0x46,0xf5,0xca,0x4a,0xb5,0x3d,0x7b,0x8a,0xc4,0x88,0x14,0x93,0x4f,0x38},
+	{0x6f,0x4d,0x7b,0x56,0x87,0x1e,0x0f,0x94,0x35,0x3a,0x4c,0xad,0x44,0xd1,0xa7,0x07,0x50,0xe4,0xab,0x1f,0x1b,0xf5,0xde,0x82,0x7f,0xcc,0xd5,0xb1,0x31,0xe2,0xcd,0x85},
+	{0x36,0xd9,0xd4,0x8f,0xb2,0xbc,0x73,0xb0,0xaa,0x1a,0x0a,0x67,0x58,0xe7,0xeb,0x8a,0x9a,0x59,0x3e,0x3d,0xdb,0x8b,0x21,0xfc,0x60,0x44,0xf6,0x81,0xf8,0x0d,0xfb,0xb0},
+	{0x1b,0x83,0x80,0x91,0xeb,0xba,0x35,0x6a,0xd3,0x06,0x7c,0x4f,0x1d,0x69,0xda,0xd1,0x0a,0x2e,0xe6,0x98,0x46,0x67,0xa3,0x69,0x0a,0xe5,0xa1,0x06,0xdf,0x27,0x5d,0xed},
+	{0xc7,0x94,0xcc,0x52,0x72,0xa0,0xf2,0x0b,0x76,0xb1,0x80,0x06,0x45,0x4e,0xf5,0x70,0x93,0x92,0x0e,0x80,0xa8,0x42,0x39,0x52,0x1b,0xa0,0x01,0x88,0x1e,0x7d,0xdb,0x6e},
+	{0x41,0x60,0x23,0xb2,0x51,0xeb,0x51,0x96,0x82,0x79,0x4b,0x53,0x73,0x3d,0xd2,0xde,0x95,0x06,0xa5,0x9e,0x05,0x7d,0x5d,0x19,0xac,0x56,0x93,0x77,0x5c,0xbd,0xd1,0xff},
+	{0xb5,0x39,0x3c,0x00,0x87,0x4d,0xa9,0x8e,0xd6,0x0c,0x33,0x24,0x4e,0x06,0x06,0x5a,0xca,0x05,0xa7,0x6f,0x8f,0xb6,0x4a,0xb8,0xc1,0x15,0x5f,0xa9,0xee,0x6d,0x79,0x47},
+	{0x41,0x09,0xaf,0x0d,0xc1,0xf3,0x7a,0xd8,0xdc,0x12,0x40,0x50,0x3c,0x19,0x82,0x6f,0x8e,0xdd,0x59,0x23,0xa0,0x2a,0xae,0x1c,0x89,0x06,0x6c,0x97,0x98,0x6f,0xae,0x93},
+	{0xf0,0xa1,0x60,0xb5,0xa1,0x5e,0x85,0x4f,0x9a,0x8e,0xee,0xa1,0xdf,0x27,0x83,0x83,0xcb,0xa3,0x8e,0xe0,0x38,0x64,0x63,0xb9,0x44,0x6b,0xde,0x78,0xe4,0x20,0xad,0x71},
+	{0x05,0xf6,0x07,0xb5,0xd3,0x42,0xb8,0xb9,0x58,0x5a,0x20,0x8c,0xcb,0xce,0xaa,0xcd,0x80,0x51,0xc2,0x4f,0x78,0x9b,0xda,0x86,0x2b,0x20,0x75,0xe4,0xdf,0x1a,0x64,0xa5},
+	{0xee,0x67,0x9f,0xd4,0x13,0xfe,0x66,0x2d,0xbe,0x96,0x74,0x1b,0x9d,0x31,0x23,0x56,0x12,0xe6,0xb3,0x70,0x4b,0xff,0xe2,0x32,0xa1,0xc0,0xac,0x13,0x06,0xf5,0xd0,0x81},
+	{0x8b,0x70,0x67,0xde,0x2e,0x5f,0x68,0xc5,0x97,0x83,0xd6,0xec,0x73,0x2d,0x7a,0xbd,0xc6,0x3c,0xd4,0xb0,0x6e,0xf2,0xf5,0xf7,0x81,0xbb,0xf0,0x3f,0xac,0x64,0xc0,0x78},
+	{0x49,0x81,0x4b,0x57,0x11,0x85,0xf2,0x5e,0x3a,0x80,0xd4,0x42,0xdd,0x72,0xfb,0x26,0x8c,0xba,0x38,0x70,0x68,0x13,0x2d,0x63,0xd0,0x25,0x9e,0xe8,0x1a,0x31,0x1d,0xb8},
+	{0x00,0x87,0xe9,0xb2,0x04,0x16,0x2c,0xdc,0x8a,0x72,0xcd,0x0a,0x86,0xa6,0x7e,0xb9,0x51,0x88,0x10,0xaa,0x1b,0x9f,0x95,0x74,0xc6,0x37,0x7e,0xa0,0x8b,0x20,0x70,0x71},
+	{0x4a,0xb8,0x67,0x2e,0x31,0x0c,0x18,0xf7,0x57,0x2c,0xa6,0x87,0x42,0x4e,0x2c,0x7b,0x4d,0xcd,0x7b,0x00,0x3b,0x66,0x04,0x9a,0x11,0xf5,0xe0,0xcb,0x20,0xac,0x34,0xe9},
+	{0xd1,0x38,0x34,0x21,0x37,0xff,0xbd,0x2e,0x00,0x7b,0xeb,0xde,0xc9,0x19,0xf0,0x58,0x22,0x52,0xd5,0x4a,0xed,0xca,0xe2,0x54,0xbd,0x8c,0xb8,0xfb,0x3a,0x2f,0xe9,0x1c},
+	{0x43,0x7d,0xd1,0x61,0x5c,0xa3,0x94,0xb6,0x92,0x19,0x10,0x6b,0x0d,0x37,0xb7,0xf1,0xcf,0x3a,0x40,0xea,0x4c,0x7b,0x21,0xdf,0x78,0xb1,0xe4,0x7d,0x8a,0x8f,0x35,0x0d},
+	{0x71,0x23,0x6e,0xd6,0x2c,0x85,0x39,0x4a,0x3a,0xd7,0xd0,0xd8,0xd6,0x54,0x05,0xba,0xc7,0xa1,0x00,0x83,0xe0,0x6b,0xa6,0xb8,0x21,0x20,0xda,0xcc,0x7a,0x00,0xfe,0x9a},
+	{0xde,0xc0,0x04,0x65,0x23,0x82,0x36,0xcd,0x95,0x4b,0xf8,0x5f,0xc8,0x3e,0x26,0xa3,0xf5,0x6b,0x1b,0x10,0x95,0xce,0x12,0x4b,0xfc,0x30,0x87,0xa6,0x68,0x2a,0x3a,0xcd}
+};
+
+const char AMIGA_ROM_VERSION_STRINGS[AMIGA_ROM_VERSION_STRINGS_SIZE] = {
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','2',' ','[','3','3','.','1','6','6',']',' ','(','A','5','0','0','/','A','1','0','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','1','.','2',' ','[','3','3','.','1','8','0',']',' ','(','A','5','0','0','/','A','1','0','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','1','2','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','0',' ','[','3','9','.','1','0','6',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0','T',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','1','.','2',' ','[','3','3','.','1','8','0',']',' ','(','A','5','0','0','/','A','1','0','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','6','.','8',' ','[','4','5','.','0','6','1',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a',' ','S','C','S','I',' ','B','o','o','t',' ','R','O','M',' ','(','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','1',' ','[','3','1','.','0','3','4',']',' ','(','P','A','L',',',' ','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','5',' ','[','3','7','.','3','5','0',']',' ','(','A','6','0','0','H','D',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','1','2','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'E','x','t','.',' ','R','O','M',' ','[','4','0','.','0','6','0',']',' ','(','C','D','3','2',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','6','.','8',' ','[','4','5','.','0','6','1',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','1',' ','[','3','1','.','0','3','4',']',' ','(','N','T','S','C',',',' ','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','7','0',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','b',' ','[','4','3','.','0','0','1','b',']',' ','(','W','a','l','k','e','r',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','0',']',' ','(','C','D','3','2',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','0',']',' ','(','C','D','3','2',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','4',' ','[','3','7','.','1','7','5',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','7','0',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','3',' ','[','3','4','.','0','0','5',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0','T',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','1','.','4',' ','[','3','6','.','0','1','6',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','1','2','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a',' ','C','R','T',' ','3','.','1',' ','F','M','V',' ','(','C','D','3','2',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','5','5',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'E','x','t','.',' ','R','O','M',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','4',' ','[','3','6','.','0','1','6',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','3',' ','[','3','4','.','0','0','5',']',' ','(','A','5','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','0',' ','[','3','9','.','1','0','6',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','4',' ','[','3','7','.','1','7','5',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'E','x','t','.',' ','R','O','M',' ','2','.','3','5',' ','(','A','6','9','0',')',' ','(','U','n','o','f','f','i','c','i','a','l',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','0',' ','[','3','9','.','1','0','6',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','2','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','0',' ','(','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','0',' ','[','3','9','.','1','0','6',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','7','0',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','3','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','0','.','7','b',' ','[','2','7','.','0','0','3','b',']',' ','(','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','1','2','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','4',' ','[','3','7','.','1','7','5',']',' ','(','A','5','0','0','+',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','1','.','1',' ','[','3','1','.','0','3','4',']',' ','(','N','T','S','C',',',' ','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','2',' ','[','3','6','.','2','0','7',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','3','.','0',' ','[','4','5','.','0','5','7',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','5','5',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'E','x','t','.',' ','R','O','M',' ','2','.','3','5',' ','(','A','5','7','0',')',' ','(','U','n','o','f','f','i','c','i','a','l',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0','T',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a',' ','S','C','S','I',' ','B','o','o','t',' ','R','O','M',' ','(','A','4','0','9','1',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','1','.','4',' ','[','3','6','.','0','1','6',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','4',' ','[','3','7','.','1','7','5',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','b',' ','[','4','3','.','0','0','1','b',']',' ','(','W','a','l','k','e','r',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'L','o','g','i','c','a',' ','D','i','a','l','o','g','a',' ','2','.','0','\0',
+	'E','x','t','.',' ','R','O','M',' ','2','.','3','5',' ','(','C','D','T','V',')',' ','(','U','n','o','f','f','i','c','i','a','l',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','3','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0','T',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','2','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','4','0','0','0',')','\0',
+	'E','x','t','.',' ','R','O','M',' ','1','.','3',' ','(','A','5','7','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','5',' ','[','3','7','.','3','0','0',']',' ','(','A','6','0','0','H','D',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','2',' ','[','3','6','.','2','0','7',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','3',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','3','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a',' ','S','C','S','I',' ','B','o','o','t',' ','R','O','M',' ','(','A','5','9','0',')','\0',
+	'E','x','t','.',' ','R','O','M',' ','1','.','3',' ','(','C','D','T','V',')','\0',
+	'V','i','l','l','a','g','e',' ','T','r','o','n','i','c',' ','P','i','c','a','s','s','o',' ','I','V',' ','7','.','4','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','4',' ','[','3','7','.','1','7','5',']',' ','(','A','5','0','0','+',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','1','.','3',' ','[','3','4','.','0','0','5',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','3',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0','T',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','1','.','3',' ','[','3','4','.','0','0','5',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','5',' ','[','3','7','.','3','5','0',']',' ','(','A','6','0','0','H','D',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','3','.','0',' ','[','4','5','.','0','5','7',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'E','x','t','.',' ','R','O','M',' ','2','.','3',' ','(','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','1','2','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','0',' ','[','3','9','.','1','0','6',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','5','0','0','/','A','6','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','3','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','2',' ','[','3','6','.','2','0','7',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','3',' ','[','3','4','.','0','0','5',']',' ','(','A','5','0','0','/','A','1','0','0','0','/','A','2','0','0','0','/','C','D','T','V',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','1','2','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','0',']',' ','(','C','D','3','2',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','3','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','3','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','3','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','0',' ','[','3','9','.','1','0','6',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','6','.','8',' ','[','4','5','.','0','6','1',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','3','.','0',' ','[','4','5','.','0','5','7',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','5',' ','[','3','7','.','2','9','9',']',' ','(','A','6','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','5',' ','[','3','7','.','2','9','9',']',' ','(','A','6','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+	'A','m','i','g','a','O','S',' ','1','.','0',' ','(','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','2','.','0','5',' ','[','3','7','.','3','0','0',']',' ','(','A','6','0','0','H','D',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','1','2','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','0','.','7','b',' ','[','2','7','.','0','0','3','b',']',' ','(','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'R','a','l','p','h',' ','S','c','h','m','i','d','t',' ','C','y','b','e','r','s','t','o','r','m',' ','P','P','C',' ','[','4','4','.','0','7','1',']','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','1','2','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0',')',' ','(','N','e','w',' ','C','o','p','y','r','i','g','h','t',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','1','.','2',' ','[','3','3','.','1','6','6',']',' ','(','A','5','0','0','/','A','1','0','0','0','/','A','2','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','4','0','0','0','T',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','5','5',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','4','0','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','b',' ','[','4','3','.','0','0','1','b',']',' ','(','W','a','l','k','e','r',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','3',' ','[','4','7','.','1','1','5',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2',' ','[','4','7','.','0','9','6',']',' ','(','A','4','0','0','0','T',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','1','.','1',' ','[','3','1','.','0','3','4',']',' ','(','P','A','L',',',' ','A','1','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','1',' ','[','4','7','.','1','0','2',']',' ','(','A','4','0','0','0','T',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','1',' ','[','4','5','.','0','6','4',']',' ','(','A','1','2','0','0',')',' ','H','i','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','7','.','0',' ','[','4','5','.','0','6','1',']',' ','(','A','3','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','2','.','2',' ','[','4','7','.','1','1','1',']',' ','(','A','3','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','x',' ','A','F','8','.','0',' ','[','4','5','.','0','6','6',']',' ','(','A','4','0','0','0',')',' ','L','o','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1',' ','[','4','0','.','0','6','8',']',' ','(','A','4','0','0','0',')','\0',
+	'A','m','i','g','a','O','S',' ','3','.','1','.','4',' ','[','4','6','.','1','4','3',']',' ','(','A','4','0','0','0','T',')',' ','(','O','l','d',' ','C','o','p','y','r','i','g','h','t',')','\0',
+};
+
+const AmigaROMInfo AMIGA_ROM_INFO[AMIGA_ROM_INFO_COUNT] = {
+	{AMIGA_ROM_DIGESTS[0], &AMIGA_ROM_VERSION_STRINGS[0], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A1200)
+	{AMIGA_ROM_DIGESTS[1], &AMIGA_ROM_VERSION_STRINGS[29], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.2 [33.166] (A500/A1000/A2000)
+	{AMIGA_ROM_DIGESTS[2], &AMIGA_ROM_VERSION_STRINGS[69], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[3], &AMIGA_ROM_VERSION_STRINGS[107], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.2 [33.180] (A500/A1000/A2000)
+	{AMIGA_ROM_DIGESTS[4], &AMIGA_ROM_VERSION_STRINGS[147], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A1200) (New Copyright) Hi
+	{AMIGA_ROM_DIGESTS[5], &AMIGA_ROM_VERSION_STRINGS[197], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.0 [39.106] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[6], &AMIGA_ROM_VERSION_STRINGS[229], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A4000)
+	{AMIGA_ROM_DIGESTS[7], &AMIGA_ROM_VERSION_STRINGS[260], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[8], &AMIGA_ROM_VERSION_STRINGS[292], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000T) (New Copyright) Hi
+	{AMIGA_ROM_DIGESTS[9], &AMIGA_ROM_VERSION_STRINGS[343], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 1.2 [33.180] (A500/A1000/A2000)
+	{AMIGA_ROM_DIGESTS[10], &AMIGA_ROM_VERSION_STRINGS[383], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF6.8 [45.061] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[11], &AMIGA_ROM_VERSION_STRINGS[421], 8192, 'O', 0, 0x00, NULL, NULL}, // Amiga SCSI Boot ROM (A1000)
+	{AMIGA_ROM_DIGESTS[12], &AMIGA_ROM_VERSION_STRINGS[449], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[13], &AMIGA_ROM_VERSION_STRINGS[501], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.1 [31.034] (PAL, A1000)
+	{AMIGA_ROM_DIGESTS[14], &AMIGA_ROM_VERSION_STRINGS[535], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 2.05 [37.350] (A600HD)
+	{AMIGA_ROM_DIGESTS[15], &AMIGA_ROM_VERSION_STRINGS[566], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[16], &AMIGA_ROM_VERSION_STRINGS[598], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[17], &AMIGA_ROM_VERSION_STRINGS[632], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A1200) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[18], &AMIGA_ROM_VERSION_STRINGS[679], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A3000)
+	{AMIGA_ROM_DIGESTS[19], &AMIGA_ROM_VERSION_STRINGS[714], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000) (New Copyright)
+	{AMIGA_ROM_DIGESTS[20], &AMIGA_ROM_VERSION_STRINGS[761], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[21], &AMIGA_ROM_VERSION_STRINGS[811], 524288, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM [40.060] (CD32)
+	{AMIGA_ROM_DIGESTS[22], &AMIGA_ROM_VERSION_STRINGS[836], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[23], &AMIGA_ROM_VERSION_STRINGS[881], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF6.8 [45.061] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[24], &AMIGA_ROM_VERSION_STRINGS[919], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A3000)
+	{AMIGA_ROM_DIGESTS[25], &AMIGA_ROM_VERSION_STRINGS[954], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.1 [31.034] (NTSC, A1000)
+	{AMIGA_ROM_DIGESTS[26], &AMIGA_ROM_VERSION_STRINGS[989], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[27], &AMIGA_ROM_VERSION_STRINGS[1023], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[28], &AMIGA_ROM_VERSION_STRINGS[1057], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.070] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[29], &AMIGA_ROM_VERSION_STRINGS[1090], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A3000)
+	{AMIGA_ROM_DIGESTS[30], &AMIGA_ROM_VERSION_STRINGS[1121], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2b [43.001b] (Walker) Hi
+	{AMIGA_ROM_DIGESTS[31], &AMIGA_ROM_VERSION_STRINGS[1156], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[32], &AMIGA_ROM_VERSION_STRINGS[1201], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A3000)
+	{AMIGA_ROM_DIGESTS[33], &AMIGA_ROM_VERSION_STRINGS[1230], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[34], &AMIGA_ROM_VERSION_STRINGS[1268], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.060] (CD32)
+	{AMIGA_ROM_DIGESTS[35], &AMIGA_ROM_VERSION_STRINGS[1296], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[36], &AMIGA_ROM_VERSION_STRINGS[1330], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.060] (CD32) Hi
+	{AMIGA_ROM_DIGESTS[37], &AMIGA_ROM_VERSION_STRINGS[1361], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A4000)
+	{AMIGA_ROM_DIGESTS[38], &AMIGA_ROM_VERSION_STRINGS[1396], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[39], &AMIGA_ROM_VERSION_STRINGS[1435], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[40], &AMIGA_ROM_VERSION_STRINGS[1480], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[41], &AMIGA_ROM_VERSION_STRINGS[1514], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A4000T)
+	{AMIGA_ROM_DIGESTS[42], &AMIGA_ROM_VERSION_STRINGS[1546], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A3000)
+	{AMIGA_ROM_DIGESTS[43], &AMIGA_ROM_VERSION_STRINGS[1575], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[44], &AMIGA_ROM_VERSION_STRINGS[1609], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 2.04 [37.175] (A3000)
+	{AMIGA_ROM_DIGESTS[45], &AMIGA_ROM_VERSION_STRINGS[1639], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A4000)
+	{AMIGA_ROM_DIGESTS[46], &AMIGA_ROM_VERSION_STRINGS[1668], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[47], &AMIGA_ROM_VERSION_STRINGS[1702], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[48], &AMIGA_ROM_VERSION_STRINGS[1740], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.070] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[49], &AMIGA_ROM_VERSION_STRINGS[1773], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[50], &AMIGA_ROM_VERSION_STRINGS[1808], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[51], &AMIGA_ROM_VERSION_STRINGS[1842], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[52], &AMIGA_ROM_VERSION_STRINGS[1894], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A1200)
+	{AMIGA_ROM_DIGESTS[53], &AMIGA_ROM_VERSION_STRINGS[1929], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[54], &AMIGA_ROM_VERSION_STRINGS[1981], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 1.3 [34.005] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[55], &AMIGA_ROM_VERSION_STRINGS[2013], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A500/A600/A2000) (New Copyright)
+	{AMIGA_ROM_DIGESTS[56], &AMIGA_ROM_VERSION_STRINGS[2070], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[57], &AMIGA_ROM_VERSION_STRINGS[2122], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000T) (Old Copyright) Hi
+	{AMIGA_ROM_DIGESTS[58], &AMIGA_ROM_VERSION_STRINGS[2173], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.4 [36.016] (A3000)
+	{AMIGA_ROM_DIGESTS[59], &AMIGA_ROM_VERSION_STRINGS[2202], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A1200) (Old Copyright) Hi
+	{AMIGA_ROM_DIGESTS[60], &AMIGA_ROM_VERSION_STRINGS[2252], 262144, 'O', 0, 0x00, NULL, NULL}, // Amiga CRT 3.1 FMV (CD32)
+	{AMIGA_ROM_DIGESTS[61], &AMIGA_ROM_VERSION_STRINGS[2277], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[62], &AMIGA_ROM_VERSION_STRINGS[2309], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[63], &AMIGA_ROM_VERSION_STRINGS[2347], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[64], &AMIGA_ROM_VERSION_STRINGS[2385], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[65], &AMIGA_ROM_VERSION_STRINGS[2437], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[66], &AMIGA_ROM_VERSION_STRINGS[2476], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000) (New Copyright) Lo
+	{AMIGA_ROM_DIGESTS[67], &AMIGA_ROM_VERSION_STRINGS[2526], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A4000T)
+	{AMIGA_ROM_DIGESTS[68], &AMIGA_ROM_VERSION_STRINGS[2558], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[69], &AMIGA_ROM_VERSION_STRINGS[2596], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[70], &AMIGA_ROM_VERSION_STRINGS[2634], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.055] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[71], &AMIGA_ROM_VERSION_STRINGS[2666], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 3.2 [47.096] (CDTV)
+	{AMIGA_ROM_DIGESTS[72], &AMIGA_ROM_VERSION_STRINGS[2695], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 1.4 [36.016] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[73], &AMIGA_ROM_VERSION_STRINGS[2727], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A1200)
+	{AMIGA_ROM_DIGESTS[74], &AMIGA_ROM_VERSION_STRINGS[2758], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[75], &AMIGA_ROM_VERSION_STRINGS[2808], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A1200)
+	{AMIGA_ROM_DIGESTS[76], &AMIGA_ROM_VERSION_STRINGS[2839], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 1.3 [34.005] (A500/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[77], &AMIGA_ROM_VERSION_STRINGS[2884], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.0 [39.106] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[78], &AMIGA_ROM_VERSION_STRINGS[2916], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 2.04 [37.175] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[79], &AMIGA_ROM_VERSION_STRINGS[2949], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 2.35 (A690) (Unofficial)
+	{AMIGA_ROM_DIGESTS[80], &AMIGA_ROM_VERSION_STRINGS[2983], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.0 [39.106] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[81], &AMIGA_ROM_VERSION_STRINGS[3015], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A2000) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[82], &AMIGA_ROM_VERSION_STRINGS[3062], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 1.0 (A1000)
+	{AMIGA_ROM_DIGESTS[83], &AMIGA_ROM_VERSION_STRINGS[3082], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000) (Old Copyright) Hi
+	{AMIGA_ROM_DIGESTS[84], &AMIGA_ROM_VERSION_STRINGS[3132], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.0 [39.106] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[85], &AMIGA_ROM_VERSION_STRINGS[3164], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.070] (A4000T)
+	{AMIGA_ROM_DIGESTS[86], &AMIGA_ROM_VERSION_STRINGS[3194], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A3000) (New Copyright) Hi
+	{AMIGA_ROM_DIGESTS[87], &AMIGA_ROM_VERSION_STRINGS[3244], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 0.7b [27.003b] (A1000)
+	{AMIGA_ROM_DIGESTS[88], &AMIGA_ROM_VERSION_STRINGS[3275], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[89], &AMIGA_ROM_VERSION_STRINGS[3314], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A1200) (Old Copyright) Lo
+	{AMIGA_ROM_DIGESTS[90], &AMIGA_ROM_VERSION_STRINGS[3364], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A500/A600/A2000) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[91], &AMIGA_ROM_VERSION_STRINGS[3421], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[92], &AMIGA_ROM_VERSION_STRINGS[3459], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 2.04 [37.175] (A500+)
+	{AMIGA_ROM_DIGESTS[93], &AMIGA_ROM_VERSION_STRINGS[3489], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[94], &AMIGA_ROM_VERSION_STRINGS[3523], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 1.1 [31.034] (NTSC, A1000)
+	{AMIGA_ROM_DIGESTS[95], &AMIGA_ROM_VERSION_STRINGS[3558], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 2.02 [36.207] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[96], &AMIGA_ROM_VERSION_STRINGS[3591], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF3.0 [45.057] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[97], &AMIGA_ROM_VERSION_STRINGS[3629], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.055] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[98], &AMIGA_ROM_VERSION_STRINGS[3661], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 2.35 (A570) (Unofficial)
+	{AMIGA_ROM_DIGESTS[99], &AMIGA_ROM_VERSION_STRINGS[3695], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000T) (Old Copyright) Lo
+	{AMIGA_ROM_DIGESTS[100], &AMIGA_ROM_VERSION_STRINGS[3746], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A4000T)
+	{AMIGA_ROM_DIGESTS[101], &AMIGA_ROM_VERSION_STRINGS[3782], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A4000T)
+	{AMIGA_ROM_DIGESTS[102], &AMIGA_ROM_VERSION_STRINGS[3818], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A500/A600/A2000) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[103], &AMIGA_ROM_VERSION_STRINGS[3875], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[104], &AMIGA_ROM_VERSION_STRINGS[3920], 32768, 'O', 0, 0x00, NULL, NULL}, // Amiga SCSI Boot ROM (A4091)
+	{AMIGA_ROM_DIGESTS[105], &AMIGA_ROM_VERSION_STRINGS[3948], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[106], &AMIGA_ROM_VERSION_STRINGS[3987], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 1.4 [36.016] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[107], &AMIGA_ROM_VERSION_STRINGS[4019], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[108], &AMIGA_ROM_VERSION_STRINGS[4053], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[109], &AMIGA_ROM_VERSION_STRINGS[4088], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 2.04 [37.175] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[110], &AMIGA_ROM_VERSION_STRINGS[4121], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A1200)
+	{AMIGA_ROM_DIGESTS[111], &AMIGA_ROM_VERSION_STRINGS[4152], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2b [43.001b] (Walker)
+	{AMIGA_ROM_DIGESTS[112], &AMIGA_ROM_VERSION_STRINGS[4184], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A500/A600/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[113], &AMIGA_ROM_VERSION_STRINGS[4236], 524288, 'O', 0, 0x00, NULL, NULL}, // Logica Dialoga 2.0
+	{AMIGA_ROM_DIGESTS[114], &AMIGA_ROM_VERSION_STRINGS[4255], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 2.35 (CDTV) (Unofficial)
+	{AMIGA_ROM_DIGESTS[115], &AMIGA_ROM_VERSION_STRINGS[4289], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[116], &AMIGA_ROM_VERSION_STRINGS[4321], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A4000T)
+	{AMIGA_ROM_DIGESTS[117], &AMIGA_ROM_VERSION_STRINGS[4357], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A3000) (New Copyright) Lo
+	{AMIGA_ROM_DIGESTS[118], &AMIGA_ROM_VERSION_STRINGS[4407], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000T) (New Copyright)
+	{AMIGA_ROM_DIGESTS[119], &AMIGA_ROM_VERSION_STRINGS[4455], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A2000) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[120], &AMIGA_ROM_VERSION_STRINGS[4502], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A4000)
+	{AMIGA_ROM_DIGESTS[121], &AMIGA_ROM_VERSION_STRINGS[4533], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 1.3 (A570)
+	{AMIGA_ROM_DIGESTS[122], &AMIGA_ROM_VERSION_STRINGS[4553], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[123], &AMIGA_ROM_VERSION_STRINGS[4585], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 2.05 [37.300] (A600HD)
+	{AMIGA_ROM_DIGESTS[124], &AMIGA_ROM_VERSION_STRINGS[4616], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A4000)
+	{AMIGA_ROM_DIGESTS[125], &AMIGA_ROM_VERSION_STRINGS[4651], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 2.02 [36.207] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[126], &AMIGA_ROM_VERSION_STRINGS[4684], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.063] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[127], &AMIGA_ROM_VERSION_STRINGS[4723], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[128], &AMIGA_ROM_VERSION_STRINGS[4768], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[129], &AMIGA_ROM_VERSION_STRINGS[4806], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A1200)
+	{AMIGA_ROM_DIGESTS[130], &AMIGA_ROM_VERSION_STRINGS[4835], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A3000) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[131], &AMIGA_ROM_VERSION_STRINGS[4882], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A3000)
+	{AMIGA_ROM_DIGESTS[132], &AMIGA_ROM_VERSION_STRINGS[4917], 16384, 'O', 0, 0x00, NULL, NULL}, // Amiga SCSI Boot ROM (A590)
+	{AMIGA_ROM_DIGESTS[133], &AMIGA_ROM_VERSION_STRINGS[4944], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 1.3 (CDTV)
+	{AMIGA_ROM_DIGESTS[134], &AMIGA_ROM_VERSION_STRINGS[4964], 131072, 'O', 0, 0x00, NULL, NULL}, // Village Tronic Picasso IV 7.4
+	{AMIGA_ROM_DIGESTS[135], &AMIGA_ROM_VERSION_STRINGS[4994], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[136], &AMIGA_ROM_VERSION_STRINGS[5028], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[137], &AMIGA_ROM_VERSION_STRINGS[5066], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[138], &AMIGA_ROM_VERSION_STRINGS[5100], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[139], &AMIGA_ROM_VERSION_STRINGS[5132], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 2.04 [37.175] (A500+)
+	{AMIGA_ROM_DIGESTS[140], &AMIGA_ROM_VERSION_STRINGS[5162], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[141], &AMIGA_ROM_VERSION_STRINGS[5196], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 1.3 [34.005] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[142], &AMIGA_ROM_VERSION_STRINGS[5228], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[143], &AMIGA_ROM_VERSION_STRINGS[5266], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[144], &AMIGA_ROM_VERSION_STRINGS[5305], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.063] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[145], &AMIGA_ROM_VERSION_STRINGS[5344], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000T) (New Copyright) Lo
+	{AMIGA_ROM_DIGESTS[146], &AMIGA_ROM_VERSION_STRINGS[5395], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.3 [34.005] (A3000)
+	{AMIGA_ROM_DIGESTS[147], &AMIGA_ROM_VERSION_STRINGS[5424], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A500/A600/A2000) (New Copyright)
+	{AMIGA_ROM_DIGESTS[148], &AMIGA_ROM_VERSION_STRINGS[5481], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 2.05 [37.350] (A600HD)
+	{AMIGA_ROM_DIGESTS[149], &AMIGA_ROM_VERSION_STRINGS[5512], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[150], &AMIGA_ROM_VERSION_STRINGS[5544], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[151], &AMIGA_ROM_VERSION_STRINGS[5576], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF3.0 [45.057] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[152], &AMIGA_ROM_VERSION_STRINGS[5614], 262144, 'E', 0, 0x00, NULL, NULL}, // Ext. ROM 2.3 (CDTV)
+	{AMIGA_ROM_DIGESTS[153], &AMIGA_ROM_VERSION_STRINGS[5634], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A1200) (New Copyright)
+	{AMIGA_ROM_DIGESTS[154], &AMIGA_ROM_VERSION_STRINGS[5681], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.0 [39.106] (A1200)
+	{AMIGA_ROM_DIGESTS[155], &AMIGA_ROM_VERSION_STRINGS[5710], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A500/A600/A2000)
+	{AMIGA_ROM_DIGESTS[156], &AMIGA_ROM_VERSION_STRINGS[5755], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[157], &AMIGA_ROM_VERSION_STRINGS[5793], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[158], &AMIGA_ROM_VERSION_STRINGS[5832], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A4000T)
+	{AMIGA_ROM_DIGESTS[159], &AMIGA_ROM_VERSION_STRINGS[5862], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A3000) Hi
+	{AMIGA_ROM_DIGESTS[160], &AMIGA_ROM_VERSION_STRINGS[5894], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[161], &AMIGA_ROM_VERSION_STRINGS[5929], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 2.02 [36.207] (A3000)
+	{AMIGA_ROM_DIGESTS[162], &AMIGA_ROM_VERSION_STRINGS[5959], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.3 [34.005] (A500/A1000/A2000/CDTV)
+	{AMIGA_ROM_DIGESTS[163], &AMIGA_ROM_VERSION_STRINGS[6004], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A1200) Lo
+	{AMIGA_ROM_DIGESTS[164], &AMIGA_ROM_VERSION_STRINGS[6036], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.060] (CD32) Hi
+	{AMIGA_ROM_DIGESTS[165], &AMIGA_ROM_VERSION_STRINGS[6067], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A1200)
+	{AMIGA_ROM_DIGESTS[166], &AMIGA_ROM_VERSION_STRINGS[6102], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A3000) (Old Copyright) Hi
+	{AMIGA_ROM_DIGESTS[167], &AMIGA_ROM_VERSION_STRINGS[6152], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A3000) (New Copyright)
+	{AMIGA_ROM_DIGESTS[168], &AMIGA_ROM_VERSION_STRINGS[6199], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A3000) (Old Copyright) Lo
+	{AMIGA_ROM_DIGESTS[169], &AMIGA_ROM_VERSION_STRINGS[6249], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[170], &AMIGA_ROM_VERSION_STRINGS[6282], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.0 [39.106] (A4000)
+	{AMIGA_ROM_DIGESTS[171], &AMIGA_ROM_VERSION_STRINGS[6311], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[172], &AMIGA_ROM_VERSION_STRINGS[6349], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF6.8 [45.061] (A4000)
+	{AMIGA_ROM_DIGESTS[173], &AMIGA_ROM_VERSION_STRINGS[6384], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF3.0 [45.057] (A4000)
+	{AMIGA_ROM_DIGESTS[174], &AMIGA_ROM_VERSION_STRINGS[6419], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 2.05 [37.299] (A600)
+	{AMIGA_ROM_DIGESTS[175], &AMIGA_ROM_VERSION_STRINGS[6448], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[176], &AMIGA_ROM_VERSION_STRINGS[6483], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 2.05 [37.299] (A600)
+	{AMIGA_ROM_DIGESTS[177], &AMIGA_ROM_VERSION_STRINGS[6512], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000) (Old Copyright)
+	{AMIGA_ROM_DIGESTS[178], &AMIGA_ROM_VERSION_STRINGS[6559], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 1.0 (A1000)
+	{AMIGA_ROM_DIGESTS[179], &AMIGA_ROM_VERSION_STRINGS[6579], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A4000)
+	{AMIGA_ROM_DIGESTS[180], &AMIGA_ROM_VERSION_STRINGS[6610], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[181], &AMIGA_ROM_VERSION_STRINGS[6644], 524288, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 2.05 [37.300] (A600HD)
+	{AMIGA_ROM_DIGESTS[182], &AMIGA_ROM_VERSION_STRINGS[6675], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[183], &AMIGA_ROM_VERSION_STRINGS[6709], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A1200)
+	{AMIGA_ROM_DIGESTS[184], &AMIGA_ROM_VERSION_STRINGS[6744], 262144, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 0.7b [27.003b] (A1000)
+	{AMIGA_ROM_DIGESTS[185], &AMIGA_ROM_VERSION_STRINGS[6775], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[186], &AMIGA_ROM_VERSION_STRINGS[6809], 131072, 'O', 0, 0x00, NULL, NULL}, // Ralph Schmidt Cyberstorm PPC [44.071]
+	{AMIGA_ROM_DIGESTS[187], &AMIGA_ROM_VERSION_STRINGS[6847], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[188], &AMIGA_ROM_VERSION_STRINGS[6879], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A1200) (New Copyright) Lo
+	{AMIGA_ROM_DIGESTS[189], &AMIGA_ROM_VERSION_STRINGS[6929], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[190], &AMIGA_ROM_VERSION_STRINGS[6964], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000) (New Copyright) Hi
+	{AMIGA_ROM_DIGESTS[191], &AMIGA_ROM_VERSION_STRINGS[7014], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 1.2 [33.166] (A500/A1000/A2000)
+	{AMIGA_ROM_DIGESTS[192], &AMIGA_ROM_VERSION_STRINGS[7054], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A4000T)
+	{AMIGA_ROM_DIGESTS[193], &AMIGA_ROM_VERSION_STRINGS[7086], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.055] (A3000)
+	{AMIGA_ROM_DIGESTS[194], &AMIGA_ROM_VERSION_STRINGS[7115], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.1.4 [46.143] (A4000) (Old Copyright) Lo
+	{AMIGA_ROM_DIGESTS[195], &AMIGA_ROM_VERSION_STRINGS[7165], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A4000) Hi
+	{AMIGA_ROM_DIGESTS[196], &AMIGA_ROM_VERSION_STRINGS[7197], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A3000)
+	{AMIGA_ROM_DIGESTS[197], &AMIGA_ROM_VERSION_STRINGS[7228], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2b [43.001b] (Walker) Lo
+	{AMIGA_ROM_DIGESTS[198], &AMIGA_ROM_VERSION_STRINGS[7263], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.3 [47.115] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[199], &AMIGA_ROM_VERSION_STRINGS[7297], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.2 [47.096] (A4000T) Hi
+	{AMIGA_ROM_DIGESTS[200], &AMIGA_ROM_VERSION_STRINGS[7330], 262144, 'M', 1, 0x00, NULL, NULL}, // AmigaOS 1.1 [31.034] (PAL, A1000)
+	{AMIGA_ROM_DIGESTS[201], &AMIGA_ROM_VERSION_STRINGS[7364], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[202], &AMIGA_ROM_VERSION_STRINGS[7398], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.2.1 [47.102] (A4000T) Lo
+	{AMIGA_ROM_DIGESTS[203], &AMIGA_ROM_VERSION_STRINGS[7433], 262144, 'A', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.1 [45.064] (A1200) Hi
+	{AMIGA_ROM_DIGESTS[204], &AMIGA_ROM_VERSION_STRINGS[7471], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF7.0 [45.061] (A3000) Lo
+	{AMIGA_ROM_DIGESTS[205], &AMIGA_ROM_VERSION_STRINGS[7509], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.2.2 [47.111] (A3000)
+	{AMIGA_ROM_DIGESTS[206], &AMIGA_ROM_VERSION_STRINGS[7540], 262144, 'B', 1, 0x00, NULL, NULL}, // AmigaOS 3.x AF8.0 [45.066] (A4000) Lo
+	{AMIGA_ROM_DIGESTS[207], &AMIGA_ROM_VERSION_STRINGS[7578], 524288, 'M', 0, 0x00, NULL, NULL}, // AmigaOS 3.1 [40.068] (A4000)
+	{AMIGA_ROM_DIGESTS[208], &AMIGA_ROM_VERSION_STRINGS[7607], 524288, 'M', 0, 0x00, NULL, NULL} // AmigaOS 3.1.4 [46.143] (A4000T) (Old Copyright)
+};
+
+const AmigaROMFingerprint AMIGA_ROM_FINGERPRINTS[AMIGA_ROM_FINGERPRINT_COUNT + 1] = {
+	{0, 0, 0, 0, 0, 0}
+};
+
+const AmigaROMSizeClass AMIGA_ROM_SIZE_CLASSES[AMIGA_ROM_SIZE_CLASS_COUNT] = {
+	{8192, 1},
+	{16384, 1},
+	{32768, 1},
+	{131072, 2},
+	{262144, 123},
+	{524288, 81}
+};
+
+const AmigaROMModuleInfo AMIGA_ROM_MODULES[AMIGA_ROM_MODULE_COUNT + 1] = {
+	{0, NULL, NULL, 0}
+};
+
+const AmigaROMSimilarityKey AMIGA_ROM_SIMILARITY_KEYS[AMIGA_ROM_SIMILARITY_KEY_COUNT + 1] = {
+	{0, 0}
+};
+
+const AmigaROMBankChecksum AMIGA_ROM_BANK_CHECKSUMS[AMIGA_ROM_BANK_CHECKSUM_COUNT + 1] = {
+	{0, 0, 0, 0}
+};
@@ -25,45 +25,62 @@ SOFTWARE.
 #ifndef AMIGAROMMAJORMINORVERSIONS_H
 #define AMIGAROMMAJORMINORVERSIONS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+// Minor versions of a major version which covers more than one release
 typedef struct {
-	const uint16_t major_version;
-	const uint16_t minor_version; // 0xffff is a "don't care", as the major_version has a 1:1 match with a version
-	const char version[128];
-} AmigaROMMajorMinorVersions;
+	const uint16_t minor_version;
+	const char *version;
+} AmigaROMMinorVersion;
 
-static const AmigaROMMajorMinorVersions AMIGA_ROM_MAJOR_MINOR_VERSIONS[] = {
-	{23, 0xffff, "AmigaOS \"Velvet\" prerelease"},
-	{24, 0xffff, "AmigaOS 0.4 (A1000)"},
-	{26, 0xffff, "AmigaOS 0.6 (A1000)"},
-	{27, 0xffff, "AmigaOS 0.7 (A1000)"},
-	{29, 0xffff, "AmigaOS 0.9 (A1000)"},
-	{30, 0xffff, "AmigaOS 1.0 (A1000)"},
-	{31, 0xffff, "AmigaOS 1.1 (A1000)"},
-	{32, 0xffff, "AmigaOS 1.1 (A1000)"},
-	{33, 0xffff, "AmigaOS 1.2 (A500/A1000/A2000)"},
-	{34, 0xffff, "AmigaOS 1.3 (A500/A1000/A2000/A3000/CDTV)"},
-	{35, 0xffff, "AmigaOS 1.3 (A2024)"},
-	{36, 0xffff, "AmigaOS 2.0 (A500+ ECS/A3000)"},
-	{37,    175, "AmigaOS 2.04 (A500+/A2000/A3000)"},
-	{37,    210, "AmigaOS 2.05 (A600)"},
-	{37,    299, "AmigaOS 2.05 (A600 ECS)"},
-	{37,    300, "AmigaOS 2.05 (A600HD)"},
-	{37,    350, "AmigaOS 2.05 (A600HD)"},
-	{38, 0xffff, "AmigaOS 2.1"},
-	{39, 0xffff, "AmigaOS 3.0 (A1200/A4000)"},
-	{40, 0xffff, "AmigaOS 3.1 (A500/A600/A1200/A2000/A3000/A4000/A4000T/CD32)"},
-	{41, 0xffff, "AmigaOS 3.1 (Japan localization)"},
-	{43, 0xffff, "AmigaOS 3.1 (patched) / AmigaOS 3.2 (Walker prototype)"},
-	{44, 0xffff, "Haage & Partner AmigaOS 3.5"},
-	{45, 0xffff, "Cloanto AmigaOS 3.x / Haage & Partner AmigaOS 3.9"},
-	{46, 0xffff, "Hyperion Entertainment AmigaOS 3.1.4"},
-	{47, 0xffff, "Hyperion Entertainment AmigaOS 3.2"},
-	{50, 0xffff, "Hyperion Entertainment AmigaOS 4 Beta / MorphOS 1"},
-	{51, 0xffff, "Hyperion Entertainment AmigaOS 4 Beta / MorphOS 2+"},
-	{52, 0xffff, "Hyperion Entertainment AmigaOS 4.0"},
-	{53, 0xffff, "Hyperion Entertainment AmigaOS 4.1"}
+// version is NULL if the major version doesn't identify a release on its
+// own, in which case minor_versions lists the known ones.
+typedef struct {
+	const char *version;
+	const AmigaROMMinorVersion *minor_versions;
+	const size_t minor_version_count;
+} AmigaROMMajorVersion;
+
+// Highest major version AMIGA_ROM_MAJOR_VERSIONS has room for
+#define AMIGA_ROM_MAX_MAJOR_VERSION 63
+
+static const AmigaROMMinorVersion AMIGA_ROM_MINOR_VERSIONS_37[] = {
+	{175, "AmigaOS 2.04 (A500+/A2000/A3000)"},
+	{210, "AmigaOS 2.05 (A600)"},
+	{299, "AmigaOS 2.05 (A600 ECS)"},
+	{300, "AmigaOS 2.05 (A600HD)"},
+	{350, "AmigaOS 2.05 (A600HD)"}
+};
+
+// Indexed directly by major version
+static const AmigaROMMajorVersion AMIGA_ROM_MAJOR_VERSIONS[AMIGA_ROM_MAX_MAJOR_VERSION + 1] = {
+	[23] = {"AmigaOS \"Velvet\" prerelease", NULL, 0},
+	[24] = {"AmigaOS 0.4 (A1000)", NULL, 0},
+	[26] = {"AmigaOS 0.6 (A1000)", NULL, 0},
+	[27] = {"AmigaOS 0.7 (A1000)", NULL, 0},
+	[29] = {"AmigaOS 0.9 (A1000)", NULL, 0},
+	[30] = {"AmigaOS 1.0 (A1000)", NULL, 0},
+	[31] = {"AmigaOS 1.1 (A1000)", NULL, 0},
+	[32] = {"AmigaOS 1.1 (A1000)", NULL, 0},
+	[33] = {"AmigaOS 1.2 (A500/A1000/A2000)", NULL, 0},
+	[34] = {"AmigaOS 1.3 (A500/A1000/A2000/A3000/CDTV)", NULL, 0},
+	[35] = {"AmigaOS 1.3 (A2024)", NULL, 0},
+	[36] = {"AmigaOS 2.0 (A500+ ECS/A3000)", NULL, 0},
+	[37] = {NULL, AMIGA_ROM_MINOR_VERSIONS_37, sizeof(AMIGA_ROM_MINOR_VERSIONS_37) / sizeof(AmigaROMMinorVersion)},
+	[38] = {"AmigaOS 2.1", NULL, 0},
+	[39] = {"AmigaOS 3.0 (A1200/A4000)", NULL, 0},
+	[40] = {"AmigaOS 3.1 (A500/A600/A1200/A2000/A3000/A4000/A4000T/CD32)", NULL, 0},
+	[41] = {"AmigaOS 3.1 (Japan localization)", NULL, 0},
+	[43] = {"AmigaOS 3.1 (patched) / AmigaOS 3.2 (Walker prototype)", NULL, 0},
+	[44] = {"Haage & Partner AmigaOS 3.5", NULL, 0},
+	[45] = {"Cloanto AmigaOS 3.x / Haage & Partner AmigaOS 3.9", NULL, 0},
+	[46] = {"Hyperion Entertainment AmigaOS 3.1.4", NULL, 0},
+	[47] = {"Hyperion Entertainment AmigaOS 3.2", NULL, 0},
+	[50] = {"Hyperion Entertainment AmigaOS 4 Beta / MorphOS 1", NULL, 0},
+	[51] = {"Hyperion Entertainment AmigaOS 4 Beta / MorphOS 2+", NULL, 0},
+	[52] = {"Hyperion Entertainment AmigaOS 4.0", NULL, 0},
+	[53] = {"Hyperion Entertainment AmigaOS 4.1", NULL, 0}
 };
 
 #endif
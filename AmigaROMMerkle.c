@@ -0,0 +1,431 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AmigaROMMerkle.h"
+#include "teeny-sha256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// Leaves handed to SHA256Multi() at a time by each worker, so equally sized
+// blocks fill its SIMD lanes without a job array per leaf.
+#define AMIGA_ROM_MERKLE_JOB_BATCH 16
+
+// Images with fewer leaves than this per thread aren't worth a thread.
+#define AMIGA_ROM_MERKLE_MIN_LEAVES_PER_THREAD 32
+
+typedef struct {
+	const uint8_t *data;
+	size_t data_size;
+	uint8_t (*leaves)[32];
+	size_t first_leaf;
+	size_t end_leaf;
+	bool result;
+} AmigaROMMerkleWork;
+
+// Create and return a new and initialized struct.
+// Pointers are NOT allocated, but are NULL instead.
+AmigaROMMerkleTree GetInitializedAmigaROMMerkleTree(void)
+{
+	AmigaROMMerkleTree merkle_tree;
+
+	memset(merkle_tree.root, 0, sizeof(merkle_tree.root));
+	merkle_tree.leaves = NULL;
+	merkle_tree.leaf_count = 0;
+
+	return merkle_tree;
+}
+
+// Frees the leaves and re-initializes the struct.
+void DestroyAmigaROMMerkleTree(AmigaROMMerkleTree *merkle_tree)
+{
+	if(!merkle_tree)
+	{
+		return;
+	}
+
+	free(merkle_tree->leaves);
+	*merkle_tree = GetInitializedAmigaROMMerkleTree();
+}
+
+// Hashes the leaves in [first_leaf, end_leaf) of one work item.
+static void HashAmigaROMMerkleLeaves(AmigaROMMerkleWork *work)
+{
+	SHA256Job jobs[AMIGA_ROM_MERKLE_JOB_BATCH];
+	size_t leaf, job_count, i, offset;
+
+	work->result = true;
+
+	for(leaf = work->first_leaf; leaf < work->end_leaf; leaf += job_count)
+	{
+		job_count = work->end_leaf - leaf;
+		if(job_count > AMIGA_ROM_MERKLE_JOB_BATCH)
+		{
+			job_count = AMIGA_ROM_MERKLE_JOB_BATCH;
+		}
+
+		for(i = 0; i < job_count; i++)
+		{
+			offset = (leaf + i) * AMIGA_ROM_MERKLE_LEAF_SIZE;
+			jobs[i].msg = &(work->data)[offset];
+			jobs[i].msgLen = work->data_size - offset;
+			if(jobs[i].msgLen > AMIGA_ROM_MERKLE_LEAF_SIZE)
+			{
+				jobs[i].msgLen = AMIGA_ROM_MERKLE_LEAF_SIZE;
+			}
+		}
+
+		if(SHA256Multi(jobs, job_count) != 0)
+		{
+			work->result = false;
+			return;
+		}
+
+		for(i = 0; i < job_count; i++)
+		{
+			memcpy(work->leaves[leaf + i], jobs[i].digest, 32);
+		}
+	}
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+static DWORD WINAPI AmigaROMMerkleThread(LPVOID work)
+{
+	HashAmigaROMMerkleLeaves((AmigaROMMerkleWork*)work);
+	return 0;
+}
+#else
+static void* AmigaROMMerkleThread(void *work)
+{
+	HashAmigaROMMerkleLeaves((AmigaROMMerkleWork*)work);
+	return NULL;
+}
+#endif
+
+// Returns the number of online CPUs, or 1 if it can't be determined.
+static unsigned int GetAmigaROMMerkleCPUCount(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	SYSTEM_INFO system_info;
+
+	GetSystemInfo(&system_info);
+
+	return (system_info.dwNumberOfProcessors > 0) ? (unsigned int)system_info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+	long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (cpu_count > 0) ? (unsigned int)cpu_count : 1;
+#else
+	return 1;
+#endif
+}
+
+// Hashes every AMIGA_ROM_MERKLE_LEAF_SIZE block of data, spread over
+// thread_count threads (0 picks one per online CPU), and combines the leaves
+// into the root.  Any leaves already in merkle_tree are freed first.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMMerkleTree(const uint8_t *data, const size_t data_size, const unsigned int thread_count, AmigaROMMerkleTree *merkle_tree)
+{
+	AmigaROMMerkleWork work[AMIGA_ROM_MERKLE_MAX_THREADS];
+#if defined(_WIN32) || defined(_WIN64)
+	HANDLE threads[AMIGA_ROM_MERKLE_MAX_THREADS];
+#else
+	pthread_t threads[AMIGA_ROM_MERKLE_MAX_THREADS];
+#endif
+	bool thread_started[AMIGA_ROM_MERKLE_MAX_THREADS];
+	size_t leaf_count, worker_count, leaves_per_worker, i;
+	bool result = true;
+
+	if(!data || data_size == 0 || !merkle_tree)
+	{
+		return false;
+	}
+
+	DestroyAmigaROMMerkleTree(merkle_tree);
+
+	leaf_count = (data_size + AMIGA_ROM_MERKLE_LEAF_SIZE - 1) / AMIGA_ROM_MERKLE_LEAF_SIZE;
+	merkle_tree->leaves = malloc(leaf_count * 32);
+	if(!(merkle_tree->leaves))
+	{
+		return false;
+	}
+
+	merkle_tree->leaf_count = leaf_count;
+
+	worker_count = (thread_count == 0) ? GetAmigaROMMerkleCPUCount() : thread_count;
+	if(worker_count > AMIGA_ROM_MERKLE_MAX_THREADS)
+	{
+		worker_count = AMIGA_ROM_MERKLE_MAX_THREADS;
+	}
+
+	if(worker_count > leaf_count / AMIGA_ROM_MERKLE_MIN_LEAVES_PER_THREAD)
+	{
+		worker_count = leaf_count / AMIGA_ROM_MERKLE_MIN_LEAVES_PER_THREAD;
+	}
+
+	if(worker_count == 0)
+	{
+		worker_count = 1;
+	}
+
+	leaves_per_worker = (leaf_count + worker_count - 1) / worker_count;
+
+	for(i = 0; i < worker_count; i++)
+	{
+		work[i].data = data;
+		work[i].data_size = data_size;
+		work[i].leaves = merkle_tree->leaves;
+		work[i].first_leaf = i * leaves_per_worker;
+		work[i].end_leaf = work[i].first_leaf + leaves_per_worker;
+		if(work[i].end_leaf > leaf_count)
+		{
+			work[i].end_leaf = leaf_count;
+		}
+		work[i].result = false;
+		thread_started[i] = false;
+	}
+
+	// Worker 0 runs on the calling thread, and any worker whose thread can't
+	// be started runs there too.
+	for(i = 1; i < worker_count; i++)
+	{
+#if defined(_WIN32) || defined(_WIN64)
+		threads[i] = CreateThread(NULL, 0, AmigaROMMerkleThread, &(work[i]), 0, NULL);
+		thread_started[i] = (threads[i] != NULL);
+#else
+		thread_started[i] = (pthread_create(&(threads[i]), NULL, AmigaROMMerkleThread, &(work[i])) == 0);
+#endif
+	}
+
+	for(i = 0; i < worker_count; i++)
+	{
+		if(!thread_started[i])
+		{
+			HashAmigaROMMerkleLeaves(&(work[i]));
+		}
+	}
+
+	for(i = 1; i < worker_count; i++)
+	{
+		if(thread_started[i])
+		{
+#if defined(_WIN32) || defined(_WIN64)
+			WaitForSingleObject(threads[i], INFINITE);
+			CloseHandle(threads[i]);
+#else
+			pthread_join(threads[i], NULL);
+#endif
+		}
+
+		result = result && work[i].result;
+	}
+
+	result = result && work[0].result;
+
+	if(!result || !CalculateAmigaROMMerkleRoot((const uint8_t (*)[32])merkle_tree->leaves, leaf_count, merkle_tree->root))
+	{
+		DestroyAmigaROMMerkleTree(merkle_tree);
+		return false;
+	}
+
+	return true;
+}
+
+// Combines leaf_count leaf hashes into a Merkle root.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMMerkleRoot(const uint8_t (*leaves)[32], const size_t leaf_count, uint8_t *root)
+{
+	uint8_t (*level)[32];
+	SHA256Context sha256_context;
+	const uint8_t node_prefix = 0x01;
+	size_t level_count, i;
+
+	if(!leaves || leaf_count == 0 || !root)
+	{
+		return false;
+	}
+
+	level = malloc(leaf_count * 32);
+	if(!level)
+	{
+		return false;
+	}
+
+	memcpy(level, leaves, leaf_count * 32);
+
+	// Each level is built in place over the one below it
+	for(level_count = leaf_count; level_count > 1; level_count = (level_count + 1) / 2)
+	{
+		for(i = 0; i + 1 < level_count; i += 2)
+		{
+			SHA256Init(&sha256_context);
+			SHA256Update(&sha256_context, &node_prefix, 1);
+			SHA256Update(&sha256_context, level[i], 32);
+			SHA256Update(&sha256_context, level[i + 1], 32);
+			SHA256Final(&sha256_context, level[i / 2]);
+		}
+
+		if(level_count % 2 != 0)
+		{
+			memmove(level[level_count / 2], level[level_count - 1], 32);
+		}
+	}
+
+	memcpy(root, level[0], 32);
+	free(level);
+
+	return true;
+}
+
+// Compares the leaves of a data_size byte image against reference_leaves and
+// writes up to max_ranges runs of differing bytes to damage_ranges (which may
+// be NULL if max_ranges is 0).  Leaves present in only one of the two lists
+// count as damaged.  Returns the total number of runs, which may be more
+// than max_ranges.
+size_t FindAmigaROMMerkleDamage(const uint8_t (*leaves)[32], const size_t leaf_count, const uint8_t (*reference_leaves)[32], const size_t reference_leaf_count, const size_t data_size, AmigaROMDamageRange *damage_ranges, const size_t max_ranges)
+{
+	size_t total_leaves, i, range_end;
+	size_t range_count = 0;
+	bool in_range = false;
+	bool damaged;
+
+	if(!leaves || !reference_leaves)
+	{
+		return 0;
+	}
+
+	total_leaves = (leaf_count > reference_leaf_count) ? leaf_count : reference_leaf_count;
+
+	for(i = 0; i < total_leaves; i++)
+	{
+		damaged = (i >= leaf_count || i >= reference_leaf_count || memcmp(leaves[i], reference_leaves[i], 32) != 0);
+
+		if(damaged && !in_range)
+		{
+			if(range_count < max_ranges && damage_ranges)
+			{
+				damage_ranges[range_count].offset = i * AMIGA_ROM_MERKLE_LEAF_SIZE;
+				damage_ranges[range_count].length = 0;
+			}
+
+			range_count++;
+		}
+
+		if(damaged && range_count <= max_ranges && damage_ranges)
+		{
+			// The dump's last leaf may be short; leaves past its end are whole
+			range_end = (i + 1) * AMIGA_ROM_MERKLE_LEAF_SIZE;
+			if(i < leaf_count && range_end > data_size)
+			{
+				range_end = data_size;
+			}
+
+			damage_ranges[range_count - 1].length = range_end - damage_ranges[range_count - 1].offset;
+		}
+
+		in_range = damaged;
+	}
+
+	return range_count;
+}
+
+static uint64_t MixAmigaROMMinHash(uint64_t value)
+{
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ULL;
+
+	return value ^ (value >> 33);
+}
+
+// Calculates the MinHash signature of the set of leaf_count leaves: for
+// each of the AMIGA_ROM_MERKLE_MINHASH_SIZE hash functions, the smallest
+// hash of any leaf.  Where the leaves are doesn't matter, so moved blocks
+// still match.  The fraction of values two signatures have in common
+// estimates the Jaccard similarity of their leaf sets.
+void CalculateAmigaROMMinHash(const uint8_t (*leaves)[32], const size_t leaf_count, uint32_t *minhash)
+{
+	uint64_t leaf_key;
+	uint32_t value;
+	size_t i, j;
+
+	for(i = 0; i < AMIGA_ROM_MERKLE_MINHASH_SIZE; i++)
+	{
+		minhash[i] = UINT32_MAX;
+	}
+
+	if(!leaves)
+	{
+		return;
+	}
+
+	for(i = 0; i < leaf_count; i++)
+	{
+		// The leaves are SHA256 digests already, so eight bytes of one are
+		// as good a key as all of it
+		leaf_key = 0;
+		for(j = 0; j < 8; j++)
+		{
+			leaf_key |= (uint64_t)leaves[i][j] << (j * 8);
+		}
+
+		for(j = 0; j < AMIGA_ROM_MERKLE_MINHASH_SIZE; j++)
+		{
+			value = (uint32_t)(MixAmigaROMMinHash(leaf_key ^ ((j + 1) * 0x9E3779B97F4A7C15ULL)) >> 32);
+			if(value < minhash[j])
+			{
+				minhash[j] = value;
+			}
+		}
+	}
+}
+
+// Returns the locality sensitive hashing key of one band of a MinHash
+// signature.  Keys of different bands never collide by design, so every
+// band can share one index.
+uint64_t GetAmigaROMMinHashBandKey(const uint32_t *minhash, const size_t band)
+{
+	const size_t rows = AMIGA_ROM_MERKLE_MINHASH_SIZE / AMIGA_ROM_MERKLE_MINHASH_BANDS;
+	uint64_t key = band;
+	size_t i;
+
+	for(i = 0; i < rows; i++)
+	{
+		key = MixAmigaROMMinHash(key ^ ((uint64_t)minhash[(band * rows) + i] << 8));
+	}
+
+	// The band goes in the low byte, so keys of different bands differ
+	return (key & ~(uint64_t)0xFF) | (uint64_t)band;
+}
@@ -0,0 +1,104 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMMERKLE_H
+#define AMIGAROMMERKLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Bytes of ROM data covered by each leaf of a Merkle fingerprint.  Each leaf
+// hash is the plain SHA256 digest of its block (the last block may be short),
+// and each parent is the SHA256 digest of 0x01 followed by its two children.
+// A node without a sibling is carried up to the next level unchanged.
+#define AMIGA_ROM_MERKLE_LEAF_SIZE   4096
+
+// Upper limit on the worker threads used to hash the leaves
+#define AMIGA_ROM_MERKLE_MAX_THREADS 64
+
+// Values in a MinHash signature of a set of leaves, and the locality
+// sensitive hashing bands they are split into.  Two images whose leaf sets
+// have Jaccard similarity J share at least one band key with probability
+// 1 - (1 - J^2)^16: 0.99 at J = 0.5, and still 0.5 at J = 0.2.
+#define AMIGA_ROM_MERKLE_MINHASH_SIZE  32
+#define AMIGA_ROM_MERKLE_MINHASH_BANDS 16
+
+typedef struct {
+	uint8_t root[32];
+	uint8_t (*leaves)[32];
+	size_t leaf_count;
+} AmigaROMMerkleTree;
+
+// A run of bytes whose leaves differ from a reference.
+typedef struct {
+	size_t offset;
+	size_t length;
+} AmigaROMDamageRange;
+
+// Create and return a new and initialized struct.
+// Pointers are NOT allocated, but are NULL instead.
+AmigaROMMerkleTree GetInitializedAmigaROMMerkleTree(void);
+
+// Frees the leaves and re-initializes the struct.
+void DestroyAmigaROMMerkleTree(AmigaROMMerkleTree *merkle_tree);
+
+// Hashes every AMIGA_ROM_MERKLE_LEAF_SIZE block of data, spread over
+// thread_count threads (0 picks one per online CPU), and combines the leaves
+// into the root.  Any leaves already in merkle_tree are freed first.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMMerkleTree(const uint8_t *data, const size_t data_size, const unsigned int thread_count, AmigaROMMerkleTree *merkle_tree);
+
+// Combines leaf_count leaf hashes into a Merkle root.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMMerkleRoot(const uint8_t (*leaves)[32], const size_t leaf_count, uint8_t *root);
+
+// Compares the leaves of a data_size byte image against reference_leaves and
+// writes up to max_ranges runs of differing bytes to damage_ranges (which may
+// be NULL if max_ranges is 0).  Leaves present in only one of the two lists
+// count as damaged.  Returns the total number of runs, which may be more
+// than max_ranges.
+size_t FindAmigaROMMerkleDamage(const uint8_t (*leaves)[32], const size_t leaf_count, const uint8_t (*reference_leaves)[32], const size_t reference_leaf_count, const size_t data_size, AmigaROMDamageRange *damage_ranges, const size_t max_ranges);
+
+// Calculates the MinHash signature of the set of leaf_count leaves: for
+// each of the AMIGA_ROM_MERKLE_MINHASH_SIZE hash functions, the smallest
+// hash of any leaf.  Where the leaves are doesn't matter, so moved blocks
+// still match.  The fraction of values two signatures have in common
+// estimates the Jaccard similarity of their leaf sets.
+void CalculateAmigaROMMinHash(const uint8_t (*leaves)[32], const size_t leaf_count, uint32_t *minhash);
+
+// Returns the locality sensitive hashing key of one band of a MinHash
+// signature.  Keys of different bands never collide by design, so every
+// band can share one index.
+uint64_t GetAmigaROMMinHashBandKey(const uint32_t *minhash, const size_t band);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
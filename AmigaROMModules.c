@@ -0,0 +1,222 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AmigaROMModules.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Units mixed into a module hash are tagged above their low 32 bits, so a
+// rebased pointer never hashes the same as plain data.
+#define AMIGA_ROM_MODULE_HASH_POINTER   0x100000000ULL
+#define AMIGA_ROM_MODULE_HASH_EXTERNAL  0x200000000ULL
+#define AMIGA_ROM_MODULE_HASH_BYTE      0x300000000ULL
+#define AMIGA_ROM_MODULE_HASH_BASIS     0xCBF29CE484222325ULL
+
+// ROMs are only ever mapped at a 64KB boundary
+#define AMIGA_ROM_MODULE_BASE_ALIGNMENT 0x10000
+
+static uint8_t GetModuleByte(const uint8_t *data, const size_t offset, const bool byte_swapped)
+{
+	return data[byte_swapped ? (offset ^ 1) : offset];
+}
+
+static uint16_t GetModuleWord(const uint8_t *data, const size_t offset, const bool byte_swapped)
+{
+	return (uint16_t)((GetModuleByte(data, offset, byte_swapped) << 8) | GetModuleByte(data, offset + 1, byte_swapped));
+}
+
+static uint32_t GetModuleLong(const uint8_t *data, const size_t offset, const bool byte_swapped)
+{
+	return ((uint32_t)GetModuleWord(data, offset, byte_swapped) << 16) | GetModuleWord(data, offset + 2, byte_swapped);
+}
+
+static uint64_t MixAmigaROMModuleHash(uint64_t hash, const uint64_t unit)
+{
+	hash = (hash ^ unit) * 0x9E3779B97F4A7C15ULL;
+
+	return hash ^ (hash >> 29);
+}
+
+// Reads the RomTag at offset into module, setting *base to the address the
+// image is mapped at and *end to the offset its end skip points to.
+// Returns false if there is no plausible RomTag at offset.
+static bool ReadAmigaROMResident(const uint8_t *data, const size_t data_size, const bool byte_swapped, const size_t offset, AmigaROMModule *module, uint32_t *base, size_t *end)
+{
+	uint32_t match_tag, end_skip, name_pointer;
+	size_t name_offset, i;
+	uint8_t c;
+
+	if(offset + AMIGA_ROM_RESIDENT_SIZE > data_size || GetModuleWord(data, offset, byte_swapped) != AMIGA_ROM_RESIDENT_MATCHWORD)
+	{
+		return false;
+	}
+
+	match_tag = GetModuleLong(data, offset + 2, byte_swapped);
+	if(match_tag < offset || (match_tag - offset) % AMIGA_ROM_MODULE_BASE_ALIGNMENT != 0)
+	{
+		return false;
+	}
+
+	*base = (uint32_t)(match_tag - offset);
+
+	name_pointer = GetModuleLong(data, offset + 14, byte_swapped);
+	if(name_pointer < *base || name_pointer - *base >= data_size)
+	{
+		return false;
+	}
+
+	name_offset = name_pointer - *base;
+	for(i = 0; i + 1 < sizeof(module->name) && name_offset + i < data_size; i++)
+	{
+		c = GetModuleByte(data, name_offset + i, byte_swapped);
+		if(c == '\0')
+		{
+			break;
+		}
+		else if(c < 0x20 || c >= 0x7F)
+		{
+			return false;
+		}
+
+		module->name[i] = (char)c;
+	}
+
+	if(i == 0)
+	{
+		return false;
+	}
+
+	module->name[i] = '\0';
+	module->version = GetModuleByte(data, offset + 11, byte_swapped);
+	module->node_type = GetModuleByte(data, offset + 12, byte_swapped);
+	module->priority = (int8_t)GetModuleByte(data, offset + 13, byte_swapped);
+	module->offset = offset;
+	module->length = 0;
+	module->hash = 0;
+	module->module_info = NULL;
+
+	// A missing or backwards end skip leaves just the RomTag itself
+	end_skip = GetModuleLong(data, offset + 6, byte_swapped);
+	if(end_skip >= *base && end_skip - *base > offset + AMIGA_ROM_RESIDENT_SIZE && end_skip - *base <= data_size)
+	{
+		*end = end_skip - *base;
+	}
+	else
+	{
+		*end = offset + AMIGA_ROM_RESIDENT_SIZE;
+	}
+
+	return true;
+}
+
+// Sets the length of a module found in an image mapped at base, and hashes
+// it with every pointer rebased.  A long word is only taken as a pointer if
+// it points into the image; anything else is hashed a word at a time.
+static void HashAmigaROMModule(const uint8_t *data, const size_t data_size, const bool byte_swapped, const uint32_t base, const size_t end, AmigaROMModule *module)
+{
+	uint64_t hash = AMIGA_ROM_MODULE_HASH_BASIS;
+	uint32_t module_address = base + (uint32_t)module->offset;
+	uint32_t value;
+	size_t i = module->offset;
+
+	module->length = end - module->offset;
+
+	while(i < end)
+	{
+		if(i + 4 <= end)
+		{
+			value = GetModuleLong(data, i, byte_swapped);
+			if(value >= module_address && value - module_address < module->length)
+			{
+				hash = MixAmigaROMModuleHash(hash, AMIGA_ROM_MODULE_HASH_POINTER | (value - module_address));
+				i += 4;
+				continue;
+			}
+			else if(value >= base && value - base < data_size)
+			{
+				hash = MixAmigaROMModuleHash(hash, AMIGA_ROM_MODULE_HASH_EXTERNAL);
+				i += 4;
+				continue;
+			}
+		}
+
+		if(i + 2 <= end)
+		{
+			hash = MixAmigaROMModuleHash(hash, GetModuleWord(data, i, byte_swapped));
+			i += 2;
+		}
+		else
+		{
+			hash = MixAmigaROMModuleHash(hash, AMIGA_ROM_MODULE_HASH_BYTE | GetModuleByte(data, i, byte_swapped));
+			i++;
+		}
+	}
+
+	module->hash = MixAmigaROMModuleHash(hash, module->length);
+}
+
+// Finds the resident modules of a data_size byte ROM image, which is read as
+// byte swapped if byte_swapped is true, and writes up to max_modules of them
+// to modules in address order.  A RomTag only counts if its match tag points
+// at itself from a base address on a 64KB boundary and its name points to a
+// printable string inside the image.  Returns the number written.
+size_t ScanAmigaROMModules(const uint8_t *data, const size_t data_size, const bool byte_swapped, AmigaROMModule *modules, const size_t max_modules)
+{
+	size_t scan_size = data_size & ~(size_t)1;
+	size_t module_count = 0;
+	size_t offset, end = 0, next_end;
+	uint32_t base = 0, next_base;
+
+	if(!data || !modules)
+	{
+		return 0;
+	}
+
+	for(offset = 0; offset + AMIGA_ROM_RESIDENT_SIZE <= scan_size && module_count < max_modules; offset += 2)
+	{
+		if(!ReadAmigaROMResident(data, scan_size, byte_swapped, offset, &modules[module_count], &next_base, &next_end))
+		{
+			continue;
+		}
+
+		// Each module ends where the next one starts, at the latest
+		if(module_count > 0)
+		{
+			HashAmigaROMModule(data, scan_size, byte_swapped, base, (end < offset) ? end : offset, &modules[module_count - 1]);
+		}
+
+		base = next_base;
+		end = next_end;
+		module_count++;
+	}
+
+	if(module_count > 0)
+	{
+		HashAmigaROMModule(data, scan_size, byte_swapped, base, end, &modules[module_count - 1]);
+	}
+
+	return module_count;
+}
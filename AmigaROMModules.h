@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMMODULES_H
+#define AMIGAROMMODULES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// The RTC_MATCHWORD (ILLEGAL instruction) every resident module's RomTag
+// starts with, followed by a pointer to itself.
+#define AMIGA_ROM_RESIDENT_MATCHWORD     0x4AFC
+
+// Size of a RomTag: match word, match tag, end skip, flags, version, type,
+// priority, and the name, ID string and init pointers.
+#define AMIGA_ROM_RESIDENT_SIZE          26
+
+// Longest resident module name kept; longer names are truncated.
+#define AMIGA_ROM_MODULE_MAX_NAME_LENGTH 64
+
+// Upper limit on the resident modules looked for in one ROM
+#define AMIGA_ROM_MAX_MODULES            256
+
+// Defined in the generated AmigaROMHashes.h
+struct AmigaROMModuleInfo;
+
+// A resident module found in a ROM image.  It runs from its RomTag at offset
+// to its end skip, or to the next RomTag if that comes first.  hash covers
+// those bytes with every pointer into the module replaced by its distance
+// from the RomTag, and every other pointer into the ROM by a placeholder, so
+// a module moved to another address (as in ReKick and Remus built ROMs)
+// hashes the same.  module_info is the known module it matches, or NULL.
+typedef struct {
+	char name[AMIGA_ROM_MODULE_MAX_NAME_LENGTH];
+	uint8_t version;
+	uint8_t node_type;
+	int8_t priority;
+	size_t offset;
+	size_t length;
+	uint64_t hash;
+	const struct AmigaROMModuleInfo *module_info;
+} AmigaROMModule;
+
+// Finds the resident modules of a data_size byte ROM image, which is read as
+// byte swapped if byte_swapped is true, and writes up to max_modules of them
+// to modules in address order.  A RomTag only counts if its match tag points
+// at itself from a base address on a 64KB boundary and its name points to a
+// printable string inside the image.  Returns the number written.
+size_t ScanAmigaROMModules(const uint8_t *data, const size_t data_size, const bool byte_swapped, AmigaROMModule *modules, const size_t max_modules);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,180 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "AmigaROMRepair.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define AMIGA_ROM_REPAIR_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AMIGA_ROM_REPAIR_NEON
+#endif
+
+static uint32_t CountAmigaROMFlippedBits(uint8_t difference)
+{
+	uint32_t bit_count = 0;
+
+	// Bit rot leaves few bits set, so this rarely loops more than once
+	while(difference)
+	{
+		difference &= (uint8_t)(difference - 1);
+		bit_count++;
+	}
+
+	return bit_count;
+}
+
+// Returns the offset of the first byte at or after offset where data and
+// reference differ, or data_size if there is none.  Identical 16-byte
+// blocks are skipped with a single compare.
+static size_t FindNextAmigaROMDifference(const uint8_t *data, const uint8_t *reference, const size_t data_size, size_t offset)
+{
+#if defined(AMIGA_ROM_REPAIR_SSE2)
+	for(; offset + 16 <= data_size; offset += 16)
+	{
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(data + offset)), _mm_loadu_si128((const __m128i*)(reference + offset)))) != 0xFFFF)
+		{
+			break;
+		}
+	}
+#elif defined(AMIGA_ROM_REPAIR_NEON)
+	uint8x16_t difference;
+	uint8x8_t folded;
+
+	for(; offset + 16 <= data_size; offset += 16)
+	{
+		difference = veorq_u8(vld1q_u8(data + offset), vld1q_u8(reference + offset));
+		folded = vorr_u8(vget_low_u8(difference), vget_high_u8(difference));
+		if(vget_lane_u64(vreinterpret_u64_u8(folded), 0) != 0)
+		{
+			break;
+		}
+	}
+#else
+	for(; offset + 8 <= data_size; offset += 8)
+	{
+		if(data[offset] != reference[offset] || data[offset + 1] != reference[offset + 1] || data[offset + 2] != reference[offset + 2] || data[offset + 3] != reference[offset + 3]
+			|| data[offset + 4] != reference[offset + 4] || data[offset + 5] != reference[offset + 5] || data[offset + 6] != reference[offset + 6] || data[offset + 7] != reference[offset + 7])
+		{
+			break;
+		}
+	}
+#endif
+
+	for(; offset < data_size; offset++)
+	{
+		if(data[offset] != reference[offset])
+		{
+			return offset;
+		}
+	}
+
+	return data_size;
+}
+
+// Compares data_size bytes of data against reference, skipping identical
+// 16-byte blocks with SIMD where available, and writes up to
+// max_differences runs of differing bytes to differences (which may be NULL
+// if max_differences is 0) in address order.  If summary isn't NULL, it is
+// set to the totals over every difference.  Returns the total number of
+// differences, which may be more than max_differences.
+size_t FindAmigaROMDifferences(const uint8_t *data, const uint8_t *reference, const size_t data_size, AmigaROMDifference *differences, const size_t max_differences, AmigaROMDifferenceSummary *summary)
+{
+	AmigaROMDifference difference;
+	size_t difference_count = 0;
+	size_t offset, next_offset;
+	uint32_t flipped_bits;
+
+	if(summary)
+	{
+		summary->differing_bytes = 0;
+		summary->flipped_bits = 0;
+		summary->bit_flip_count = 0;
+		summary->patch_count = 0;
+	}
+
+	if(!data || !reference)
+	{
+		return 0;
+	}
+
+	offset = FindNextAmigaROMDifference(data, reference, data_size, 0);
+	while(offset < data_size)
+	{
+		difference.offset = offset;
+		difference.flipped_bits = 0;
+
+		// Take in every differing byte until a long enough identical gap
+		do
+		{
+			flipped_bits = CountAmigaROMFlippedBits(data[offset] ^ reference[offset]);
+			difference.flipped_bits += flipped_bits;
+			difference.length = offset + 1 - difference.offset;
+
+			if(summary)
+			{
+				summary->differing_bytes++;
+				summary->flipped_bits += flipped_bits;
+			}
+
+			next_offset = FindNextAmigaROMDifference(data, reference, data_size, offset + 1);
+			if(next_offset - offset > AMIGA_ROM_DIFFERENCE_MERGE_GAP)
+			{
+				break;
+			}
+
+			offset = next_offset;
+		} while(offset < data_size);
+
+		difference.is_bit_flip = (difference.flipped_bits <= AMIGA_ROM_BIT_ROT_MAX_BITS);
+
+		if(summary)
+		{
+			if(difference.is_bit_flip)
+			{
+				summary->bit_flip_count++;
+			}
+			else
+			{
+				summary->patch_count++;
+			}
+		}
+
+		if(differences && difference_count < max_differences)
+		{
+			differences[difference_count] = difference;
+		}
+
+		difference_count++;
+		offset = next_offset;
+	}
+
+	return difference_count;
+}
@@ -0,0 +1,74 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef AMIGAROMREPAIR_H
+#define AMIGAROMREPAIR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Differing bytes closer together than this are counted as one difference
+#define AMIGA_ROM_DIFFERENCE_MERGE_GAP 4
+
+// Most bits a difference can flip and still be taken for bit rot rather
+// than a deliberate patch
+#define AMIGA_ROM_BIT_ROT_MAX_BITS     2
+
+// A run of bytes which differ from a reference image.  flipped_bits is how
+// many bits differ within it, and is_bit_flip is true if there are few
+// enough of them for the run to be decay rather than a patch.
+typedef struct {
+	size_t offset;
+	size_t length;
+	uint32_t flipped_bits;
+	bool is_bit_flip;
+} AmigaROMDifference;
+
+// Totals over every difference FindAmigaROMDifferences() finds.
+typedef struct {
+	size_t differing_bytes;
+	size_t flipped_bits;
+	size_t bit_flip_count;
+	size_t patch_count;
+} AmigaROMDifferenceSummary;
+
+// Compares data_size bytes of data against reference, skipping identical
+// 16-byte blocks with SIMD where available, and writes up to
+// max_differences runs of differing bytes to differences (which may be NULL
+// if max_differences is 0) in address order.  If summary isn't NULL, it is
+// set to the totals over every difference.  Returns the total number of
+// differences, which may be more than max_differences.
+size_t FindAmigaROMDifferences(const uint8_t *data, const uint8_t *reference, const size_t data_size, AmigaROMDifference *differences, const size_t max_differences, AmigaROMDifferenceSummary *summary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,283 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "AmigaROMSignatures.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define AMIGA_ROM_SIGNATURE(family, bytes) {family, bytes, sizeof(bytes) - 1}
+
+// Byte strings found in each family's ROMs.  Add to this table to recognize
+// more; it may hold up to 64 signatures.
+static const struct {
+	uint8_t family;
+	const char *bytes;
+	size_t length;
+} AMIGA_ROM_SIGNATURES[] = {
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A590_A2091, "A590/A2091"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A590_A2091, "2091 scsi.device"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A590_A2091, "WD33C93"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A4091, "4091 scsi.device"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A4091, "NCR 53C710"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A4091, "53C710"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CDTV, "cdtv.device"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CDTV, "bookmark.device"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CDTV, "playerprefs.library"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CDTV, "CDTV"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CD32, "cd.device"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CD32, "lowlevel.library"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CD32, "nonvolatile.library"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_CD32, "freeanim.library"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_ACTION_REPLAY, "ACTION REPLAY"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_ACTION_REPLAY, "Action Replay"),
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_ACTION_REPLAY, "Datel Electronics"),
+	// Kickstart style header jumping into the bootstrap at $F80000
+	AMIGA_ROM_SIGNATURE(AMIGA_ROM_FAMILY_A1000_BOOTSTRAP, "\x11\x11\x4E\xF9\x00\xF8")
+};
+
+#define AMIGA_ROM_SIGNATURE_COUNT (sizeof(AMIGA_ROM_SIGNATURES) / sizeof(AMIGA_ROM_SIGNATURES[0]))
+
+// The automaton needs up to a state per signature byte, and a byte class per
+// distinct signature byte plus one for the rest
+#define AMIGA_ROM_SIGNATURE_MAX_STATES  1024
+#define AMIGA_ROM_SIGNATURE_MAX_CLASSES 64
+
+static const char *AMIGA_ROM_FAMILY_NAMES[AMIGA_ROM_FAMILY_COUNT] = {
+	"Unknown",
+	"A590/A2091 SCSI controller",
+	"A4091 SCSI controller",
+	"CDTV extended",
+	"CD32 extended",
+	"Action Replay cartridge",
+	"A1000 bootstrap"
+};
+
+// Aho-Corasick automaton over every signature, flattened into a DFA.  Bytes
+// which appear in no signature share class 0, so the transition table only
+// needs a column per distinct signature byte.  signature_outputs holds a bit
+// per signature for every signature ending at that state.
+static uint8_t signature_byte_classes[256];
+static uint16_t signature_transitions[AMIGA_ROM_SIGNATURE_MAX_STATES][AMIGA_ROM_SIGNATURE_MAX_CLASSES];
+static uint64_t signature_outputs[AMIGA_ROM_SIGNATURE_MAX_STATES];
+static bool signature_automaton_built = false;
+
+// Adds length bytes of pattern to the trie as signature.  Returns false if
+// the automaton is full.
+static bool AddAmigaROMSignaturePattern(const uint8_t *pattern, const size_t length, const size_t signature, size_t *state_count)
+{
+	size_t state = 0;
+	size_t i;
+	uint8_t byte_class;
+
+	if(length == 0)
+	{
+		return true;
+	}
+
+	for(i = 0; i < length; i++)
+	{
+		byte_class = signature_byte_classes[pattern[i]];
+		if(signature_transitions[state][byte_class] == 0)
+		{
+			if(*state_count >= AMIGA_ROM_SIGNATURE_MAX_STATES)
+			{
+				return false;
+			}
+
+			signature_transitions[state][byte_class] = (uint16_t)*state_count;
+			(*state_count)++;
+		}
+
+		state = signature_transitions[state][byte_class];
+	}
+
+	signature_outputs[state] |= (uint64_t)1 << signature;
+
+	return true;
+}
+
+// Builds the signature automaton.  Runs before main() where the compiler
+// supports constructors; elsewhere it runs on first use, so scan one ROM
+// before sharing the library between threads.
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void BuildAmigaROMSignatureAutomaton(void)
+{
+	uint16_t failures[AMIGA_ROM_SIGNATURE_MAX_STATES];
+	uint16_t queue[AMIGA_ROM_SIGNATURE_MAX_STATES];
+	const uint8_t *bytes;
+	size_t class_count = 1;
+	size_t state_count = 1;
+	size_t queue_start = 0;
+	size_t queue_end = 0;
+	size_t state, child, i, j;
+
+	if(signature_automaton_built || AMIGA_ROM_SIGNATURE_COUNT > 64)
+	{
+		return;
+	}
+
+	memset(signature_byte_classes, 0, sizeof(signature_byte_classes));
+	memset(signature_transitions, 0, sizeof(signature_transitions));
+	memset(signature_outputs, 0, sizeof(signature_outputs));
+
+	for(i = 0; i < AMIGA_ROM_SIGNATURE_COUNT; i++)
+	{
+		bytes = (const uint8_t*)AMIGA_ROM_SIGNATURES[i].bytes;
+		for(j = 0; j < AMIGA_ROM_SIGNATURES[i].length; j++)
+		{
+			if(signature_byte_classes[bytes[j]] == 0)
+			{
+				if(class_count >= AMIGA_ROM_SIGNATURE_MAX_CLASSES)
+				{
+					return;
+				}
+
+				signature_byte_classes[bytes[j]] = (uint8_t)class_count++;
+			}
+		}
+	}
+
+	for(i = 0; i < AMIGA_ROM_SIGNATURE_COUNT; i++)
+	{
+		bytes = (const uint8_t*)AMIGA_ROM_SIGNATURES[i].bytes;
+		if(!AddAmigaROMSignaturePattern(bytes, AMIGA_ROM_SIGNATURES[i].length, i, &state_count))
+		{
+			return;
+		}
+	}
+
+	// Breadth first, so every state's failure state is complete before its
+	// children need it
+	failures[0] = 0;
+	queue[queue_end++] = 0;
+	while(queue_start < queue_end)
+	{
+		state = queue[queue_start++];
+		for(i = 0; i < class_count; i++)
+		{
+			child = signature_transitions[state][i];
+			if(child != 0)
+			{
+				failures[child] = (state == 0) ? 0 : signature_transitions[failures[state]][i];
+				signature_outputs[child] |= signature_outputs[failures[child]];
+				queue[queue_end++] = (uint16_t)child;
+			}
+			else if(state != 0)
+			{
+				signature_transitions[state][i] = signature_transitions[failures[state]][i];
+			}
+		}
+	}
+
+	signature_automaton_built = true;
+}
+
+// Scans data_size bytes of data once for every family's signatures, as
+// stored or in a byte swapped image, and returns the family with the most
+// distinct signatures found (the lowest numbered one on a tie), or
+// AMIGA_ROM_FAMILY_UNKNOWN if none are.  If signature_count isn't NULL, it
+// is set to how many of that family's signatures were found.
+uint8_t ScanAmigaROMSignatures(const uint8_t *data, const size_t data_size, size_t *signature_count)
+{
+	size_t family_counts[AMIGA_ROM_FAMILY_COUNT] = {0};
+	uint64_t found_signatures = 0;
+	uint8_t best_family = AMIGA_ROM_FAMILY_UNKNOWN;
+	size_t state = 0;
+	size_t swapped_state = 0;
+	size_t i;
+
+	if(signature_count)
+	{
+		*signature_count = 0;
+	}
+
+	if(!data)
+	{
+		return AMIGA_ROM_FAMILY_UNKNOWN;
+	}
+
+	if(!signature_automaton_built)
+	{
+		BuildAmigaROMSignatureAutomaton();
+		if(!signature_automaton_built)
+		{
+			return AMIGA_ROM_FAMILY_UNKNOWN;
+		}
+	}
+
+	// A second copy of the automaton reads the data with each pair of bytes
+	// swapped back, so signatures are matched whole in byte swapped images
+	// wherever they start.  A trailing odd byte has no partner to swap with.
+	for(i = 0; i < data_size; i++)
+	{
+		state = signature_transitions[state][signature_byte_classes[data[i]]];
+		found_signatures |= signature_outputs[state];
+
+		if((i ^ 1) < data_size)
+		{
+			swapped_state = signature_transitions[swapped_state][signature_byte_classes[data[i ^ 1]]];
+			found_signatures |= signature_outputs[swapped_state];
+		}
+	}
+
+	for(i = 0; i < AMIGA_ROM_SIGNATURE_COUNT; i++)
+	{
+		if(found_signatures & ((uint64_t)1 << i))
+		{
+			family_counts[AMIGA_ROM_SIGNATURES[i].family]++;
+		}
+	}
+
+	for(i = 1; i < AMIGA_ROM_FAMILY_COUNT; i++)
+	{
+		if(family_counts[i] > family_counts[best_family])
+		{
+			best_family = (uint8_t)i;
+		}
+	}
+
+	if(signature_count)
+	{
+		*signature_count = family_counts[best_family];
+	}
+
+	return best_family;
+}
+
+// Returns a short name for an AMIGA_ROM_FAMILY_* value, or NULL if it isn't
+// one.
+const char* GetAmigaROMFamilyName(const uint8_t family)
+{
+	if(family >= AMIGA_ROM_FAMILY_COUNT)
+	{
+		return NULL;
+	}
+
+	return AMIGA_ROM_FAMILY_NAMES[family];
+}
@@ -0,0 +1,61 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef AMIGAROMSIGNATURES_H
+#define AMIGAROMSIGNATURES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Families of non-Kickstart ROMs ScanAmigaROMSignatures() recognizes
+#define AMIGA_ROM_FAMILY_UNKNOWN         0
+#define AMIGA_ROM_FAMILY_A590_A2091      1
+#define AMIGA_ROM_FAMILY_A4091           2
+#define AMIGA_ROM_FAMILY_CDTV            3
+#define AMIGA_ROM_FAMILY_CD32            4
+#define AMIGA_ROM_FAMILY_ACTION_REPLAY   5
+#define AMIGA_ROM_FAMILY_A1000_BOOTSTRAP 6
+#define AMIGA_ROM_FAMILY_COUNT           7
+
+// Scans data_size bytes of data once for every family's signatures, as
+// stored or in a byte swapped image, and returns the family with the most
+// distinct signatures found (the lowest numbered one on a tie), or
+// AMIGA_ROM_FAMILY_UNKNOWN if none are.  If signature_count isn't NULL, it
+// is set to how many of that family's signatures were found.
+uint8_t ScanAmigaROMSignatures(const uint8_t *data, const size_t data_size, size_t *signature_count);
+
+// Returns a short name for an AMIGA_ROM_FAMILY_* value, or NULL if it isn't
+// one.
+const char* GetAmigaROMFamilyName(const uint8_t family);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -23,8 +23,12 @@ SOFTWARE.
 */
 
 #include "AmigaROMUtil.h"
+#include "AmigaROMDatabase.h"
+#include "AmigaROMDigests.h"
 #include "AmigaROMHashes.h"
 #include "AmigaROMMajorMinorVersions.h"
+#include "AmigaROMMerkle.h"
+#include "teeny-sha256.h"
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -104,7 +108,21 @@ SOFTWARE.
 #define AMIGA_512_REKICK_ROM_HEADER          0x11164EF9 //TODO: Properly detect size/handle these
 #define AMIGA_512_REKICK_ROM_HEADER_BYTESWAP 0x1611F94E //TODO: Properly detect size/handle these
 
-extern int SHA256(const uint8_t* msg, size_t msgLen, uint8_t* digest, char* hexDigest);
+// Bytes of an encrypted ROM decrypted and hashed at a time
+#define AMIGA_ROM_CRYPT_CHUNK_SIZE           16384
+
+// Bytes of a ROM file read at a time by the fused read, a multiple of
+// AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL
+#define AMIGA_ROM_READ_CHUNK_SIZE            65536
+
+static ParsedAmigaROMData ReadParsedAmigaROM(const char *rom_file_path, const char *keyfile_path, const uint8_t requested_digests, const uint16_t parse_fields);
+static bool ReadAndParseAmigaROMFile(FILE *fp, ParsedAmigaROMData *amiga_rom);
+static void StoreAmigaROMDigests(ParsedAmigaROMData *amiga_rom, const uint8_t new_digest_types, const AmigaROMDigests *new_digests);
+static uint16_t AddAmigaROMFieldDependencies(const uint16_t fields);
+static int DetectAmigaROMByteSwapFromInfo(const ParsedAmigaROMData *amiga_rom, const AmigaROMInfo *rom_info);
+static void ReadAmigaROMVersionNumbers(const ParsedAmigaROMData *amiga_rom, uint16_t *major_version, uint16_t *minor_version);
+static void FreeAmigaROMModules(ParsedAmigaROMData *amiga_rom);
+static bool AreAmigaROMHalvesOfOneROM(const AmigaROMInfo *hi_info, const AmigaROMInfo *lo_info);
 
 // Create and return a new and initialized struct.
 // Pointers are NOT allocated, but are NULL instead.
@@ -114,6 +132,8 @@ ParsedAmigaROMData GetInitializedAmigaROM(void)
 
 	amiga_rom.is_initialized = true;
 	amiga_rom.parsed_rom = false;
+	amiga_rom.parse_fields = AMIGA_ROM_FIELD_ALL;
+	amiga_rom.valid_fields = AMIGA_ROM_FIELD_NONE;
 	amiga_rom.rom_data = NULL;
 	amiga_rom.rom_size = 0;
 	amiga_rom.validated_size = false;
@@ -125,12 +145,21 @@ ParsedAmigaROMData GetInitializedAmigaROM(void)
 	amiga_rom.has_valid_checksum = false;
 	amiga_rom.header = 0;
 	amiga_rom.type = 'U';
+	amiga_rom.family = AMIGA_ROM_FAMILY_UNKNOWN;
 	amiga_rom.version = NULL;
 	amiga_rom.major_version = 0;
 	amiga_rom.minor_version = 0xffff;
 	amiga_rom.major_minor_version = NULL;
 	amiga_rom.is_kickety_split = false;
 	amiga_rom.valid_footer = false;
+	amiga_rom.requested_digests = AMIGA_ROM_DIGEST_SHA256;
+	memset(&(amiga_rom.digests), 0, sizeof(amiga_rom.digests));
+	amiga_rom.rom_info = NULL;
+	amiga_rom.is_info_unconfirmed = false;
+	amiga_rom.sha256_checkpoints = NULL;
+	amiga_rom.sha256_checkpoint_count = 0;
+	amiga_rom.modules = NULL;
+	amiga_rom.module_count = 0;
 
 	return amiga_rom;
 }
@@ -157,6 +186,10 @@ AmigaROMInfoData GetInitializedAmigaROMInfoData(void)
 	rom_info.detected_embedded_rom_version = NULL;
 	rom_info.is_kickety_split = NULL;
 	rom_info.has_valid_footer = NULL;
+	rom_info.crc32 = NULL;
+	rom_info.md5 = NULL;
+	rom_info.sha1 = NULL;
+	rom_info.sha256 = NULL;
 
 	return rom_info;
 }
@@ -168,6 +201,8 @@ void DestroyInitializedAmigaROM(ParsedAmigaROMData *amiga_rom)
 {
 	amiga_rom->is_initialized = false;
 	amiga_rom->parsed_rom = false;
+	amiga_rom->parse_fields = AMIGA_ROM_FIELD_ALL;
+	amiga_rom->valid_fields = AMIGA_ROM_FIELD_NONE;
 
 	if(amiga_rom->rom_data)
 	{
@@ -185,12 +220,20 @@ void DestroyInitializedAmigaROM(ParsedAmigaROMData *amiga_rom)
 	amiga_rom->has_valid_checksum = false;
 	amiga_rom->header = 0;
 	amiga_rom->type = 'U';
+	amiga_rom->family = AMIGA_ROM_FAMILY_UNKNOWN;
 	amiga_rom->version = NULL;
 	amiga_rom->major_version = 0;
 	amiga_rom->minor_version = 0xffff;
 	amiga_rom->major_minor_version = NULL;
 	amiga_rom->is_kickety_split = false;
 	amiga_rom->valid_footer = false;
+	InvalidateAmigaROMDigest(amiga_rom);
+
+	if(amiga_rom->sha256_checkpoints)
+	{
+		free(amiga_rom->sha256_checkpoints);
+		amiga_rom->sha256_checkpoints = NULL;
+	}
 }
 
 // Free all pointers which are currently allocated and
@@ -292,17 +335,79 @@ void DestroyInitializedAmigaROMInfoData(AmigaROMInfoData *rom_info)
 		free(rom_info->has_valid_footer);
 		rom_info->has_valid_footer = NULL;
 	}
+
+	if(rom_info->crc32)
+	{
+		free(rom_info->crc32);
+		rom_info->crc32 = NULL;
+	}
+
+	if(rom_info->md5)
+	{
+		free(rom_info->md5);
+		rom_info->md5 = NULL;
+	}
+
+	if(rom_info->sha1)
+	{
+		free(rom_info->sha1);
+		rom_info->sha1 = NULL;
+	}
+
+	if(rom_info->sha256)
+	{
+		free(rom_info->sha256);
+		rom_info->sha256 = NULL;
+	}
 }
 
 // Returns a parsed ROM data struct, with the ROM data and size included.
 // If anything files, parsed_rom will be false.  If encrypted, the ROM
-// will be decrypted.
+// will be decrypted.  The ROM is identified by its structural fingerprint
+// where that is enough, leaving the match unconfirmed; see ParseAmigaROMData.
 ParsedAmigaROMData ReadAmigaROM(const char *rom_file_path, const char *keyfile_path)
+{
+	return ReadAmigaROMWithDigests(rom_file_path, keyfile_path, AMIGA_ROM_DIGEST_NONE);
+}
+
+// Same as ReadAmigaROM, but also calculates the digests selected by
+// requested_digests (AMIGA_ROM_DIGEST_* bits) in a single pass.  Requesting
+// AMIGA_ROM_DIGEST_SHA256 always confirms the identification by digest.
+ParsedAmigaROMData ReadAmigaROMWithDigests(const char *rom_file_path, const char *keyfile_path, const uint8_t requested_digests)
+{
+	return ReadParsedAmigaROM(rom_file_path, keyfile_path, requested_digests, AMIGA_ROM_FIELD_ALL);
+}
+
+// Same as ReadAmigaROM, but parses the ROM lazily: the file is read and
+// decrypted, and every other field is left to be worked out on first access
+// through the accessors, so a ROM which is only split, swapped or written
+// never has the rest of its analysis done.
+ParsedAmigaROMData ReadAmigaROMLazily(const char *rom_file_path, const char *keyfile_path)
+{
+	return ReadParsedAmigaROM(rom_file_path, keyfile_path, AMIGA_ROM_DIGEST_NONE, AMIGA_ROM_FIELD_NONE);
+}
+
+// Same as ReadAmigaROMWithDigests, but only works out the fields selected by
+// parse_fields (AMIGA_ROM_FIELD_* bits), and those they depend on, up front.
+// Stages no field in the profile needs aren't run at all: the digests are
+// only calculated for AMIGA_ROM_FIELD_DIGESTS, or for AMIGA_ROM_FIELD_INFO
+// when the fingerprint can't pick out a single ROM, so a profile of just
+// AMIGA_ROM_FIELD_CHECKSUM validates a ROM without hashing it.
+ParsedAmigaROMData ReadAmigaROMWithProfile(const char *rom_file_path, const char *keyfile_path, const uint8_t requested_digests, const uint16_t parse_fields)
+{
+	return ReadParsedAmigaROM(rom_file_path, keyfile_path, requested_digests, parse_fields);
+}
+
+static ParsedAmigaROMData ReadParsedAmigaROM(const char *rom_file_path, const char *keyfile_path, const uint8_t requested_digests, const uint16_t parse_fields)
 {
 	FILE *fp;
 
 	ParsedAmigaROMData amiga_rom = GetInitializedAmigaROM();
 	int seek_status;
+	bool parsed_while_reading;
+
+	amiga_rom.requested_digests = requested_digests;
+	amiga_rom.parse_fields = parse_fields;
 
 	if(!rom_file_path)
 	{
@@ -336,11 +441,14 @@ ParsedAmigaROMData ReadAmigaROM(const char *rom_file_path, const char *keyfile_p
 		return amiga_rom;
 	}
 
-	fread(amiga_rom.rom_data, 1, amiga_rom.rom_size, fp);
+	parsed_while_reading = ReadAndParseAmigaROMFile(fp, &amiga_rom);
 
 	fclose(fp);
 
-	ParseAmigaROMData(&amiga_rom, keyfile_path);
+	if(!parsed_while_reading)
+	{
+		ParseAmigaROMData(&amiga_rom, keyfile_path);
+	}
 
 	if(amiga_rom.parsed_rom)
 	{
@@ -356,6 +464,202 @@ ParsedAmigaROMData ReadAmigaROM(const char *rom_file_path, const char *keyfile_p
 	return amiga_rom;
 }
 
+// Reads a ROM file into amiga_rom->rom_data, which must already be
+// allocated to amiga_rom->rom_size, AMIGA_ROM_READ_CHUNK_SIZE bytes at a time.
+// Each chunk is checksummed and hashed while it is still in cache, and the
+// header, reset vector, size and footer are captured as they go past, so an
+// unencrypted ROM is validated and identified in one pass over its data
+// instead of one for each check.  Only the stages parse_fields needs are run.
+// The last 24 bytes are read ahead of the rest so that the fingerprint can
+// decide whether the SHA256 digest is needed before the first chunk is
+// hashed.  Returns true if the ROM was parsed, or false if the file was only
+// read, because it is encrypted, too small, of an invalid size or needs no
+// pass over its data, and ParseAmigaROMData() still needs to be called.
+static bool ReadAndParseAmigaROMFile(FILE *fp, ParsedAmigaROMData *amiga_rom)
+{
+	AmigaROMDigestContext digest_context;
+	AmigaROMDigests new_digests;
+	const AmigaROMInfo *fingerprint_rom = NULL;
+	const uint32_t *rom_data_32;
+	uint32_t *test_ptr;
+	uint64_t sum = 0;
+	uint16_t parse_fields, parsed_fields;
+	uint8_t digest_types;
+	size_t offset, read_size, chunk_offset, chunk_size, checkpoint, i;
+	int fingerprint_match = AMIGA_ROM_FINGERPRINT_NO_MATCH;
+	bool record_checkpoints;
+
+	parse_fields = AddAmigaROMFieldDependencies(amiga_rom->parse_fields);
+	parsed_fields = parse_fields & (AMIGA_ROM_FIELD_SIZE | AMIGA_ROM_FIELD_RESET_VECTOR | AMIGA_ROM_FIELD_INFO | AMIGA_ROM_FIELD_CHECKSUM | AMIGA_ROM_FIELD_HEADER | AMIGA_ROM_FIELD_FOOTER | AMIGA_ROM_FIELD_DIGESTS);
+
+	read_size = amiga_rom->rom_size;
+	if(read_size > AMIGA_ROM_READ_CHUNK_SIZE)
+	{
+		read_size = AMIGA_ROM_READ_CHUNK_SIZE;
+	}
+
+	offset = fread(amiga_rom->rom_data, 1, read_size, fp);
+
+	if(offset != read_size || !(parse_fields & (AMIGA_ROM_FIELD_INFO | AMIGA_ROM_FIELD_CHECKSUM | AMIGA_ROM_FIELD_DIGESTS)) || amiga_rom->rom_size < 256 || DetectAmigaROMEncryption(amiga_rom) != 0 || !ValidateAmigaROMSize(amiga_rom))
+	{
+		fread(&(amiga_rom->rom_data)[offset], 1, amiga_rom->rom_size - offset, fp);
+		return false;
+	}
+
+	if((parse_fields & AMIGA_ROM_FIELD_INFO) && read_size < amiga_rom->rom_size)
+	{
+		if(fseek(fp, (long)(amiga_rom->rom_size - 24), SEEK_SET) != 0 || fread(&(amiga_rom->rom_data)[amiga_rom->rom_size - 24], 1, 24, fp) != 24 || fseek(fp, (long)read_size, SEEK_SET) != 0)
+		{
+			fseek(fp, (long)read_size, SEEK_SET);
+			fread(&(amiga_rom->rom_data)[read_size], 1, amiga_rom->rom_size - read_size, fp);
+			return false;
+		}
+	}
+
+	digest_types = AMIGA_ROM_DIGEST_NONE;
+	if(parse_fields & (AMIGA_ROM_FIELD_INFO | AMIGA_ROM_FIELD_DIGESTS))
+	{
+		digest_types = amiga_rom->requested_digests & AMIGA_ROM_DIGEST_ALL;
+	}
+
+	if(parse_fields & AMIGA_ROM_FIELD_INFO)
+	{
+		fingerprint_match = MatchAmigaROMFingerprint(amiga_rom, &fingerprint_rom);
+		if(fingerprint_match == AMIGA_ROM_FINGERPRINT_NEEDS_DIGEST)
+		{
+			digest_types |= AMIGA_ROM_DIGEST_SHA256;
+		}
+	}
+
+	record_checkpoints = (digest_types & AMIGA_ROM_DIGEST_SHA256) != 0;
+	if(record_checkpoints)
+	{
+		test_ptr = realloc(amiga_rom->sha256_checkpoints, ((amiga_rom->rom_size + AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL - 1) / AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL) * 8 * sizeof(uint32_t));
+		if(test_ptr)
+		{
+			amiga_rom->sha256_checkpoints = test_ptr;
+		}
+		else
+		{
+			record_checkpoints = false;
+		}
+	}
+
+	InitAmigaROMDigestContext(&digest_context, digest_types);
+
+	if(parse_fields & AMIGA_ROM_FIELD_HEADER)
+	{
+		amiga_rom->header = DetectAmigaKickstartROMTypeFromHeader(amiga_rom);
+	}
+
+	if(parse_fields & AMIGA_ROM_FIELD_RESET_VECTOR)
+	{
+		amiga_rom->has_reset_vector = ValidateAmigaROMResetVector(amiga_rom);
+	}
+
+	checkpoint = 0;
+	for(offset = 0; offset < amiga_rom->rom_size; offset += read_size)
+	{
+		if(offset > 0)
+		{
+			read_size = amiga_rom->rom_size - offset;
+			if(read_size > AMIGA_ROM_READ_CHUNK_SIZE)
+			{
+				read_size = AMIGA_ROM_READ_CHUNK_SIZE;
+			}
+
+			// The caller parses whatever was read, as it always has
+			if(fread(&(amiga_rom->rom_data)[offset], 1, read_size, fp) != read_size)
+			{
+				return false;
+			}
+		}
+
+		for(chunk_offset = offset; chunk_offset < offset + read_size; chunk_offset += chunk_size)
+		{
+			chunk_size = offset + read_size - chunk_offset;
+			if(chunk_size > AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL)
+			{
+				chunk_size = AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL;
+			}
+
+			if(record_checkpoints)
+			{
+				memcpy(&(amiga_rom->sha256_checkpoints)[checkpoint * 8], digest_context.sha256.state, 8 * sizeof(uint32_t));
+				checkpoint++;
+			}
+
+			if(digest_types != AMIGA_ROM_DIGEST_NONE)
+			{
+				UpdateAmigaROMDigestContext(&digest_context, &(amiga_rom->rom_data)[chunk_offset], chunk_size);
+			}
+
+			// Summing into 64 bits defers the end-around carries to the end
+			if(parse_fields & AMIGA_ROM_FIELD_CHECKSUM)
+			{
+				rom_data_32 = (const uint32_t*)&(amiga_rom->rom_data)[chunk_offset];
+				for(i = 0; i < chunk_size / 4; i++)
+				{
+					sum += be32toh(rom_data_32[i]);
+				}
+			}
+		}
+	}
+
+	if(parse_fields & AMIGA_ROM_FIELD_SIZE)
+	{
+		amiga_rom->validated_size = ValidateEmbeddedAmigaROMSize(amiga_rom);
+	}
+
+	if(parse_fields & AMIGA_ROM_FIELD_FOOTER)
+	{
+		amiga_rom->valid_footer = ValidateAmigaKickstartROMFooter(amiga_rom);
+	}
+
+	if(parse_fields & AMIGA_ROM_FIELD_CHECKSUM)
+	{
+		while(sum >> 32)
+		{
+			sum = (sum & 0xFFFFFFFF) + (sum >> 32);
+		}
+
+		amiga_rom->has_valid_checksum = (sum == 0xFFFFFFFF);
+	}
+
+	if(digest_types != AMIGA_ROM_DIGEST_NONE)
+	{
+		FinalizeAmigaROMDigestContext(&digest_context, &new_digests);
+
+		if(record_checkpoints)
+		{
+			amiga_rom->sha256_checkpoint_count = checkpoint;
+		}
+
+		StoreAmigaROMDigests(amiga_rom, digest_types, &new_digests);
+	}
+
+	if(parse_fields & AMIGA_ROM_FIELD_INFO)
+	{
+		// As in IdentifyParsedAmigaROM(), a fingerprint match stands in for
+		// the digest until it is confirmed
+		if(!(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256))
+		{
+			amiga_rom->rom_info = (fingerprint_match == AMIGA_ROM_FINGERPRINT_UNIQUE) ? fingerprint_rom : NULL;
+			amiga_rom->is_info_unconfirmed = (amiga_rom->rom_info != NULL);
+		}
+
+		amiga_rom->type = (amiga_rom->rom_info) ? amiga_rom->rom_info->type : 'U';
+		amiga_rom->version = (amiga_rom->rom_info) ? amiga_rom->rom_info->version : NULL;
+	}
+
+	amiga_rom->parsed_rom = true;
+	amiga_rom->valid_fields |= parsed_fields;
+
+	EnsureAmigaROMFields(amiga_rom, amiga_rom->parse_fields);
+
+	return true;
+}
+
 // Detect whether a ROM is an Amiga kickstart ROM based on size, header, reset vector,
 // magic, and footer.
 bool IsAmigaROM(const ParsedAmigaROMData *amiga_rom)
@@ -378,16 +682,45 @@ bool IsAmigaROM(const ParsedAmigaROMData *amiga_rom)
 	return true;
 }
 
+// Appends line and a newline to output_string, which already holds
+// *output_length characters.  NULL lines are skipped, and output which
+// doesn't fit is truncated.
+static void AppendAmigaROMInfoLine(char *output_string, const size_t string_length, size_t *output_length, const char *line)
+{
+	int written;
+
+	if(!line || *output_length + 1 >= string_length)
+	{
+		return;
+	}
+
+	written = snprintf(output_string + *output_length, string_length - *output_length, "%s\n", line);
+
+	if(written > 0)
+	{
+		*output_length += (size_t)written;
+
+		if(*output_length >= string_length)
+		{
+			*output_length = string_length - 1;
+		}
+	}
+}
+
 // Puts ROM info data into output_string
 void PrintAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, char *output_string, const size_t string_length)
 {
 	AmigaROMInfoData rom_info = GetInitializedAmigaROMInfoData();
+	char hex_digest[65];
+	size_t output_length;
 
-	if(!amiga_rom || !output_string)
+	if(!amiga_rom || !output_string || string_length == 0)
 	{
 		return;
 	}
 
+	output_string[0] = '\0';
+
 	rom_info.successfully_parsed = (char *)malloc(64);
 	if(!rom_info.successfully_parsed)
 	{
@@ -506,7 +839,14 @@ void PrintAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, char *output_string,
 			snprintf(rom_info.rom_type, 64, "ROM type:\t\t\tMerged Kickstart ROM");
 			break;
 		case 'O':
-			snprintf(rom_info.rom_type, 64, "ROM type:\t\t\tNon-Kickstart Amiga ROM");
+			if(amiga_rom->family != AMIGA_ROM_FAMILY_UNKNOWN)
+			{
+				snprintf(rom_info.rom_type, 64, "ROM type:\t\t\tNon-Kickstart Amiga ROM (%s)", GetAmigaROMFamilyName(amiga_rom->family));
+			}
+			else
+			{
+				snprintf(rom_info.rom_type, 64, "ROM type:\t\t\tNon-Kickstart Amiga ROM");
+			}
 			break;
 		case 'U':
 		default:
@@ -514,13 +854,13 @@ void PrintAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, char *output_string,
 			break;
 	}
 
-	rom_info.rom_version = (char *)malloc(143);
+	rom_info.rom_version = (char *)malloc(176);
 	if(!rom_info.rom_version)
 	{
 		DestroyInitializedAmigaROMInfoData(&rom_info);
 		return;
 	}
-	snprintf(rom_info.rom_version, 143, "ROM version:\t\t\t%s", amiga_rom->version);
+	snprintf(rom_info.rom_version, 176, "ROM version:\t\t\t%s%s", amiga_rom->version, amiga_rom->is_info_unconfirmed ? " (fingerprint match, unconfirmed)" : "");
 
 	rom_info.embedded_rom_major_version = (char *)malloc(64);
 	if(!rom_info.embedded_rom_major_version)
@@ -579,29 +919,232 @@ void PrintAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, char *output_string,
 	}
 	snprintf(rom_info.has_valid_footer, 64, "ROM has valid footer:\t\t%d", amiga_rom->valid_footer);
 
-	snprintf(output_string, string_length, "ROM Info:\n\n");
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.successfully_parsed);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_size_validated);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.has_reset_vector);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_is_encrypted);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.can_decrypt_rom);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.successfully_decrypted_rom);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_is_byte_swapped);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_has_valid_checksum);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_header_info);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_type);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.rom_version);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.embedded_rom_major_version);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.embedded_rom_minor_version);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.detected_embedded_rom_version);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.is_kickety_split);
-	snprintf(output_string, string_length, "%s%s\n", output_string, rom_info.has_valid_footer);
+	if(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_CRC32)
+	{
+		rom_info.crc32 = (char *)malloc(64);
+		if(!rom_info.crc32)
+		{
+			DestroyInitializedAmigaROMInfoData(&rom_info);
+			return;
+		}
+		snprintf(rom_info.crc32, 64, "CRC32:\t\t\t\t%08x", (unsigned int)amiga_rom->digests.crc32);
+	}
+
+	if(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_MD5)
+	{
+		rom_info.md5 = (char *)malloc(80);
+		if(!rom_info.md5)
+		{
+			DestroyInitializedAmigaROMInfoData(&rom_info);
+			return;
+		}
+		FormatAmigaROMDigest(amiga_rom->digests.md5, sizeof(amiga_rom->digests.md5), hex_digest);
+		snprintf(rom_info.md5, 80, "MD5:\t\t\t\t%s", hex_digest);
+	}
+
+	if(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA1)
+	{
+		rom_info.sha1 = (char *)malloc(80);
+		if(!rom_info.sha1)
+		{
+			DestroyInitializedAmigaROMInfoData(&rom_info);
+			return;
+		}
+		FormatAmigaROMDigest(amiga_rom->digests.sha1, sizeof(amiga_rom->digests.sha1), hex_digest);
+		snprintf(rom_info.sha1, 80, "SHA-1:\t\t\t\t%s", hex_digest);
+	}
+
+	if(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256)
+	{
+		rom_info.sha256 = (char *)malloc(80);
+		if(!rom_info.sha256)
+		{
+			DestroyInitializedAmigaROMInfoData(&rom_info);
+			return;
+		}
+		FormatAmigaROMDigest(amiga_rom->digests.sha256, sizeof(amiga_rom->digests.sha256), hex_digest);
+		snprintf(rom_info.sha256, 80, "SHA-256:\t\t\t%s", hex_digest);
+	}
+
+	output_length = 0;
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, "ROM Info:\n");
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.successfully_parsed);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_size_validated);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.has_reset_vector);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_is_encrypted);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.can_decrypt_rom);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.successfully_decrypted_rom);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_is_byte_swapped);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_has_valid_checksum);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_header_info);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_type);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.rom_version);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.embedded_rom_major_version);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.embedded_rom_minor_version);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.detected_embedded_rom_version);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.is_kickety_split);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.has_valid_footer);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.crc32);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.md5);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.sha1);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, rom_info.sha256);
 
 	DestroyInitializedAmigaROMInfoData(&rom_info);
 }
 
+// Appends text to output_string, which already holds *output_length
+// characters.  Text which doesn't fit is truncated.
+static void AppendAmigaROMInfoText(char *output_string, const size_t string_length, size_t *output_length, const char *text)
+{
+	size_t text_length = strlen(text);
+
+	if(*output_length + 1 >= string_length)
+	{
+		return;
+	}
+
+	if(text_length > string_length - *output_length - 1)
+	{
+		text_length = string_length - *output_length - 1;
+	}
+
+	memcpy(output_string + *output_length, text, text_length);
+	*output_length += text_length;
+	output_string[*output_length] = '\0';
+}
+
+// Puts the ROM's composition into output_string: which known ROMs its
+// resident modules were first found in, e.g. "exec.library 47 and 20 more
+// from ... + scsi.device 45 from ...", followed by one line per module.
+// Puts an empty string if the ROM has no modules; see DecomposeAmigaROM.
+void PrintAmigaROMComposition(const ParsedAmigaROMData *amiga_rom, char *output_string, const size_t string_length)
+{
+	const AmigaROMModule *module;
+	const AmigaROMInfo *source_rom;
+	char line[512];
+	size_t output_length = 0;
+	size_t known_count = 0;
+	size_t source_count;
+	size_t i, j;
+
+	if(!amiga_rom || !output_string || string_length == 0)
+	{
+		return;
+	}
+
+	output_string[0] = '\0';
+
+	if(amiga_rom->module_count == 0)
+	{
+		return;
+	}
+
+	AppendAmigaROMInfoText(output_string, string_length, &output_length, "ROM composition:\t\t");
+
+	for(i = 0; i < amiga_rom->module_count; i++)
+	{
+		module = &(amiga_rom->modules[i]);
+		if(!(module->module_info))
+		{
+			continue;
+		}
+
+		// Each source ROM is described once, by its first module
+		source_rom = module->module_info->rom;
+		for(j = 0; j < i; j++)
+		{
+			if(amiga_rom->modules[j].module_info && amiga_rom->modules[j].module_info->rom == source_rom)
+			{
+				break;
+			}
+		}
+
+		if(j < i)
+		{
+			known_count++;
+			continue;
+		}
+
+		source_count = 0;
+		for(j = i; j < amiga_rom->module_count; j++)
+		{
+			if(amiga_rom->modules[j].module_info && amiga_rom->modules[j].module_info->rom == source_rom)
+			{
+				source_count++;
+			}
+		}
+
+		if(source_count > 1)
+		{
+			snprintf(line, sizeof(line), "%s%s %u and %zu more from %s", (known_count > 0) ? " + " : "", module->name, (unsigned int)module->version, source_count - 1, source_rom->version);
+		}
+		else
+		{
+			snprintf(line, sizeof(line), "%s%s %u from %s", (known_count > 0) ? " + " : "", module->name, (unsigned int)module->version, source_rom->version);
+		}
+
+		AppendAmigaROMInfoText(output_string, string_length, &output_length, line);
+		known_count++;
+	}
+
+	if(known_count < amiga_rom->module_count)
+	{
+		snprintf(line, sizeof(line), "%s%zu unknown module%s\n", (known_count > 0) ? " + " : "", amiga_rom->module_count - known_count, (amiga_rom->module_count - known_count == 1) ? "" : "s");
+	}
+	else
+	{
+		snprintf(line, sizeof(line), "\n");
+	}
+	AppendAmigaROMInfoText(output_string, string_length, &output_length, line);
+
+	snprintf(line, sizeof(line), "Resident modules:\t\t%zu (%zu known)", amiga_rom->module_count, known_count);
+	AppendAmigaROMInfoLine(output_string, string_length, &output_length, line);
+
+	for(i = 0; i < amiga_rom->module_count; i++)
+	{
+		module = &(amiga_rom->modules[i]);
+		snprintf(line, sizeof(line), "  0x%06zX  %-28s %3u  %s", module->offset, module->name, (unsigned int)module->version, (module->module_info) ? module->module_info->rom->version : "Unknown build");
+		AppendAmigaROMInfoLine(output_string, string_length, &output_length, line);
+	}
+}
+
+// Identifies a freshly parsed ROM as cheaply as possible, calculating the
+// requested digests along the way.  The SHA256 digest is only added to them
+// when the structural fingerprint can't settle the question.  A unique
+// fingerprint match stands in for the digest, with is_info_unconfirmed set,
+// until ConfirmAmigaROMInfo() or a SHA256 calculation confirms it.
+static void IdentifyParsedAmigaROM(ParsedAmigaROMData *amiga_rom)
+{
+	const AmigaROMInfo *fingerprint_rom = NULL;
+	int fingerprint_match;
+
+	fingerprint_match = MatchAmigaROMFingerprint(amiga_rom, &fingerprint_rom);
+
+	if(fingerprint_match == AMIGA_ROM_FINGERPRINT_NEEDS_DIGEST)
+	{
+		CalculateAmigaROMDigests(amiga_rom, amiga_rom->requested_digests | AMIGA_ROM_DIGEST_SHA256);
+		return;
+	}
+
+	CalculateAmigaROMDigests(amiga_rom, amiga_rom->requested_digests);
+
+	if(!(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256))
+	{
+		amiga_rom->rom_info = (fingerprint_match == AMIGA_ROM_FINGERPRINT_UNIQUE) ? fingerprint_rom : NULL;
+		amiga_rom->is_info_unconfirmed = (amiga_rom->rom_info != NULL);
+	}
+}
+
 // Parses and validates the data in the Amiga ROM updates the struct
-// passed in with that data.
+// passed in with that data.  The ROM is looked up by structural fingerprint
+// first: sizes and fingerprints which can't belong to a known ROM are
+// rejected without hashing, and a unique fingerprint match sets rom_info
+// without hashing, with is_info_unconfirmed set, unless requested_digests
+// includes SHA256.  Otherwise the SHA256 digest decides.  Call
+// ConfirmAmigaROMInfo() before relying on an unconfirmed match.
+// Unknown ROMs are decomposed into their resident modules.  Only the fields
+// in parse_fields are worked out; the ROM is always checked and decrypted,
+// and the rest is left to EnsureAmigaROMFields().
 void ParseAmigaROMData(ParsedAmigaROMData *amiga_rom, const char* keyfile_path)
 {
 	int rom_encryption_result = 0;
@@ -618,12 +1161,14 @@ void ParseAmigaROMData(ParsedAmigaROMData *amiga_rom, const char* keyfile_path)
 	amiga_rom->has_valid_checksum = false;
 	amiga_rom->header = 0;
 	amiga_rom->type = 'U';
+	amiga_rom->family = AMIGA_ROM_FAMILY_UNKNOWN;
 	amiga_rom->version = NULL;
 	amiga_rom->major_version = 0;
 	amiga_rom->minor_version = 0xffff;
 	amiga_rom->major_minor_version = NULL;
 	amiga_rom->is_kickety_split = false;
 	amiga_rom->valid_footer = false;
+	InvalidateAmigaROMDigest(amiga_rom);
 
 	if(!ValidateAmigaROMSize(amiga_rom))
 	{
@@ -660,108 +1205,1124 @@ void ParseAmigaROMData(ParsedAmigaROMData *amiga_rom, const char* keyfile_path)
 	if(!amiga_rom->is_encrypted)
 	{
 		amiga_rom->parsed_rom = true;
-		amiga_rom->validated_size = ValidateEmbeddedAmigaROMSize(amiga_rom);
-		amiga_rom->has_reset_vector = ValidateAmigaROMResetVector(amiga_rom);
-		amiga_rom->is_byte_swapped = (DetectAmigaROMByteSwap(amiga_rom) == 1);
-		amiga_rom->has_valid_checksum = ValidateAmigaROMChecksum(amiga_rom);
-		amiga_rom->header = DetectAmigaKickstartROMTypeFromHeader(amiga_rom);
-		amiga_rom->type = DetectAmigaROMType(amiga_rom);
-		amiga_rom->version = DetectAmigaROMVersion(amiga_rom);
-		amiga_rom->major_version = DetectAmigaMajorROMVersion(amiga_rom);
-		amiga_rom->minor_version = DetectAmigaMinorROMVersion(amiga_rom);
-		amiga_rom->major_minor_version = DetectAmigaMajorMinorROMVersion(amiga_rom);
-		amiga_rom->is_kickety_split = DetectKicketySplitAmigaROM(amiga_rom);
-		amiga_rom->valid_footer = ValidateAmigaKickstartROMFooter(amiga_rom);
+
+		EnsureAmigaROMFields(amiga_rom, amiga_rom->parse_fields);
 	}
 }
 
-// Return whether an Amiga ROM is a valid size, accounting for
-// encryption, if it's there.
-bool ValidateAmigaROMSize(const ParsedAmigaROMData *amiga_rom)
+// Returns fields (AMIGA_ROM_FIELD_* bits) with every field they depend on
+// added.
+static uint16_t AddAmigaROMFieldDependencies(const uint16_t fields)
 {
-	size_t actual_rom_size = DetectUnencryptedAmigaROMSize(amiga_rom);
+	uint16_t all_fields = fields & AMIGA_ROM_FIELD_ALL;
 
-	return ((actual_rom_size > 10) && ((actual_rom_size & actual_rom_size - 1) == 0));
-}
+	if(all_fields & AMIGA_ROM_FIELD_VERSIONS)
+	{
+		all_fields |= AMIGA_ROM_FIELD_HEADER | AMIGA_ROM_FIELD_RESET_VECTOR | AMIGA_ROM_FIELD_FOOTER;
+	}
 
-// Validate that there is a reset vector (0x0x4E70) at 0x000000D0.
+	if(all_fields & AMIGA_ROM_FIELD_FAMILY)
+	{
+		all_fields |= AMIGA_ROM_FIELD_BYTE_SWAP;
+	}
+
+	if(all_fields & AMIGA_ROM_FIELD_BYTE_SWAP)
+	{
+		all_fields |= AMIGA_ROM_FIELD_INFO;
+	}
+
+	return all_fields;
+}
+
+// Works out every field selected by fields (AMIGA_ROM_FIELD_* bits), and
+// those they depend on, which isn't in valid_fields yet, and adds them to
+// it.  The library's mutators drop fields from valid_fields when they change
+// the ROM data.  Returns true if it succeeds, or false if the ROM isn't
+// parsed.
+bool EnsureAmigaROMFields(ParsedAmigaROMData *amiga_rom, const uint16_t fields)
+{
+	uint16_t missing_fields;
+
+	if(!amiga_rom || !(amiga_rom->parsed_rom) || !(amiga_rom->rom_data))
+	{
+		return false;
+	}
+
+	missing_fields = AddAmigaROMFieldDependencies(fields) & (uint16_t)~(amiga_rom->valid_fields);
+	if(missing_fields == AMIGA_ROM_FIELD_NONE)
+	{
+		return true;
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_INFO)
+	{
+		IdentifyParsedAmigaROM(amiga_rom);
+		amiga_rom->type = (amiga_rom->rom_info) ? amiga_rom->rom_info->type : 'U';
+		amiga_rom->version = (amiga_rom->rom_info) ? amiga_rom->rom_info->version : NULL;
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_DIGESTS)
+	{
+		CalculateAmigaROMDigests(amiga_rom, amiga_rom->requested_digests);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_SIZE)
+	{
+		amiga_rom->validated_size = ValidateEmbeddedAmigaROMSize(amiga_rom);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_RESET_VECTOR)
+	{
+		amiga_rom->has_reset_vector = ValidateAmigaROMResetVector(amiga_rom);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_BYTE_SWAP)
+	{
+		amiga_rom->is_byte_swapped = (DetectAmigaROMByteSwapFromInfo(amiga_rom, amiga_rom->rom_info) == 1);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_CHECKSUM)
+	{
+		amiga_rom->has_valid_checksum = ValidateAmigaROMChecksum(amiga_rom);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_HEADER)
+	{
+		amiga_rom->header = DetectAmigaKickstartROMTypeFromHeader(amiga_rom);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_FOOTER)
+	{
+		amiga_rom->valid_footer = ValidateAmigaKickstartROMFooter(amiga_rom);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_VERSIONS)
+	{
+		// The same checks as IsAmigaROM(), on the fields worked out above
+		if(amiga_rom->rom_size >= 16 && amiga_rom->header != 0 && amiga_rom->has_reset_vector && amiga_rom->valid_footer)
+		{
+			ReadAmigaROMVersionNumbers(amiga_rom, &(amiga_rom->major_version), &(amiga_rom->minor_version));
+		}
+		else
+		{
+			amiga_rom->major_version = 0xffff;
+			amiga_rom->minor_version = 0xffff;
+		}
+
+		amiga_rom->major_minor_version = LookupAmigaMajorMinorROMVersion(amiga_rom->major_version, amiga_rom->minor_version);
+	}
+
+	if(missing_fields & AMIGA_ROM_FIELD_KICKETY_SPLIT)
+	{
+		amiga_rom->is_kickety_split = DetectKicketySplitAmigaROM(amiga_rom);
+	}
+
+	amiga_rom->valid_fields |= missing_fields;
+
+	// Set valid first, as DecomposeAmigaROM ensures the byte order itself
+	if((missing_fields & AMIGA_ROM_FIELD_FAMILY) && !(amiga_rom->rom_info))
+	{
+		DecomposeAmigaROM(amiga_rom);
+		amiga_rom->family = DetectAmigaROMFamily(amiga_rom);
+		if(amiga_rom->family != AMIGA_ROM_FAMILY_UNKNOWN)
+		{
+			amiga_rom->type = 'O';
+		}
+	}
+
+	return true;
+}
+
+bool GetAmigaROMValidatedSize(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_SIZE) && amiga_rom->validated_size;
+}
+
+bool GetAmigaROMHasResetVector(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_RESET_VECTOR) && amiga_rom->has_reset_vector;
+}
+
+const AmigaROMInfo* GetAmigaROMInfo(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_INFO) ? amiga_rom->rom_info : NULL;
+}
+
+// Unknown ROMs are only typed once their family is known
+char GetAmigaROMType(ParsedAmigaROMData *amiga_rom)
+{
+	if(!EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_INFO))
+	{
+		return 'U';
+	}
+
+	if(!(amiga_rom->rom_info))
+	{
+		EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_FAMILY);
+	}
+
+	return amiga_rom->type;
+}
+
+const char* GetAmigaROMVersion(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_INFO) ? amiga_rom->version : NULL;
+}
+
+bool GetAmigaROMIsByteSwapped(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_BYTE_SWAP) && amiga_rom->is_byte_swapped;
+}
+
+bool GetAmigaROMHasValidChecksum(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_CHECKSUM) && amiga_rom->has_valid_checksum;
+}
+
+uint8_t GetAmigaROMHeader(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_HEADER) ? amiga_rom->header : 0x00;
+}
+
+bool GetAmigaROMHasValidFooter(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_FOOTER) && amiga_rom->valid_footer;
+}
+
+uint16_t GetAmigaROMMajorVersion(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_VERSIONS) ? amiga_rom->major_version : 0xffff;
+}
+
+uint16_t GetAmigaROMMinorVersion(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_VERSIONS) ? amiga_rom->minor_version : 0xffff;
+}
+
+const char* GetAmigaROMMajorMinorVersion(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_VERSIONS) ? amiga_rom->major_minor_version : NULL;
+}
+
+bool GetAmigaROMIsKicketySplit(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_KICKETY_SPLIT) && amiga_rom->is_kickety_split;
+}
+
+uint8_t GetAmigaROMFamily(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_INFO | AMIGA_ROM_FIELD_FAMILY) ? amiga_rom->family : AMIGA_ROM_FAMILY_UNKNOWN;
+}
+
+const AmigaROMDigests* GetAmigaROMDigests(ParsedAmigaROMData *amiga_rom)
+{
+	return EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_DIGESTS) ? &(amiga_rom->digests) : NULL;
+}
+
+// Return whether an Amiga ROM is a valid size, accounting for
+// encryption, if it's there.
+bool ValidateAmigaROMSize(const ParsedAmigaROMData *amiga_rom)
+{
+	size_t actual_rom_size = DetectUnencryptedAmigaROMSize(amiga_rom);
+
+	return ((actual_rom_size > 10) && ((actual_rom_size & actual_rom_size - 1) == 0));
+}
+
+// Validate that there is a reset vector (0x0x4E70) at 0x000000D0.
 // Returns true if there is, or false if there isn't.
 bool ValidateAmigaROMResetVector(const ParsedAmigaROMData *amiga_rom)
 {
-	const uint16_t *rom_data_16;
+	const uint16_t *rom_data_16;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	{
+		return false;
+	}
+
+	rom_data_16 = (const uint16_t*)(amiga_rom->rom_data);
+
+	return (be16toh(rom_data_16[104]) == 0x4E70);
+}
+
+// Computes the SHA256 digest of the ROM data into digest, reusing the
+// cached digest if the struct has a valid one.
+static bool GetAmigaROMDigest(const ParsedAmigaROMData *amiga_rom, uint8_t *digest)
+{
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	{
+		return false;
+	}
+
+	if(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256)
+	{
+		memcpy(digest, amiga_rom->digests.sha256, 32);
+		return true;
+	}
+
+	return (SHA256(amiga_rom->rom_data, amiga_rom->rom_size, digest, NULL) == 0);
+}
+
+// Calculates the SHA256 digest of the ROM data and caches it, along with
+// the matching entry from the known ROM database (or NULL if there is none),
+// in the struct.  Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMDigest(ParsedAmigaROMData *amiga_rom)
+{
+	if(!amiga_rom)
+	{
+		return false;
+	}
+
+	return CalculateAmigaROMDigests(amiga_rom, AMIGA_ROM_DIGEST_SHA256);
+}
+
+// Calculates every digest selected by requested_digests (AMIGA_ROM_DIGEST_*
+// bits) which isn't already cached, in a single pass over the ROM data, and
+// caches the results in amiga_rom->digests.  Returns true if it succeeds,
+// or false if it fails.
+bool CalculateAmigaROMDigests(ParsedAmigaROMData *amiga_rom, const uint8_t requested_digests)
+{
+	AmigaROMDigestContext digest_context;
+	AmigaROMDigests new_digests;
+	uint32_t *test_ptr;
+	uint8_t missing_digests;
+	size_t checkpoint_capacity, checkpoint, offset, chunk_size;
+	bool record_checkpoints;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	{
+		return false;
+	}
+
+	missing_digests = requested_digests & AMIGA_ROM_DIGEST_ALL & ~(amiga_rom->digests.computed_digests);
+
+	if(missing_digests == AMIGA_ROM_DIGEST_NONE)
+	{
+		return true;
+	}
+
+	checkpoint_capacity = (amiga_rom->rom_size + AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL - 1) / AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL;
+	record_checkpoints = (missing_digests & AMIGA_ROM_DIGEST_SHA256) != 0;
+	checkpoint = 0;
+
+	InitAmigaROMDigestContext(&digest_context, missing_digests);
+
+	if(missing_digests == AMIGA_ROM_DIGEST_SHA256 && amiga_rom->sha256_checkpoint_count > 0)
+	{
+		// Only SHA256 is needed, so resume from the last checkpoint before
+		// the first modified byte
+		checkpoint = amiga_rom->sha256_checkpoint_count - 1;
+		SHA256InitFromMidstate(&(digest_context.sha256), &(amiga_rom->sha256_checkpoints)[checkpoint * 8], (uint64_t)checkpoint * AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL);
+	}
+	else if(record_checkpoints)
+	{
+		amiga_rom->sha256_checkpoint_count = 0;
+
+		test_ptr = realloc(amiga_rom->sha256_checkpoints, checkpoint_capacity * 8 * sizeof(uint32_t));
+		if(test_ptr)
+		{
+			amiga_rom->sha256_checkpoints = test_ptr;
+		}
+		else
+		{
+			record_checkpoints = false;
+		}
+	}
+
+	for(offset = checkpoint * AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL; offset < amiga_rom->rom_size; offset += chunk_size)
+	{
+		chunk_size = amiga_rom->rom_size - offset;
+		if(chunk_size > AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL)
+		{
+			chunk_size = AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL;
+		}
+
+		if(record_checkpoints)
+		{
+			memcpy(&(amiga_rom->sha256_checkpoints)[checkpoint * 8], digest_context.sha256.state, 8 * sizeof(uint32_t));
+			checkpoint++;
+		}
+
+		UpdateAmigaROMDigestContext(&digest_context, &(amiga_rom->rom_data)[offset], chunk_size);
+	}
+
+	FinalizeAmigaROMDigestContext(&digest_context, &new_digests);
+
+	if(record_checkpoints)
+	{
+		amiga_rom->sha256_checkpoint_count = checkpoint;
+	}
+
+	StoreAmigaROMDigests(amiga_rom, missing_digests, &new_digests);
+
+	return true;
+}
+
+// Caches the digests selected by new_digest_types from new_digests, and
+// the database entry matching a new SHA256 digest.
+static void StoreAmigaROMDigests(ParsedAmigaROMData *amiga_rom, const uint8_t new_digest_types, const AmigaROMDigests *new_digests)
+{
+	if(new_digest_types & AMIGA_ROM_DIGEST_CRC32)
+	{
+		amiga_rom->digests.crc32 = new_digests->crc32;
+	}
+
+	if(new_digest_types & AMIGA_ROM_DIGEST_MD5)
+	{
+		memcpy(amiga_rom->digests.md5, new_digests->md5, sizeof(new_digests->md5));
+	}
+
+	if(new_digest_types & AMIGA_ROM_DIGEST_SHA1)
+	{
+		memcpy(amiga_rom->digests.sha1, new_digests->sha1, sizeof(new_digests->sha1));
+	}
+
+	if(new_digest_types & AMIGA_ROM_DIGEST_SHA256)
+	{
+		memcpy(amiga_rom->digests.sha256, new_digests->sha256, sizeof(new_digests->sha256));
+		amiga_rom->rom_info = DetectAmigaROMInfoFromDigest(amiga_rom->digests.sha256);
+		amiga_rom->is_info_unconfirmed = false;
+	}
+
+	amiga_rom->digests.computed_digests |= new_digest_types;
+}
+
+// Marks the cached digests and database entry as stale, and frees any
+// modules.  Must be called after modifying rom_data directly; the library's
+// own mutators already do this.
+void InvalidateAmigaROMDigest(ParsedAmigaROMData *amiga_rom)
+{
+	if(!amiga_rom)
+	{
+		return;
+	}
+
+	amiga_rom->digests.computed_digests = AMIGA_ROM_DIGEST_NONE;
+	amiga_rom->rom_info = NULL;
+	amiga_rom->is_info_unconfirmed = false;
+	amiga_rom->sha256_checkpoint_count = 0;
+	amiga_rom->valid_fields = AMIGA_ROM_FIELD_NONE;
+	FreeAmigaROMModules(amiga_rom);
+}
+
+// Marks length bytes at offset as modified.  The cached digests and modules
+// are dropped, but the SHA256 midstates saved every AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL
+// bytes before offset are kept, so the next SHA256 calculation resumes from
+// the checkpoint just before the change.  The library's own mutators already
+// do this.
+void MarkAmigaROMDataModified(ParsedAmigaROMData *amiga_rom, const size_t offset, const size_t length)
+{
+	size_t first_modified_checkpoint;
+
+	if(!amiga_rom || length == 0)
+	{
+		return;
+	}
+
+	// Checkpoint n holds the state before byte n * interval, so the one for
+	// the modified chunk itself is still good.
+	first_modified_checkpoint = offset / AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL;
+
+	if(first_modified_checkpoint + 1 < amiga_rom->sha256_checkpoint_count)
+	{
+		amiga_rom->sha256_checkpoint_count = first_modified_checkpoint + 1;
+	}
+
+	amiga_rom->digests.computed_digests = AMIGA_ROM_DIGEST_NONE;
+	amiga_rom->rom_info = NULL;
+	amiga_rom->is_info_unconfirmed = false;
+	amiga_rom->valid_fields = AMIGA_ROM_FIELD_NONE;
+	FreeAmigaROMModules(amiga_rom);
+}
+
+// Returns the known ROM database entry for the ROM, using the cached digest
+// if there is one.  Returns NULL if the ROM is unknown.
+const AmigaROMInfo* DetectAmigaROMInfo(const ParsedAmigaROMData *amiga_rom)
+{
+	uint8_t digest[32];
+
+	if(!amiga_rom)
+	{
+		return NULL;
+	}
+
+	if(amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256)
+	{
+		return amiga_rom->rom_info;
+	}
+
+	if(!GetAmigaROMDigest(amiga_rom, digest))
+	{
+		return NULL;
+	}
+
+	return DetectAmigaROMInfoFromDigest(digest);
+}
+
+// Returns the known ROM database entry for a precomputed 32-byte SHA256
+// digest.  Returns NULL if the digest is unknown.  The database is laid out
+// by a minimal perfect hash, so this is one probe and one compare.
+const AmigaROMInfo* DetectAmigaROMInfoFromDigest(const uint8_t *digest)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	size_t slot;
+
+	if(!digest)
+	{
+		return NULL;
+	}
+
+	slot = AmigaROMHashSlot(digest, database->hash_seeds, database->hash_bucket_count, database->rom_info_count);
+
+	if(memcmp(database->digests[slot], digest, 32) == 0)
+	{
+		return &(database->rom_info[slot]);
+	}
+
+	return NULL;
+}
+
+// Looks the ROM up as each of the views selected by requested_views
+// (AMIGA_ROM_VIEW_* bits), hashing all of them in one pass over rom_data
+// instead of byte swapping or splitting it into new buffers.  A whole view
+// identifies the ROM on its own, but the Hi and Lo views only do together,
+// when both halves in the same byte order are halves of the same known ROM.
+// Returns the known entry identified (for a pair of halves, the ROM they
+// are halves of if it is known, or else the Hi half) and, if matched_view
+// isn't NULL, sets it to the view or views which matched.  Returns NULL if
+// the ROM isn't identified; then, if partial_match isn't NULL, it is set to
+// the entry a single half matched (and matched_view to that half's view),
+// or NULL if none did, so a damaged dump can still be compared against it.
+const AmigaROMInfo* DetectAmigaROMInfoFromViews(const ParsedAmigaROMData *amiga_rom, const uint8_t requested_views, uint8_t *matched_view, const AmigaROMInfo **partial_match)
+{
+	AmigaROMViewDigests view_digests;
+	const AmigaROMInfo *view_info[AMIGA_ROM_VIEW_COUNT] = {NULL};
+	const AmigaROMInfo *rom_info;
+	uint8_t views = requested_views & AMIGA_ROM_VIEW_ALL;
+	uint8_t view, hi_view, lo_view;
+	size_t i, hi_index, lo_index;
+
+	if(matched_view)
+	{
+		*matched_view = AMIGA_ROM_VIEW_NONE;
+	}
+
+	if(partial_match)
+	{
+		*partial_match = NULL;
+	}
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	{
+		return NULL;
+	}
+
+	// The as-is view is usually already hashed
+	if((views & AMIGA_ROM_VIEW_AS_IS) && (amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256))
+	{
+		views &= (uint8_t)~AMIGA_ROM_VIEW_AS_IS;
+
+		if(amiga_rom->rom_info)
+		{
+			if(matched_view)
+			{
+				*matched_view = AMIGA_ROM_VIEW_AS_IS;
+			}
+
+			return amiga_rom->rom_info;
+		}
+	}
+
+	if(views == AMIGA_ROM_VIEW_NONE || !CalculateAmigaROMViewDigests(amiga_rom->rom_data, amiga_rom->rom_size, views, &view_digests))
+	{
+		return NULL;
+	}
+
+	for(i = 0; i < AMIGA_ROM_VIEW_COUNT; i++)
+	{
+		if(view_digests.computed_views & (1 << i))
+		{
+			view_info[i] = DetectAmigaROMInfoFromDigest(view_digests.sha256[i]);
+		}
+	}
+
+	for(i = 0; i < AMIGA_ROM_VIEW_COUNT; i++)
+	{
+		view = (uint8_t)(1 << i);
+		if(view_info[i] && (view == AMIGA_ROM_VIEW_AS_IS || view == AMIGA_ROM_VIEW_BYTE_SWAPPED))
+		{
+			if(matched_view)
+			{
+				*matched_view = view;
+			}
+
+			return view_info[i];
+		}
+	}
+
+	for(i = 0; i < 2; i++)
+	{
+		hi_view = (i == 0) ? AMIGA_ROM_VIEW_HI : AMIGA_ROM_VIEW_HI_BYTE_SWAPPED;
+		lo_view = (i == 0) ? AMIGA_ROM_VIEW_LO : AMIGA_ROM_VIEW_LO_BYTE_SWAPPED;
+		hi_index = (i == 0) ? 2 : 4;
+		lo_index = hi_index + 1;
+
+		if(view_info[hi_index] && view_info[lo_index] && AreAmigaROMHalvesOfOneROM(view_info[hi_index], view_info[lo_index]))
+		{
+			if(matched_view)
+			{
+				*matched_view = hi_view | lo_view;
+			}
+
+			rom_info = view_info[hi_index]->canonical;
+			return rom_info ? rom_info : view_info[hi_index];
+		}
+	}
+
+	for(i = 2; i < AMIGA_ROM_VIEW_COUNT; i++)
+	{
+		if(view_info[i])
+		{
+			if(matched_view)
+			{
+				*matched_view = (uint8_t)(1 << i);
+			}
+
+			if(partial_match)
+			{
+				*partial_match = view_info[i];
+			}
+
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+// Returns whether hi_info and lo_info are the Hi and Lo halves of the same
+// ROM: layouts of the same canonical ROM, or, for halves listed on their
+// own, Hi and Lo entries whose versions only differ in what follows the
+// last space (" Hi" and " Lo").
+static bool AreAmigaROMHalvesOfOneROM(const AmigaROMInfo *hi_info, const AmigaROMInfo *lo_info)
+{
+	const char *hi_suffix, *lo_suffix;
+
+	if(hi_info->canonical || lo_info->canonical)
+	{
+		return (hi_info->canonical == lo_info->canonical);
+	}
+
+	if(hi_info->type != 'A' || lo_info->type != 'B' || !(hi_info->version) || !(lo_info->version))
+	{
+		return false;
+	}
+
+	hi_suffix = strrchr(hi_info->version, ' ');
+	lo_suffix = strrchr(lo_info->version, ' ');
+
+	return (hi_suffix && lo_suffix && (hi_suffix - hi_info->version) == (lo_suffix - lo_info->version) && strncmp(hi_info->version, lo_info->version, (size_t)(hi_suffix - hi_info->version)) == 0);
+}
+
+// Reads the structural fingerprint (size, header, major/minor version,
+// checksum and footer words) of the ROM into fingerprint.
+// Returns true if it succeeds, or false if the ROM is too small.
+bool GetAmigaROMFingerprint(const ParsedAmigaROMData *amiga_rom, AmigaROMFingerprint *fingerprint)
+{
+	const uint32_t *rom_data_32;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size < 24 || amiga_rom->rom_size > 0xFFFFFFFF || !fingerprint)
+	{
+		return false;
+	}
+
+	rom_data_32 = (const uint32_t*)(amiga_rom->rom_data);
+
+	fingerprint->file_size = (uint32_t)(amiga_rom->rom_size);
+	fingerprint->header = be32toh(rom_data_32[0]);
+	fingerprint->version = be32toh(rom_data_32[3]);
+	fingerprint->checksum = be32toh(rom_data_32[(amiga_rom->rom_size - 24) / 4]);
+	fingerprint->footer = be32toh(rom_data_32[(amiga_rom->rom_size - 16) / 4]);
+	fingerprint->rom_index = 0;
+
+	return true;
+}
+
+// Orders fingerprints the way AmigaROMHashGen sorts AMIGA_ROM_FINGERPRINTS,
+// ignoring rom_index.
+static int CompareAmigaROMFingerprints(const AmigaROMFingerprint *left, const AmigaROMFingerprint *right)
+{
+	const uint32_t left_words[5] = {left->file_size, left->header, left->version, left->checksum, left->footer};
+	const uint32_t right_words[5] = {right->file_size, right->header, right->version, right->checksum, right->footer};
+	size_t i;
+
+	for(i = 0; i < 5; i++)
+	{
+		if(left_words[i] != right_words[i])
+		{
+			return (left_words[i] > right_words[i]) - (left_words[i] < right_words[i]);
+		}
+	}
+
+	return 0;
+}
+
+// Looks the ROM's structural fingerprint up without hashing anything.
+// Returns AMIGA_ROM_FINGERPRINT_NO_MATCH if no known ROM has its size, or
+// none has its fingerprint and every known ROM of its size has one.
+// Returns AMIGA_ROM_FINGERPRINT_UNIQUE (and sets rom_info, if it isn't NULL)
+// if exactly one known ROM has its fingerprint.  That is only a candidate:
+// a dump with damage outside the fingerprinted words still matches, so only
+// the SHA256 digest confirms it.  Otherwise returns
+// AMIGA_ROM_FINGERPRINT_NEEDS_DIGEST, as only the SHA256 digest can tell.
+int MatchAmigaROMFingerprint(const ParsedAmigaROMData *amiga_rom, const AmigaROMInfo **rom_info)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	AmigaROMFingerprint fingerprint;
+	const AmigaROMSizeClass *size_class = NULL;
+	size_t low, high, middle, match_count;
+
+	if(rom_info)
+	{
+		*rom_info = NULL;
+	}
+
+	if(!GetAmigaROMFingerprint(amiga_rom, &fingerprint))
+	{
+		return AMIGA_ROM_FINGERPRINT_NO_MATCH;
+	}
+
+	low = 0;
+	high = database->size_class_count;
+	while(low < high)
+	{
+		middle = low + ((high - low) / 2);
+
+		if(database->size_classes[middle].file_size < fingerprint.file_size)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	if(low < database->size_class_count && database->size_classes[low].file_size == fingerprint.file_size)
+	{
+		size_class = &(database->size_classes[low]);
+	}
+
+	if(!size_class)
+	{
+		return AMIGA_ROM_FINGERPRINT_NO_MATCH;
+	}
+
+	// Lower bound of the fingerprint in the sorted index
+	low = 0;
+	high = database->fingerprint_count;
+	while(low < high)
+	{
+		middle = low + ((high - low) / 2);
+
+		if(CompareAmigaROMFingerprints(&(database->fingerprints[middle]), &fingerprint) < 0)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	for(match_count = 0; low + match_count < database->fingerprint_count; match_count++)
+	{
+		if(CompareAmigaROMFingerprints(&(database->fingerprints[low + match_count]), &fingerprint) != 0)
+		{
+			break;
+		}
+	}
+
+	if(match_count == 1)
+	{
+		if(rom_info)
+		{
+			*rom_info = &(database->rom_info[database->fingerprints[low].rom_index]);
+		}
+
+		return AMIGA_ROM_FINGERPRINT_UNIQUE;
+	}
+
+	if(match_count == 0 && size_class->unfingerprinted_count == 0)
+	{
+		return AMIGA_ROM_FINGERPRINT_NO_MATCH;
+	}
+
+	return AMIGA_ROM_FINGERPRINT_NEEDS_DIGEST;
+}
+
+// Confirms the identification made by ParseAmigaROMData with the SHA256
+// digest, whatever parse_fields said, updating rom_info, version, type and
+// is_byte_swapped to match and clearing is_info_unconfirmed.  Only hashes
+// the ROM if its SHA256 digest isn't cached yet.
+// Returns true if the ROM is a known ROM, or false if it isn't or it fails.
+bool ConfirmAmigaROMInfo(ParsedAmigaROMData *amiga_rom)
+{
+	bool was_unconfirmed;
+
+	if(!amiga_rom || !(amiga_rom->parsed_rom))
+	{
+		return false;
+	}
+
+	was_unconfirmed = amiga_rom->is_info_unconfirmed;
+
+	if(!CalculateAmigaROMDigest(amiga_rom))
+	{
+		return false;
+	}
+
+	amiga_rom->is_byte_swapped = (DetectAmigaROMByteSwapFromInfo(amiga_rom, amiga_rom->rom_info) == 1);
+	amiga_rom->type = (amiga_rom->rom_info) ? amiga_rom->rom_info->type : ((amiga_rom->family != AMIGA_ROM_FAMILY_UNKNOWN) ? 'O' : 'U');
+	amiga_rom->version = (amiga_rom->rom_info) ? amiga_rom->rom_info->version : NULL;
+	amiga_rom->valid_fields |= AMIGA_ROM_FIELD_INFO | AMIGA_ROM_FIELD_BYTE_SWAP;
+
+	// A rejected fingerprint match was never decomposed as an unknown ROM
+	if(was_unconfirmed && !(amiga_rom->rom_info))
+	{
+		amiga_rom->valid_fields &= (uint16_t)~AMIGA_ROM_FIELD_FAMILY;
+		EnsureAmigaROMFields(amiga_rom, amiga_rom->parse_fields & AMIGA_ROM_FIELD_FAMILY);
+	}
+
+	return (amiga_rom->rom_info != NULL);
+}
+
+// Returns the known ROM database entry whose Merkle root matches a 32-byte
+// root from CalculateAmigaROMMerkleTree().  Only entries generated from a
+// ROM image carry a root.  Returns NULL if the root is unknown.
+const AmigaROMInfo* DetectAmigaROMInfoFromMerkleRoot(const uint8_t *root)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	size_t i;
+
+	if(!root)
+	{
+		return NULL;
+	}
+
+	for(i = 0; i < database->rom_info_count; i++)
+	{
+		if(database->rom_info[i].merkle && memcmp(database->rom_info[i].merkle->root, root, 32) == 0)
+		{
+			return &(database->rom_info[i]);
+		}
+	}
+
+	return NULL;
+}
+
+// Returns the known ROM database entry with the same number of Merkle leaves
+// as merkle_tree and the most leaves in common with it, and if
+// matching_leaves isn't NULL, sets it to how many match.  Pass the result's
+// merkle->leaves to FindAmigaROMMerkleDamage() to list the damaged ranges.
+// Returns NULL if no entry has any leaves in common.
+const AmigaROMInfo* FindClosestAmigaROMInfoFromMerkleLeaves(const AmigaROMMerkleTree *merkle_tree, size_t *matching_leaves)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	const AmigaROMInfo *closest_rom = NULL;
+	size_t best_matches = 0;
+	size_t matches, i, j;
+
+	if(matching_leaves)
+	{
+		*matching_leaves = 0;
+	}
+
+	if(!merkle_tree || !(merkle_tree->leaves))
+	{
+		return NULL;
+	}
+
+	for(i = 0; i < database->rom_info_count; i++)
+	{
+		if(!database->rom_info[i].merkle || database->rom_info[i].merkle->leaf_count != merkle_tree->leaf_count)
+		{
+			continue;
+		}
+
+		matches = 0;
+		for(j = 0; j < merkle_tree->leaf_count; j++)
+		{
+			if(memcmp(database->rom_info[i].merkle->leaves[j], merkle_tree->leaves[j], 32) == 0)
+			{
+				matches++;
+			}
+		}
+
+		if(matches > best_matches)
+		{
+			best_matches = matches;
+			closest_rom = &(database->rom_info[i]);
+		}
+	}
+
+	if(matching_leaves)
+	{
+		*matching_leaves = best_matches;
+	}
+
+	return closest_rom;
+}
+
+// Finds the known ROMs most similar to the image merkle_tree was built from,
+// of any size, and writes up to max_results of them to results, most similar
+// first.  Only ROMs which share a MinHash band with the image are compared,
+// so the cost barely grows with the size of the database.  Pass a result's
+// rom_info->merkle->leaves to FindAmigaROMMerkleDamage() to list the ranges
+// which differ.  Returns the number written.
+size_t FindSimilarAmigaROMInfo(const AmigaROMMerkleTree *merkle_tree, AmigaROMSimilarity *results, const size_t max_results)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	const AmigaROMInfo *candidate;
+	uint32_t minhash[AMIGA_ROM_MERKLE_MINHASH_SIZE];
+	uint64_t key;
+	size_t result_count = 0;
+	size_t low, high, middle, band, matches, matching_leaves, leaf_count, i, j;
+	double similarity;
+
+	if(!merkle_tree || !(merkle_tree->leaves) || !results || max_results == 0)
+	{
+		return 0;
+	}
+
+	CalculateAmigaROMMinHash((const uint8_t (*)[32])merkle_tree->leaves, merkle_tree->leaf_count, minhash);
+
+	for(band = 0; band < AMIGA_ROM_MERKLE_MINHASH_BANDS; band++)
+	{
+		key = GetAmigaROMMinHashBandKey(minhash, band);
+
+		low = 0;
+		high = database->similarity_key_count;
+		while(low < high)
+		{
+			middle = low + ((high - low) / 2);
+			if(database->similarity_keys[middle].key < key)
+			{
+				low = middle + 1;
+			}
+			else
+			{
+				high = middle;
+			}
+		}
+
+		for(; low < database->similarity_key_count && database->similarity_keys[low].key == key; low++)
+		{
+			candidate = &(database->rom_info[database->similarity_keys[low].rom_index]);
+
+			// A ROM sharing several bands is only compared once
+			i = 0;
+			while(i < result_count && results[i].rom_info != candidate)
+			{
+				i++;
+			}
+
+			if(i < result_count)
+			{
+				continue;
+			}
+
+			matches = 0;
+			for(i = 0; i < AMIGA_ROM_MERKLE_MINHASH_SIZE; i++)
+			{
+				if(candidate->merkle->minhash[i] == minhash[i])
+				{
+					matches++;
+				}
+			}
+
+			similarity = (double)matches / AMIGA_ROM_MERKLE_MINHASH_SIZE;
+
+			leaf_count = (candidate->merkle->leaf_count < merkle_tree->leaf_count) ? candidate->merkle->leaf_count : merkle_tree->leaf_count;
+			matching_leaves = 0;
+			for(i = 0; i < leaf_count; i++)
+			{
+				if(memcmp(candidate->merkle->leaves[i], merkle_tree->leaves[i], 32) == 0)
+				{
+					matching_leaves++;
+				}
+			}
+
+			// Keep results in order, most similar and then most aligned first
+			for(i = result_count; i > 0; i--)
+			{
+				if(results[i - 1].similarity > similarity || (results[i - 1].similarity == similarity && results[i - 1].matching_leaves >= matching_leaves))
+				{
+					break;
+				}
+			}
+
+			if(i >= max_results)
+			{
+				continue;
+			}
+
+			if(result_count < max_results)
+			{
+				result_count++;
+			}
+
+			for(j = result_count - 1; j > i; j--)
+			{
+				results[j] = results[j - 1];
+			}
+
+			results[i].rom_info = candidate;
+			results[i].similarity = similarity;
+			results[i].matching_leaves = matching_leaves;
+		}
+	}
+
+	return result_count;
+}
+
+// Returns the known resident module with the same hash, name and version as
+// module, using a binary search of the database's module index.
+// Returns NULL if the module is unknown.
+const AmigaROMModuleInfo* DetectAmigaROMModuleInfo(const AmigaROMModule *module)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	size_t low = 0;
+	size_t high = database->module_count;
+	size_t middle;
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(!module)
 	{
-		return false;
+		return NULL;
 	}
 
-	rom_data_16 = (const uint16_t*)(amiga_rom->rom_data);
+	// Find the first module with the hash; different modules may share it
+	while(low < high)
+	{
+		middle = low + ((high - low) / 2);
+		if(database->modules[middle].hash < module->hash)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
 
-	return (be16toh(rom_data_16[104]) == 0x4E70);
+	for(; low < database->module_count && database->modules[low].hash == module->hash; low++)
+	{
+		if(database->modules[low].version == module->version && strcmp(database->modules[low].name, module->name) == 0)
+		{
+			return &(database->modules[low]);
+		}
+	}
+
+	return NULL;
 }
 
-// Detects the version of the ROM by SHA256 hash
-// Returns NULL for failure, else a string indicating the ROM version
-const char* DetectAmigaROMVersion(const ParsedAmigaROMData *amiga_rom)
+static void FreeAmigaROMModules(ParsedAmigaROMData *amiga_rom)
 {
-	uint8_t *digest;
-	char *hexdigest;
+	if(amiga_rom->modules)
+	{
+		free(amiga_rom->modules);
+		amiga_rom->modules = NULL;
+	}
+
+	amiga_rom->module_count = 0;
+}
 
+// Finds the resident modules of the ROM, looks each one up and keeps them in
+// modules, replacing any found before.  ParseAmigaROMData does this for
+// every ROM which isn't known, so custom and patched Kickstarts are still
+// described by the known modules they are built from.
+// Returns true if it succeeds, or false if it fails.
+bool DecomposeAmigaROM(ParsedAmigaROMData *amiga_rom)
+{
+	AmigaROMModule *test_ptr;
 	size_t i;
-	size_t rom_quantity = sizeof(AMIGA_ROM_INFO) / sizeof(AmigaROMInfo);
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->is_encrypted)
 	{
-		return NULL;
+		return false;
 	}
 
-	digest = (uint8_t*)malloc(20);
-	if(!digest)
+	FreeAmigaROMModules(amiga_rom);
+	EnsureAmigaROMFields(amiga_rom, AMIGA_ROM_FIELD_BYTE_SWAP);
+
+	amiga_rom->modules = (AmigaROMModule*)malloc(AMIGA_ROM_MAX_MODULES * sizeof(AmigaROMModule));
+	if(!(amiga_rom->modules))
 	{
-		return NULL;
+		return false;
 	}
 
-	hexdigest = (char*)malloc(65);
-	if(!hexdigest)
+	amiga_rom->module_count = ScanAmigaROMModules(amiga_rom->rom_data, amiga_rom->rom_size, amiga_rom->is_byte_swapped, amiga_rom->modules, AMIGA_ROM_MAX_MODULES);
+	if(amiga_rom->module_count == 0)
 	{
-		free(digest);
-		digest = NULL;
-		return NULL;
+		FreeAmigaROMModules(amiga_rom);
+		return true;
+	}
+
+	test_ptr = realloc(amiga_rom->modules, amiga_rom->module_count * sizeof(AmigaROMModule));
+	if(test_ptr)
+	{
+		amiga_rom->modules = test_ptr;
+	}
+
+	for(i = 0; i < amiga_rom->module_count; i++)
+	{
+		amiga_rom->modules[i].module_info = DetectAmigaROMModuleInfo(&(amiga_rom->modules[i]));
 	}
 
-	if (SHA256(amiga_rom->rom_data, amiga_rom->rom_size, digest, hexdigest))
+	return true;
+}
+
+// Detects the version of the ROM by SHA256 hash
+// Returns NULL for failure, else a string indicating the ROM version
+const char* DetectAmigaROMVersion(const ParsedAmigaROMData *amiga_rom)
+{
+	const AmigaROMInfo *rom_info = DetectAmigaROMInfo(amiga_rom);
+
+	if(!rom_info)
 	{
-		free(digest);
-		digest = NULL;
-		free(hexdigest);
-		hexdigest = NULL;
 		return NULL;
 	}
 
-	for (i = 0; i < rom_quantity; i++)
+	return rom_info->version;
+}
+
+// Same as DetectAmigaROMVersion, but for a precomputed 32-byte SHA256 digest
+const char* DetectAmigaROMVersionFromDigest(const uint8_t *digest)
+{
+	const AmigaROMInfo *rom_info = DetectAmigaROMInfoFromDigest(digest);
+
+	if(!rom_info)
 	{
-		if (strncmp(hexdigest, AMIGA_ROM_INFO[i].sha256hash, 40) == 0)
-		{
-			free(digest);
-			digest = NULL;
-			free(hexdigest);
-			hexdigest = NULL;
-			return AMIGA_ROM_INFO[i].version;
-		}
+		return NULL;
 	}
 
-	free(digest);
-	digest = NULL;
-	free(hexdigest);
-	hexdigest = NULL;
-	return NULL;
+	return rom_info->version;
+}
+
+// Reads the major and minor version words from the header of a ROM which
+// is already known to be an Amiga ROM.
+static void ReadAmigaROMVersionNumbers(const ParsedAmigaROMData *amiga_rom, uint16_t *major_version, uint16_t *minor_version)
+{
+	const uint16_t *rom_data_16 = (const uint16_t*)(amiga_rom->rom_data);
+
+	*major_version = be16toh(rom_data_16[6]);
+	*minor_version = be16toh(rom_data_16[7]);
 }
 
 // Detects the major version in the Amiga ROM header
 // Returns 0 if the ROM is not detects as an Amiga ROM
 uint16_t DetectAmigaMajorROMVersion(const ParsedAmigaROMData *amiga_rom)
 {
-	const uint16_t *rom_data_16;
+	uint16_t major_version, minor_version;
 
 	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size < 16)
 	{
@@ -773,16 +2334,16 @@ uint16_t DetectAmigaMajorROMVersion(const ParsedAmigaROMData *amiga_rom)
 		return 0xffff;
 	}
 
-	rom_data_16 = (const uint16_t*)(amiga_rom->rom_data);
+	ReadAmigaROMVersionNumbers(amiga_rom, &major_version, &minor_version);
 
-	return be16toh(rom_data_16[6]);
+	return major_version;
 }
 
 // Detects the minor version in the Amiga ROM header
 // Returns 0 if the ROM is not detects as an Amiga ROM
 uint16_t DetectAmigaMinorROMVersion(const ParsedAmigaROMData *amiga_rom)
 {
-	const uint16_t *rom_data_16;
+	uint16_t major_version, minor_version;
 
 	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size < 16)
 	{
@@ -794,27 +2355,57 @@ uint16_t DetectAmigaMinorROMVersion(const ParsedAmigaROMData *amiga_rom)
 		return 0xffff;
 	}
 
-	rom_data_16 = (const uint16_t*)(amiga_rom->rom_data);
+	ReadAmigaROMVersionNumbers(amiga_rom, &major_version, &minor_version);
 
-	return be16toh(rom_data_16[7]);
+	return minor_version;
 }
 
 // Returns a version string based on the major and minor versions in the Amiga ROM header
 // Returns NULL if the ROM is not detects as an Amiga ROM or the version is unknown
 const char* DetectAmigaMajorMinorROMVersion(const ParsedAmigaROMData *amiga_rom)
 {
-	size_t i, number_of_versions;
+	uint16_t major_version, minor_version;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size < 16)
+	{
+		return NULL;
+	}
+
+	if(!IsAmigaROM(amiga_rom))
+	{
+		return NULL;
+	}
+
+	ReadAmigaROMVersionNumbers(amiga_rom, &major_version, &minor_version);
+
+	return LookupAmigaMajorMinorROMVersion(major_version, minor_version);
+}
+
+// Returns a version string for major and minor versions already read from
+// an Amiga ROM header, with one table index and at most a handful of minor
+// version compares.
+// Returns NULL if the version is unknown
+const char* LookupAmigaMajorMinorROMVersion(const uint16_t major_version, const uint16_t minor_version)
+{
+	const AmigaROMMajorVersion *major;
+	size_t i;
+
+	if(major_version > AMIGA_ROM_MAX_MAJOR_VERSION)
+	{
+		return NULL;
+	}
 
-	number_of_versions = sizeof(AMIGA_ROM_MAJOR_MINOR_VERSIONS) / sizeof(AmigaROMMajorMinorVersions);
+	major = &(AMIGA_ROM_MAJOR_VERSIONS[major_version]);
+	if(major->version)
+	{
+		return major->version;
+	}
 
-	for(i = 0; i < number_of_versions; i++)
+	for(i = 0; i < major->minor_version_count; i++)
 	{
-		if(AMIGA_ROM_MAJOR_MINOR_VERSIONS[i].major_version == DetectAmigaMajorROMVersion(amiga_rom))
+		if(major->minor_versions[i].minor_version == minor_version)
 		{
-			if((AMIGA_ROM_MAJOR_MINOR_VERSIONS[i].minor_version == 0xffff) || (AMIGA_ROM_MAJOR_MINOR_VERSIONS[i].minor_version == DetectAmigaMinorROMVersion(amiga_rom)))
-			{
-				return AMIGA_ROM_MAJOR_MINOR_VERSIONS[i].version;
-			}
+			return major->minor_versions[i].version;
 		}
 	}
 
@@ -831,57 +2422,49 @@ const char* DetectAmigaMajorMinorROMVersion(const ParsedAmigaROMData *amiga_rom)
 // U - Unknown ROM
 char DetectAmigaROMType(const ParsedAmigaROMData *amiga_rom)
 {
-	uint8_t *digest;
-	char *hexdigest;
-
-	size_t i;
-	size_t rom_quantity = sizeof(AMIGA_ROM_INFO) / sizeof(AmigaROMInfo);
+	const AmigaROMInfo *rom_info = DetectAmigaROMInfo(amiga_rom);
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(!rom_info)
 	{
-		return 'U';
+		return (DetectAmigaROMFamily(amiga_rom) != AMIGA_ROM_FAMILY_UNKNOWN) ? 'O' : 'U';
 	}
 
-	digest = (uint8_t*)malloc(20);
-	if(!digest)
-	{
-		return 'U';
-	}
+	return rom_info->type;
+}
+
+// Classifies an unknown ROM which isn't a Kickstart by the signatures of
+// the non-Kickstart ROM families it contains, in one pass over the ROM.
+// Returns an AMIGA_ROM_FAMILY_* value.
+uint8_t DetectAmigaROMFamily(const ParsedAmigaROMData *amiga_rom)
+{
+	uint8_t header;
 
-	hexdigest = (char*)malloc(65);
-	if(!hexdigest)
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0 || amiga_rom->is_encrypted)
 	{
-		free(digest);
-		digest = NULL;
-		return 'U';
+		return AMIGA_ROM_FAMILY_UNKNOWN;
 	}
 
-	if (SHA256(amiga_rom->rom_data, amiga_rom->rom_size, digest, hexdigest))
+	// Extended ROMs are CDTV and CD32 ROMs, but the rest are Kickstarts
+	header = DetectAmigaKickstartROMTypeFromHeader(amiga_rom) & 0x7F;
+	if(header == 0x01 || header == 0x02 || header == 0x04)
 	{
-		free(digest);
-		digest = NULL;
-		free(hexdigest);
-		hexdigest = NULL;
-		return 'U';
+		return AMIGA_ROM_FAMILY_UNKNOWN;
 	}
 
-	for (i = 0; i < rom_quantity; i++)
+	return ScanAmigaROMSignatures(amiga_rom->rom_data, amiga_rom->rom_size, NULL);
+}
+
+// Same as DetectAmigaROMType, but for a precomputed 32-byte SHA256 digest
+char DetectAmigaROMTypeFromDigest(const uint8_t *digest)
+{
+	const AmigaROMInfo *rom_info = DetectAmigaROMInfoFromDigest(digest);
+
+	if(!rom_info)
 	{
-		if (strncmp(hexdigest, AMIGA_ROM_INFO[i].sha256hash, 40) == 0)
-		{
-			free(digest);
-			digest = NULL;
-			free(hexdigest);
-			hexdigest = NULL;
-			return AMIGA_ROM_INFO[i].type;
-		}
+		return 'U';
 	}
 
-	free(digest);
-	digest = NULL;
-	free(hexdigest);
-	hexdigest = NULL;
-	return 'U';
+	return rom_info->type;
 }
 
 // Detect whether a ROM is a "Kickety-Split ROM"
@@ -1025,132 +2608,315 @@ uint32_t CalculateAmigaROMChecksum(const ParsedAmigaROMData *amiga_rom, const bo
 
 	rom_data_32 = (const uint32_t*)(amiga_rom->rom_data);
 
-	if(amiga_rom->rom_size < 24)
+	if(amiga_rom->rom_size < 24)
+	{
+		return 0xFFFFFFFF;
+	}
+
+	for(i = 0; i < amiga_rom->rom_size / 4; i++)
+	{
+		if(calc_new_sum)
+		{
+			if(i != (amiga_rom->rom_size - 24) / 4)
+			{
+				temp = be32toh(rom_data_32[i]);
+			}
+			else
+			{
+				temp = 0;
+			}
+		}
+		else
+		{
+			temp = be32toh(rom_data_32[i]);
+		}
+
+		if(sum + temp < sum)
+		{
+			sum++;
+		}
+
+		sum += temp;
+	}
+
+	return ~sum;
+}
+
+// Returns the checksum embedded in the ROM, or 0 if it fails.
+// Technically a ROM could have a valid checksum of zero, but 
+// this is exceedingly unlikely.
+uint32_t GetEmbeddedAmigaROMChecksum(const ParsedAmigaROMData *amiga_rom)
+{
+	const uint32_t *rom_data_32 = (const uint32_t*)(amiga_rom->rom_data);
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	{
+		return 0;
+	}
+
+	if(amiga_rom->rom_size < 24)
+	{
+		return 0;
+	}
+
+	return be32toh(rom_data_32[(amiga_rom->rom_size - 24) / 4]);
+}
+
+// Returns a boolean indicating whether the calculated checksum in the ROM
+// matches the calculated checksum for the ROM.
+bool ValidateAmigaROMChecksum(const ParsedAmigaROMData *amiga_rom)
+{
+	uint32_t calculated_sum;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	{
+		return false;
+	}
+
+	calculated_sum = CalculateAmigaROMChecksum(amiga_rom, false);
+
+	return (calculated_sum == 0);
+}
+
+// Calculates and embeds a correct checksum in the ROM.
+// Returns true if it succeeds, or false if it fails.
+bool CorrectAmigaROMChecksum(ParsedAmigaROMData *amiga_rom)
+{
+	uint32_t *rom_data_32;
+	uint32_t old_word;
+
+	uint32_t old_sum = 0;
+	uint32_t new_sum = 0;
+	size_t checksum_offset;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size < 24)
+	{
+		return false;
+	}
+
+	checksum_offset = amiga_rom->rom_size - 24;
+	rom_data_32 = (uint32_t*)(amiga_rom->rom_data);
+	old_sum = GetEmbeddedAmigaROMChecksum(amiga_rom);
+	new_sum = CalculateAmigaROMChecksum(amiga_rom, true);
+
+	if(old_sum == new_sum)
+	{
+		return true;
+	}
+
+	if(new_sum == 0)
+	{
+		return false;
+	}
+
+	// Only the checksum word changes, so patch it in place and put it back if
+	// the result doesn't validate.
+	old_word = rom_data_32[checksum_offset / 4];
+	rom_data_32[checksum_offset / 4] = htobe32(new_sum);
+
+	if(!ValidateAmigaROMChecksum(amiga_rom))
+	{
+		rom_data_32[checksum_offset / 4] = old_word;
+		return false;
+	}
+
+	MarkAmigaROMDataModified(amiga_rom, checksum_offset, 4);
+
+	amiga_rom->has_valid_checksum = true;
+	amiga_rom->valid_fields |= AMIGA_ROM_FIELD_CHECKSUM;
+
+	return true;
+}
+
+// Repairs the ROM against a known good reference_rom of the same size and
+// byte order: every difference FindAmigaROMDifferences() takes for bit rot
+// is overwritten with the reference's bytes, as is every other difference
+// if repair_patches is true.  The checksum is then corrected if it no
+// longer validates, and the repaired ROM is identified again.  If summary
+// isn't NULL, it is set to the differences found before repairing.
+// Returns true if it succeeds, or false if it fails.
+bool RepairAmigaROM(ParsedAmigaROMData *amiga_rom, const ParsedAmigaROMData *reference_rom, const bool repair_patches, AmigaROMDifferenceSummary *summary)
+{
+	AmigaROMDifference *differences;
+	size_t difference_count, i;
+
+	if(!amiga_rom || !reference_rom || !(amiga_rom->rom_data) || !(reference_rom->rom_data) || amiga_rom->is_encrypted || reference_rom->is_encrypted)
+	{
+		return false;
+	}
+
+	if(amiga_rom->rom_size != reference_rom->rom_size || GetAmigaROMIsByteSwapped(amiga_rom) != reference_rom->is_byte_swapped)
+	{
+		return false;
+	}
+
+	difference_count = FindAmigaROMDifferences(amiga_rom->rom_data, reference_rom->rom_data, amiga_rom->rom_size, NULL, 0, summary);
+	if(difference_count == 0)
+	{
+		return true;
+	}
+
+	differences = (AmigaROMDifference*)malloc(difference_count * sizeof(AmigaROMDifference));
+	if(!differences)
 	{
-		return 0xFFFFFFFF;
+		return false;
 	}
 
-	for(i = 0; i < amiga_rom->rom_size / 4; i++)
+	FindAmigaROMDifferences(amiga_rom->rom_data, reference_rom->rom_data, amiga_rom->rom_size, differences, difference_count, NULL);
+
+	for(i = 0; i < difference_count; i++)
 	{
-		if(calc_new_sum)
-		{
-			if(i != (amiga_rom->rom_size - 24) / 4)
-			{
-				temp = be32toh(rom_data_32[i]);
-			}
-			else
-			{
-				temp = 0;
-			}
-		}
-		else
+		if(differences[i].is_bit_flip || repair_patches)
 		{
-			temp = be32toh(rom_data_32[i]);
+			memcpy(amiga_rom->rom_data + differences[i].offset, reference_rom->rom_data + differences[i].offset, differences[i].length);
+			MarkAmigaROMDataModified(amiga_rom, differences[i].offset, differences[i].length);
 		}
+	}
 
-		if(sum + temp < sum)
-		{
-			sum++;
-		}
+	free(differences);
 
-		sum += temp;
+	// A reference without a valid checksum isn't a Kickstart to correct
+	amiga_rom->has_valid_checksum = ValidateAmigaROMChecksum(amiga_rom);
+	amiga_rom->valid_fields |= AMIGA_ROM_FIELD_CHECKSUM;
+	if(!(amiga_rom->has_valid_checksum) && ValidateAmigaROMChecksum(reference_rom) && !CorrectAmigaROMChecksum(amiga_rom))
+	{
+		return false;
 	}
 
-	return ~sum;
+	ConfirmAmigaROMInfo(amiga_rom);
+
+	return true;
 }
 
-// Returns the checksum embedded in the ROM, or 0 if it fails.
-// Technically a ROM could have a valid checksum of zero, but 
-// this is exceedingly unlikely.
-uint32_t GetEmbeddedAmigaROMChecksum(const ParsedAmigaROMData *amiga_rom)
+// Returns the EPROM bank checksums stored for a known merged ROM and sets
+// bank_count to how many there are, or returns NULL if it has none.
+const AmigaROMBankChecksum* GetAmigaROMBankChecksums(const AmigaROMInfo *rom_info, size_t *bank_count)
 {
-	const uint32_t *rom_data_32 = (const uint32_t*)(amiga_rom->rom_data);
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	size_t rom_index, low, high, middle, end;
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(!rom_info || !bank_count || rom_info < database->rom_info || rom_info >= database->rom_info + database->rom_info_count)
 	{
-		return 0;
+		return NULL;
 	}
 
-	if(amiga_rom->rom_size < 24)
+	rom_index = (size_t)(rom_info - database->rom_info);
+
+	low = 0;
+	high = database->bank_checksum_count;
+	while(low < high)
 	{
-		return 0;
+		middle = low + ((high - low) / 2);
+		if(database->bank_checksums[middle].rom_index < rom_index)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
 	}
 
-	return be32toh(rom_data_32[(amiga_rom->rom_size - 24) / 4]);
-}
-
-// Returns a boolean indicating whether the calculated checksum in the ROM
-// matches the calculated checksum for the ROM.
-bool ValidateAmigaROMChecksum(const ParsedAmigaROMData *amiga_rom)
-{
-	uint32_t calculated_sum;
+	end = low;
+	while(end < database->bank_checksum_count && database->bank_checksums[end].rom_index == rom_index)
+	{
+		end++;
+	}
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(end == low)
 	{
-		return false;
+		return NULL;
 	}
 
-	calculated_sum = CalculateAmigaROMChecksum(amiga_rom, false);
+	*bank_count = end - low;
 
-	return (calculated_sum == 0);
+	return &(database->bank_checksums[low]);
 }
 
-// Calculates and embeds a correct checksum in the ROM.
-// Returns true if it succeeds, or false if it fails.
-bool CorrectAmigaROMChecksum(ParsedAmigaROMData *amiga_rom)
+// Works out which EPROM half, and which bank of it, of a merged ROM differs
+// from expected_rom, in one pass over the ROM.  If expected_rom is NULL, the
+// ROM's own known ROM (or the one it's a layout of) is used, or failing that
+// the known ROM of the same size with the most Merkle leaves in common with
+// it.  Returns true if it succeeds, or false if it fails or there's no known
+// ROM with bank checksums to check against.
+bool VerifyAmigaROMEPROMs(const ParsedAmigaROMData *amiga_rom, const AmigaROMInfo *expected_rom, AmigaROMEPROMVerification *verification)
 {
-	uint32_t *rom_data_32;
-	uint8_t *temp_rom_data;
-
-	uint32_t old_sum = 0;
-	uint32_t new_sum = 0;
+	AmigaROMMerkleTree merkle_tree = GetInitializedAmigaROMMerkleTree();
+	AmigaROMBankChecksums bank_checksums;
+	const AmigaROMBankChecksum *expected_checksums = NULL;
+	uint8_t *unswapped_data = NULL;
+	size_t expected_count = 0;
+	size_t i;
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(!amiga_rom || !(amiga_rom->rom_data) || !verification || amiga_rom->is_encrypted)
 	{
 		return false;
 	}
 
-	temp_rom_data = (uint8_t*)malloc(amiga_rom->rom_size);
-	if(!temp_rom_data)
+	// A fingerprint match alone may be a damaged dump of the ROM
+	if(!expected_rom && amiga_rom->rom_info && !(amiga_rom->is_info_unconfirmed))
 	{
-		return false;
+		expected_rom = amiga_rom->rom_info->canonical ? amiga_rom->rom_info->canonical : amiga_rom->rom_info;
 	}
 
-	memcpy(temp_rom_data, amiga_rom->rom_data, amiga_rom->rom_size);
+	// A damaged dump isn't known, so go by its Merkle leaves, which are only
+	// stored for unswapped images
+	if(!expected_rom && amiga_rom->is_byte_swapped)
+	{
+		unswapped_data = (uint8_t*)malloc(amiga_rom->rom_size);
+		if(!unswapped_data)
+		{
+			return false;
+		}
 
-	rom_data_32 = (uint32_t*)temp_rom_data;
-	old_sum = be32toh(amiga_rom->rom_data[(amiga_rom->rom_size - 24) / 4]);
-	new_sum = CalculateAmigaROMChecksum(amiga_rom, true);
+		for(i = 0; i + 1 < amiga_rom->rom_size; i += 2)
+		{
+			unswapped_data[i] = amiga_rom->rom_data[i + 1];
+			unswapped_data[i + 1] = amiga_rom->rom_data[i];
+		}
+	}
 
-	if(old_sum == new_sum)
+	if(!expected_rom && CalculateAmigaROMMerkleTree(unswapped_data ? unswapped_data : amiga_rom->rom_data, amiga_rom->rom_size, 0, &merkle_tree))
 	{
-		free(temp_rom_data);
-		temp_rom_data = NULL;
-		return true;
+		expected_rom = FindClosestAmigaROMInfoFromMerkleLeaves(&merkle_tree, NULL);
+		DestroyAmigaROMMerkleTree(&merkle_tree);
 	}
 
-	if(new_sum == 0)
+	free(unswapped_data);
+
+	if(expected_rom)
 	{
-		free(temp_rom_data);
-		temp_rom_data = NULL;
-		return false;
+		expected_checksums = GetAmigaROMBankChecksums(expected_rom, &expected_count);
 	}
 
-	rom_data_32[(amiga_rom->rom_size - 24) / 4] = htobe32(new_sum);
+	if(!expected_checksums || expected_rom->file_size != amiga_rom->rom_size)
+	{
+		return false;
+	}
 
-	if(!ValidateAmigaROMChecksum(amiga_rom))
+	if(!CalculateAmigaROMBankChecksums(amiga_rom->rom_data, amiga_rom->rom_size, amiga_rom->is_byte_swapped, &bank_checksums) || bank_checksums.bank_count != expected_count)
 	{
-		free(temp_rom_data);
-		temp_rom_data = NULL;
 		return false;
 	}
 
-	memcpy(amiga_rom->rom_data, temp_rom_data, amiga_rom->rom_size);
+	verification->rom_info = expected_rom;
+	verification->bank_count = expected_count;
+	verification->bad_hi_banks = 0;
+	verification->bad_lo_banks = 0;
 
-	amiga_rom->has_valid_checksum = true;
+	for(i = 0; i < expected_count; i++)
+	{
+		if(bank_checksums.hi_crc32[i] != expected_checksums[i].hi_crc32)
+		{
+			verification->bad_hi_banks |= (uint32_t)1 << i;
+		}
+
+		if(bank_checksums.lo_crc32[i] != expected_checksums[i].lo_crc32)
+		{
+			verification->bad_lo_banks |= (uint32_t)1 << i;
+		}
+	}
 
-	free(temp_rom_data);
-	temp_rom_data = NULL;
 	return true;
 }
 
@@ -1214,152 +2980,166 @@ int DetectAmigaROMEncryption(const ParsedAmigaROMData *amiga_rom)
 	return (strncmp((char*)(amiga_rom->rom_data), "AMIROMTYPE1", 11) == 0);
 }
 
-// Encrypts or decrypts Amiga ROMs according to whether crypt_operation is true or false.
-// If true, it will encrypt the ROMs.  If false, it will decrypt them.
-// The function returns true if the method succeeds, and false if it fails.
-// For safety, make sure that rom_contents has space for 11 more bytes than the original
-// ROM had if an encrypt operation is performed.
-bool CryptAmigaROM(ParsedAmigaROMData *amiga_rom, const bool crypt_operation, const char *keyfile_path)
+// Reads a whole keyfile into a newly allocated buffer, which the caller must
+// free.  Returns NULL if the file can't be read or is empty.
+static uint8_t* ReadAmigaROMKeyfile(const char *keyfile_path, size_t *keyfile_size)
 {
 	FILE *fp;
 	uint8_t *keyfile_buffer;
-	uint8_t *result_buffer;
+	long file_size;
 
-	int is_encrypted = 0;
-	size_t keyfile_size = 0;
-	size_t result_size = amiga_rom->rom_size;
-	int seek_status;
+	*keyfile_size = 0;
 
-	if(!amiga_rom || !keyfile_path || !(amiga_rom->rom_data) || (amiga_rom->rom_size == 0 && crypt_operation) || (amiga_rom->rom_size < 11 && !crypt_operation))
+	fp = fopen(keyfile_path, "rb");
+	if(!fp)
 	{
-		return false;
+		return NULL;
 	}
 
-	is_encrypted = DetectAmigaROMEncryption(amiga_rom);
-	if(is_encrypted == -1)
+	if(fseek(fp, 0, SEEK_END) < 0 || (file_size = ftell(fp)) < 1 || fseek(fp, 0, SEEK_SET) < 0)
 	{
-		return false;
+		fclose(fp);
+		return NULL;
 	}
 
-	if(is_encrypted == crypt_operation)
+	keyfile_buffer = (uint8_t*)malloc((size_t)file_size);
+	if(!keyfile_buffer)
 	{
-		return false;
+		fclose(fp);
+		return NULL;
 	}
 
-	if(crypt_operation)
-	{
-		result_buffer = (uint8_t*)malloc((amiga_rom->rom_size + 11));
-	}
-	else
+	if(fread(keyfile_buffer, 1, (size_t)file_size, fp) != (size_t)file_size)
 	{
-		result_buffer = (uint8_t*)malloc((amiga_rom->rom_size - 11));
+		fclose(fp);
+		free(keyfile_buffer);
+		return NULL;
 	}
 
-	if(!result_buffer)
-	{
-		return false;
-	}
+	fclose(fp);
 
-	fp = fopen(keyfile_path, "rb");
-	if(!fp)
-	{
-		free(result_buffer);
-		result_buffer = NULL;
-		return false;
-	}
+	*keyfile_size = (size_t)file_size;
 
-	seek_status = fseek(fp, 0, SEEK_END);
+	return keyfile_buffer;
+}
 
-	if(seek_status < 0)
-	{
-		free(result_buffer);
-		result_buffer = NULL;
-		return false;
-	}
-	else
-	{
-		keyfile_size = (size_t)ftell(fp);
-		fseek(fp, 0, SEEK_SET);
-	}
+// XORs size bytes of source with the key, starting at key_index, into
+// destination.  destination may be source itself, or any address before it
+// in the same buffer, as every byte is read before it can be overwritten.
+// Returns the key index for the byte after the last one processed.
+static size_t CryptAmigaROMChunk(const uint8_t *source, uint8_t *destination, const size_t size, const uint8_t *keyfile_data, const size_t keyfile_size, size_t key_idx)
+{
+	size_t i;
 
-	keyfile_buffer = (uint8_t*)malloc(keyfile_size);
-	if(!keyfile_buffer)
+	for(i = 0; i < size; i++)
 	{
-		free(result_buffer);
-		result_buffer = NULL;
-		return false;
+		destination[i] = source[i] ^ keyfile_data[key_idx];
+
+		if(++key_idx == keyfile_size)
+		{
+			key_idx = 0;
+		}
 	}
 
-	fread(keyfile_buffer, 1, keyfile_size, fp);
+	return key_idx;
+}
 
-	fclose(fp);
+// Encrypts or decrypts Amiga ROMs according to whether crypt_operation is true or false.
+// If true, it will encrypt the ROMs.  If false, it will decrypt them.
+// The function returns true if the method succeeds, and false if it fails.
+// Both directions work in place, without a second copy of the ROM.  Decrypting
+// also hashes each chunk as it is decrypted, so the ROM's digests are cached
+// without another pass over it.
+bool CryptAmigaROM(ParsedAmigaROMData *amiga_rom, const bool crypt_operation, const char *keyfile_path)
+{
+	AmigaROMDigestContext digest_context;
+	uint8_t *keyfile_buffer;
+	uint8_t *test_ptr;
+
+	int is_encrypted = 0;
+	size_t keyfile_size = 0;
+	size_t result_size;
+	size_t offset, chunk_size;
+	size_t key_idx = 0;
 
-	if(keyfile_size < 1)
+	if(!amiga_rom || !keyfile_path || !(amiga_rom->rom_data) || (amiga_rom->rom_size == 0 && crypt_operation) || (amiga_rom->rom_size < 11 && !crypt_operation))
 	{
-		free(keyfile_buffer);
-		keyfile_buffer = NULL;
-		free(result_buffer);
-		result_buffer = NULL;
 		return false;
 	}
 
-	if(is_encrypted)
+	is_encrypted = DetectAmigaROMEncryption(amiga_rom);
+	if(is_encrypted == -1)
 	{
-		result_size = result_size - 11;
-		memcpy(result_buffer, &(amiga_rom->rom_data)[11], result_size);
+		return false;
 	}
-	else
+
+	if(is_encrypted == crypt_operation)
 	{
-		memcpy(result_buffer, amiga_rom->rom_data, result_size);
+		return false;
 	}
 
-	if(!DoAmigaROMCryptOperation(result_buffer, result_size, keyfile_buffer, keyfile_size))
+	keyfile_buffer = ReadAmigaROMKeyfile(keyfile_path, &keyfile_size);
+	if(!keyfile_buffer)
 	{
-		free(keyfile_buffer);
-		keyfile_buffer = NULL;
-		free(result_buffer);
-		result_buffer = NULL;
 		return false;
 	}
 
 	if(is_encrypted)
 	{
-		amiga_rom->rom_data = realloc(amiga_rom->rom_data, result_size);
-		if(!amiga_rom->rom_data)
+		result_size = amiga_rom->rom_size - 11;
+
+		InvalidateAmigaROMDigest(amiga_rom);
+		InitAmigaROMDigestContext(&digest_context, amiga_rom->requested_digests | AMIGA_ROM_DIGEST_SHA256);
+
+		// Decrypt each chunk down over the header and hash it while it's still in cache
+		for(offset = 0; offset < result_size; offset += chunk_size)
 		{
-			free(keyfile_buffer);
-			keyfile_buffer = NULL;
-			free(result_buffer);
-			result_buffer = NULL;
-			return false;
+			chunk_size = result_size - offset;
+			if(chunk_size > AMIGA_ROM_CRYPT_CHUNK_SIZE)
+			{
+				chunk_size = AMIGA_ROM_CRYPT_CHUNK_SIZE;
+			}
+
+			key_idx = CryptAmigaROMChunk(&(amiga_rom->rom_data)[offset + 11], &(amiga_rom->rom_data)[offset], chunk_size, keyfile_buffer, keyfile_size, key_idx);
+			UpdateAmigaROMDigestContext(&digest_context, &(amiga_rom->rom_data)[offset], chunk_size);
 		}
 
-		memcpy(amiga_rom->rom_data, result_buffer, result_size);
 		amiga_rom->rom_size = result_size;
+
+		// Shrinking can't lose data, so a failure just leaves the buffer larger
+		test_ptr = (result_size > 0) ? realloc(amiga_rom->rom_data, result_size) : NULL;
+		if(test_ptr)
+		{
+			amiga_rom->rom_data = test_ptr;
+		}
+
+		FinalizeAmigaROMDigestContext(&digest_context, &(amiga_rom->digests));
+		amiga_rom->rom_info = DetectAmigaROMInfoFromDigest(amiga_rom->digests.sha256);
 	}
 	else
 	{
-		amiga_rom->rom_data = realloc(amiga_rom->rom_data, (result_size + 11));
-		if(!amiga_rom->rom_data)
+		result_size = amiga_rom->rom_size;
+
+		test_ptr = realloc(amiga_rom->rom_data, (result_size + 11));
+		if(!test_ptr)
 		{
 			free(keyfile_buffer);
 			keyfile_buffer = NULL;
-			free(result_buffer);
-			result_buffer = NULL;
 			return false;
 		}
 
-		snprintf((char*)(amiga_rom->rom_data), 12, "AMIROMTYPE1");
-		memcpy(&(amiga_rom->rom_data)[11], result_buffer, result_size);
+		amiga_rom->rom_data = test_ptr;
+		memmove(&(amiga_rom->rom_data)[11], amiga_rom->rom_data, result_size);
+		CryptAmigaROMChunk(&(amiga_rom->rom_data)[11], &(amiga_rom->rom_data)[11], result_size, keyfile_buffer, keyfile_size, 0);
+		memcpy(amiga_rom->rom_data, "AMIROMTYPE1", 11);
 		amiga_rom->rom_size = result_size + 11;
+		InvalidateAmigaROMDigest(amiga_rom);
 
 		ParseAmigaROMData(amiga_rom, NULL);
 	}
 
 	free(keyfile_buffer);
 	keyfile_buffer = NULL;
-	free(result_buffer);
-	result_buffer = NULL;
 
 	return true;
 }
@@ -1367,81 +3147,135 @@ bool CryptAmigaROM(ParsedAmigaROMData *amiga_rom, const bool crypt_operation, co
 // Run the actual crypt operation, using the ROM data and keyfile data
 bool DoAmigaROMCryptOperation(uint8_t *rom_data_without_crypt_header, const size_t rom_size, const uint8_t *keyfile_data, const size_t keyfile_size)
 {
-	size_t i = 0;
+	if(!rom_data_without_crypt_header || rom_size == 0 || !keyfile_data || keyfile_size == 0)
+	{
+		return false;
+	}
+
+	CryptAmigaROMChunk(rom_data_without_crypt_header, rom_data_without_crypt_header, rom_size, keyfile_data, keyfile_size, 0);
+
+	return true;
+}
+
+// Calculates the digests selected by requested_digests (AMIGA_ROM_DIGEST_*
+// bits) of the decrypted contents of an encrypted ROM.  Each chunk is
+// decrypted into a small buffer and hashed straight away, so the ROM is left
+// encrypted and no decrypted copy of it is ever held.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateEncryptedAmigaROMDigests(const ParsedAmigaROMData *amiga_rom, const char *keyfile_path, const uint8_t requested_digests, AmigaROMDigests *digests)
+{
+	AmigaROMDigestContext digest_context;
+	uint8_t chunk_buffer[AMIGA_ROM_CRYPT_CHUNK_SIZE];
+	uint8_t *keyfile_buffer;
+	size_t keyfile_size = 0;
+	size_t result_size;
+	size_t offset, chunk_size;
 	size_t key_idx = 0;
 
-	if(!rom_data_without_crypt_header || rom_size == 0 || !keyfile_data || keyfile_size == 0)
+	if(!amiga_rom || !keyfile_path || !digests || DetectAmigaROMEncryption(amiga_rom) != 1)
+	{
+		return false;
+	}
+
+	keyfile_buffer = ReadAmigaROMKeyfile(keyfile_path, &keyfile_size);
+	if(!keyfile_buffer)
 	{
 		return false;
 	}
 
-	for(i = 0; i < rom_size; i++)
+	result_size = amiga_rom->rom_size - 11;
+	InitAmigaROMDigestContext(&digest_context, requested_digests);
+
+	for(offset = 0; offset < result_size; offset += chunk_size)
 	{
-		rom_data_without_crypt_header[i] ^= keyfile_data[key_idx];
-		key_idx = (key_idx + 1) % keyfile_size;
+		chunk_size = result_size - offset;
+		if(chunk_size > AMIGA_ROM_CRYPT_CHUNK_SIZE)
+		{
+			chunk_size = AMIGA_ROM_CRYPT_CHUNK_SIZE;
+		}
+
+		key_idx = CryptAmigaROMChunk(&(amiga_rom->rom_data)[offset + 11], chunk_buffer, chunk_size, keyfile_buffer, keyfile_size, key_idx);
+		UpdateAmigaROMDigestContext(&digest_context, chunk_buffer, chunk_size);
 	}
 
+	FinalizeAmigaROMDigestContext(&digest_context, digests);
+
+	free(keyfile_buffer);
+	keyfile_buffer = NULL;
+
 	return true;
 }
 
+// Identifies an encrypted ROM without decrypting it, using
+// CalculateEncryptedAmigaROMDigests.  Returns NULL if the ROM isn't
+// encrypted, can't be decrypted with the keyfile, or is unknown.
+const AmigaROMInfo* DetectEncryptedAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, const char *keyfile_path)
+{
+	AmigaROMDigests digests;
+
+	if(!CalculateEncryptedAmigaROMDigests(amiga_rom, keyfile_path, AMIGA_ROM_DIGEST_SHA256, &digests))
+	{
+		return NULL;
+	}
+
+	return DetectAmigaROMInfoFromDigest(digests.sha256);
+}
+
 // 0 indicates the ROM is not byte swapped (the ROM is for emulators)
 // 1 indicates the ROM is byte swapped (the ROM is for physical ICs)
 // -1 indicates the ROM is not an Amiga ROM known to this library,
 //    and the header is not indicative of its byte swappiness.
 int DetectAmigaROMByteSwap(const ParsedAmigaROMData *amiga_rom)
 {
-	uint8_t *digest;
-	char *hexdigest;
-
-	uint8_t rom_type = 0;
-	size_t i;
-	size_t rom_quantity = sizeof(AMIGA_ROM_INFO) / sizeof(AmigaROMInfo);
+	uint8_t digest[32];
 
-	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
+	if(!GetAmigaROMDigest(amiga_rom, digest))
 	{
 		return -1;
 	}
 
-	digest = (uint8_t*)malloc(20);
-	if(!digest)
+	return DetectAmigaROMByteSwapFromDigest(amiga_rom, digest);
+}
+
+// Same as DetectAmigaROMByteSwap, but for a precomputed 32-byte SHA256 digest
+// of the ROM.  The ROM header is still consulted if the digest is unknown.
+int DetectAmigaROMByteSwapFromDigest(const ParsedAmigaROMData *amiga_rom, const uint8_t *digest)
+{
+	const AmigaROMInfo *rom_info;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0 || !digest)
 	{
 		return -1;
 	}
 
-	hexdigest = (char*)malloc(65);
-	if(!hexdigest)
+	if((amiga_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256) && memcmp(digest, amiga_rom->digests.sha256, 32) == 0)
 	{
-		free(digest);
-		digest = NULL;
-		return -1;
+		rom_info = amiga_rom->rom_info;
+	}
+	else
+	{
+		rom_info = DetectAmigaROMInfoFromDigest(digest);
 	}
 
-	if (SHA256(amiga_rom->rom_data, amiga_rom->rom_size, digest, hexdigest))
+	return DetectAmigaROMByteSwapFromInfo(amiga_rom, rom_info);
+}
+
+// Same as DetectAmigaROMByteSwap, but for an already identified database
+// entry, or NULL to go by the ROM header alone.
+static int DetectAmigaROMByteSwapFromInfo(const ParsedAmigaROMData *amiga_rom, const AmigaROMInfo *rom_info)
+{
+	uint8_t rom_type = 0;
+
+	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0)
 	{
-		free(digest);
-		digest = NULL;
-		free(hexdigest);
-		hexdigest = NULL;
 		return -1;
 	}
 
-	for (i = 0; i < rom_quantity; i++)
+	if(rom_info)
 	{
-		if (strncmp(hexdigest, AMIGA_ROM_INFO[i].sha256hash, 40) == 0)
-		{
-			free(digest);
-			digest = NULL;
-			free(hexdigest);
-			hexdigest = NULL;
-			return AMIGA_ROM_INFO[i].byte_swap;
-		}
+		return rom_info->byte_swap;
 	}
 
-	free(digest);
-	digest = NULL;
-	free(hexdigest);
-	hexdigest = NULL;
-
 	rom_type = DetectAmigaKickstartROMTypeFromHeader(amiga_rom);
 
 	if((rom_type & 0x80) == 0x80)
@@ -1515,6 +3349,7 @@ bool SetAmigaROMByteSwap(ParsedAmigaROMData *amiga_rom, const bool swap_bytes, c
 		}
 
 		amiga_rom->is_byte_swapped = !(amiga_rom->is_byte_swapped);
+		InvalidateAmigaROMDigest(amiga_rom);
 		return true;
 	}
 
@@ -1529,19 +3364,23 @@ bool SplitAmigaROM(const ParsedAmigaROMData *amiga_rom, ParsedAmigaROMData *rom_
 	uint8_t *test_ptr;
 
 	size_t i;
+	int is_swapped;
+	bool is_byte_swapped;
+	bool toggle_swap = false;
 
 	if(!amiga_rom || !(amiga_rom->rom_data) || amiga_rom->rom_size == 0 || amiga_rom->rom_size % 2 != 0 || !rom_high || !rom_low)
 	{
 		return false;
 	}
 
-	ParsedAmigaROMData *temp_rom_data = (ParsedAmigaROMData*)malloc(sizeof(*amiga_rom));
-
-	memcpy(temp_rom_data, amiga_rom, sizeof(*amiga_rom));
-
-	if(temp_rom_data->parsed_rom)
+	// Known ROMs have their byte order toggled in the split halves.  This is
+	// done while copying so the source ROM (and its cached digest) is left as-is.
+	// A lazily parsed ROM's byte order is whatever is detected.
+	if(amiga_rom->parsed_rom)
 	{
-		SetAmigaROMByteSwap(temp_rom_data, !(temp_rom_data->is_byte_swapped), temp_rom_data->is_byte_swapped, false);
+		is_swapped = DetectAmigaROMByteSwap(amiga_rom);
+		is_byte_swapped = (amiga_rom->valid_fields & AMIGA_ROM_FIELD_BYTE_SWAP) ? amiga_rom->is_byte_swapped : (is_swapped == 1);
+		toggle_swap = (is_swapped == 0 && !is_byte_swapped) || (is_swapped == 1 && is_byte_swapped);
 	}
 
 	if(rom_high->rom_data)
@@ -1549,7 +3388,6 @@ bool SplitAmigaROM(const ParsedAmigaROMData *amiga_rom, ParsedAmigaROMData *rom_
 		test_ptr = realloc(rom_high->rom_data, amiga_rom->rom_size);
 		if(!test_ptr)
 		{
-			free(temp_rom_data);
 			return false;
 		}
 		else
@@ -1564,7 +3402,6 @@ bool SplitAmigaROM(const ParsedAmigaROMData *amiga_rom, ParsedAmigaROMData *rom_
 		test_ptr = (uint8_t*)malloc(amiga_rom->rom_size);
 		if(!test_ptr)
 		{
-			free(temp_rom_data);
 			return false;
 		}
 		else
@@ -1582,7 +3419,6 @@ bool SplitAmigaROM(const ParsedAmigaROMData *amiga_rom, ParsedAmigaROMData *rom_
 		test_ptr = realloc(rom_low->rom_data, amiga_rom->rom_size);
 		if(!test_ptr)
 		{
-			free(temp_rom_data);
 			return false;
 		}
 		else
@@ -1597,7 +3433,6 @@ bool SplitAmigaROM(const ParsedAmigaROMData *amiga_rom, ParsedAmigaROMData *rom_
 		test_ptr = (uint8_t*)malloc(amiga_rom->rom_size);
 		if(!test_ptr)
 		{
-			free(temp_rom_data);
 			return false;
 		}
 		else
@@ -1610,18 +3445,29 @@ bool SplitAmigaROM(const ParsedAmigaROMData *amiga_rom, ParsedAmigaROMData *rom_
 
 	for(i = 0; i < amiga_rom->rom_size; i = i + 4)
 	{
-		memcpy(&(rom_high->rom_data)[i / 2], &(amiga_rom->rom_data)[i], 2);
-		memcpy(&(rom_low->rom_data)[i / 2], &(amiga_rom->rom_data)[i + 2], 2);
+		if(toggle_swap)
+		{
+			(rom_high->rom_data)[i / 2] = (amiga_rom->rom_data)[i + 1];
+			(rom_high->rom_data)[(i / 2) + 1] = (amiga_rom->rom_data)[i];
+			(rom_low->rom_data)[i / 2] = (amiga_rom->rom_data)[i + 3];
+			(rom_low->rom_data)[(i / 2) + 1] = (amiga_rom->rom_data)[i + 2];
+		}
+		else
+		{
+			memcpy(&(rom_high->rom_data)[i / 2], &(amiga_rom->rom_data)[i], 2);
+			memcpy(&(rom_low->rom_data)[i / 2], &(amiga_rom->rom_data)[i + 2], 2);
+		}
 	}
 
 	memcpy(&(rom_high->rom_data)[amiga_rom->rom_size / 2], &(rom_high->rom_data)[0], amiga_rom->rom_size / 2);
 	memcpy(&(rom_low->rom_data)[amiga_rom->rom_size / 2], &(rom_low->rom_data)[0], amiga_rom->rom_size / 2);
 
+	// The halves of a ROM are parsed no further than the ROM itself
+	rom_high->parse_fields &= amiga_rom->parse_fields;
+	rom_low->parse_fields &= amiga_rom->parse_fields;
 	ParseAmigaROMData(rom_high, NULL);
 	ParseAmigaROMData(rom_low, NULL);
 
-	free(temp_rom_data);
-
 	return true;
 }
 
@@ -1675,6 +3521,8 @@ bool MergeAmigaROM(const ParsedAmigaROMData *rom_high, const ParsedAmigaROMData
 
 	amiga_rom->rom_size = rom_high->rom_size;
 
+	// A merge is parsed no further than either of its halves
+	amiga_rom->parse_fields &= (rom_high->parse_fields | rom_low->parse_fields);
 	ParseAmigaROMData(amiga_rom, NULL);
 
 	return true;
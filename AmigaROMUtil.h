@@ -29,14 +29,45 @@ SOFTWARE.
 extern "C" {
 #endif
 
+#include "AmigaROMDatabase.h"
+#include "AmigaROMDigests.h"
 #include "AmigaROMHashes.h"
+#include "AmigaROMMerkle.h"
+#include "AmigaROMModules.h"
+#include "AmigaROMRepair.h"
+#include "AmigaROMSignatures.h"
 
 #include <stdbool.h>
 #include <stdint.h>
 
+// Groups of ParsedAmigaROMData fields, for valid_fields and
+// EnsureAmigaROMFields()
+#define AMIGA_ROM_FIELD_NONE          0x0000
+#define AMIGA_ROM_FIELD_SIZE          0x0001 // validated_size
+#define AMIGA_ROM_FIELD_RESET_VECTOR  0x0002 // has_reset_vector
+#define AMIGA_ROM_FIELD_INFO          0x0004 // rom_info, type and version
+#define AMIGA_ROM_FIELD_BYTE_SWAP     0x0008 // is_byte_swapped
+#define AMIGA_ROM_FIELD_CHECKSUM      0x0010 // has_valid_checksum
+#define AMIGA_ROM_FIELD_HEADER        0x0020 // header
+#define AMIGA_ROM_FIELD_FOOTER        0x0040 // valid_footer
+#define AMIGA_ROM_FIELD_VERSIONS      0x0080 // major_version, minor_version and major_minor_version
+#define AMIGA_ROM_FIELD_KICKETY_SPLIT 0x0100 // is_kickety_split
+#define AMIGA_ROM_FIELD_FAMILY        0x0200 // modules and family of unknown ROMs
+#define AMIGA_ROM_FIELD_DIGESTS       0x0400 // the digests selected by requested_digests
+#define AMIGA_ROM_FIELD_ALL           0x07FF
+
+// valid_fields holds the AMIGA_ROM_FIELD_* bits of the fields which are up
+// to date.  parse_fields is the parse profile: the fields ParseAmigaROMData
+// works out up front, every field by default.  Any other field is only
+// worked out when an accessor such as GetAmigaROMVersion() first asks for it.
+// is_info_unconfirmed is set while rom_info, type and version rest on a
+// unique structural fingerprint match alone; ConfirmAmigaROMInfo() checks
+// them against the SHA256 digest.
 typedef struct {
 	bool is_initialized;
 	bool parsed_rom;
+	uint16_t parse_fields;
+	uint16_t valid_fields;
 	uint8_t *rom_data;
 	size_t rom_size;
 	bool validated_size;
@@ -48,14 +79,52 @@ typedef struct {
 	bool has_valid_checksum;
 	uint8_t header;
 	char type;
+	uint8_t family;
 	const char *version;
 	uint16_t major_version;
 	uint16_t minor_version;
 	const char *major_minor_version;
 	bool is_kickety_split;
 	bool valid_footer;
+	uint8_t requested_digests;
+	AmigaROMDigests digests;
+	const AmigaROMInfo *rom_info;
+	bool is_info_unconfirmed;
+	uint32_t *sha256_checkpoints;
+	size_t sha256_checkpoint_count;
+	AmigaROMModule *modules;
+	size_t module_count;
 } ParsedAmigaROMData;
 
+// Bytes of ROM data between SHA256 midstate checkpoints
+#define AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL 16384
+
+// A known ROM similar to an image, from FindSimilarAmigaROMInfo().
+// similarity is the estimated fraction of their 4KB blocks the two have in
+// common, wherever they are, and matching_leaves is how many blocks are the
+// same at the same address.
+typedef struct {
+	const AmigaROMInfo *rom_info;
+	double similarity;
+	size_t matching_leaves;
+} AmigaROMSimilarity;
+
+// Result of VerifyAmigaROMEPROMs(): the known ROM the image was checked
+// against, how many AMIGA_ROM_EPROM_BANK_SIZE byte banks each EPROM half has,
+// and a bit per bank of the Hi (U34) and Lo (U35) halves which differs from
+// it.
+typedef struct {
+	const AmigaROMInfo *rom_info;
+	size_t bank_count;
+	uint32_t bad_hi_banks;
+	uint32_t bad_lo_banks;
+} AmigaROMEPROMVerification;
+
+// Results of MatchAmigaROMFingerprint()
+#define AMIGA_ROM_FINGERPRINT_NO_MATCH     0
+#define AMIGA_ROM_FINGERPRINT_UNIQUE       1
+#define AMIGA_ROM_FINGERPRINT_NEEDS_DIGEST 2
+
 typedef struct {
 	char *successfully_parsed;
 	char *rom_size_validated;
@@ -73,6 +142,10 @@ typedef struct {
 	char *detected_embedded_rom_version;
 	char *is_kickety_split;
 	char *has_valid_footer;
+	char *crc32;
+	char *md5;
+	char *sha1;
+	char *sha256;
 } AmigaROMInfoData;
 
 // Create and return a new and initialized struct.
@@ -94,9 +167,29 @@ void DestroyInitializedAmigaROMInfoData(AmigaROMInfoData *rom_info);
 
 // Returns a parsed ROM data struct, with the ROM data and size included.
 // If anything files, parsed_rom will be false.  If encrypted, the ROM
-// will be decrypted.
+// will be decrypted.  The ROM is identified by its structural fingerprint
+// where that is enough, leaving the match unconfirmed; see ParseAmigaROMData.
 ParsedAmigaROMData ReadAmigaROM(const char *rom_file_path, const char *keyfile_path);
 
+// Same as ReadAmigaROM, but also calculates the digests selected by
+// requested_digests (AMIGA_ROM_DIGEST_* bits) in a single pass.  Requesting
+// AMIGA_ROM_DIGEST_SHA256 always confirms the identification by digest.
+ParsedAmigaROMData ReadAmigaROMWithDigests(const char *rom_file_path, const char *keyfile_path, const uint8_t requested_digests);
+
+// Same as ReadAmigaROM, but parses the ROM lazily: the file is read and
+// decrypted, and every other field is left to be worked out on first access
+// through the accessors below, so a ROM which is only split, swapped or
+// written never has the rest of its analysis done.
+ParsedAmigaROMData ReadAmigaROMLazily(const char *rom_file_path, const char *keyfile_path);
+
+// Same as ReadAmigaROMWithDigests, but only works out the fields selected by
+// parse_fields (AMIGA_ROM_FIELD_* bits), and those they depend on, up front.
+// Stages no field in the profile needs aren't run at all: the digests are
+// only calculated for AMIGA_ROM_FIELD_DIGESTS, or for AMIGA_ROM_FIELD_INFO
+// when the fingerprint can't pick out a single ROM, so a profile of just
+// AMIGA_ROM_FIELD_CHECKSUM validates a ROM without hashing it.
+ParsedAmigaROMData ReadAmigaROMWithProfile(const char *rom_file_path, const char *keyfile_path, const uint8_t requested_digests, const uint16_t parse_fields);
+
 // Detect whether a ROM is an Amiga kickstart ROM based on size, header, reset vector,
 // magic, and footer.
 bool IsAmigaROM(const ParsedAmigaROMData *amiga_rom);
@@ -104,10 +197,50 @@ bool IsAmigaROM(const ParsedAmigaROMData *amiga_rom);
 // Puts ROM info data into output_string
 void PrintAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, char *output_string, const size_t string_length);
 
+// Puts the ROM's composition into output_string: which known ROMs its
+// resident modules were first found in, e.g. "exec.library 47 and 20 more
+// from ... + scsi.device 45 from ...", followed by one line per module.
+// Puts an empty string if the ROM has no modules; see DecomposeAmigaROM.
+void PrintAmigaROMComposition(const ParsedAmigaROMData *amiga_rom, char *output_string, const size_t string_length);
+
 // Parses and validates the data in the Amiga ROM updates the struct
-// passed in with that data.
+// passed in with that data.  The ROM is looked up by structural fingerprint
+// first: sizes and fingerprints which can't belong to a known ROM are
+// rejected without hashing, and a unique fingerprint match sets rom_info
+// without hashing, with is_info_unconfirmed set, unless requested_digests
+// includes SHA256.  Otherwise the SHA256 digest decides.  Call
+// ConfirmAmigaROMInfo() before relying on an unconfirmed match.
+// Unknown ROMs are decomposed into their resident modules.  Only the fields
+// in parse_fields are worked out; the ROM is always checked and decrypted,
+// and the rest is left to EnsureAmigaROMFields().
 void ParseAmigaROMData(ParsedAmigaROMData *amiga_rom, const char* keyfile_path);
 
+// Works out every field selected by fields (AMIGA_ROM_FIELD_* bits), and
+// those they depend on, which isn't in valid_fields yet, and adds them to
+// it.  The library's mutators drop fields from valid_fields when they change
+// the ROM data.  Functions which take a const ParsedAmigaROMData read its
+// fields as they stand, so ensure the fields they use first for a lazily
+// parsed ROM.  Returns true if it succeeds, or false if the ROM isn't parsed.
+bool EnsureAmigaROMFields(ParsedAmigaROMData *amiga_rom, const uint16_t fields);
+
+// Accessors returning a field of a parsed ROM, working it out first if it
+// isn't valid, as EnsureAmigaROMFields() does.
+bool GetAmigaROMValidatedSize(ParsedAmigaROMData *amiga_rom);
+bool GetAmigaROMHasResetVector(ParsedAmigaROMData *amiga_rom);
+const AmigaROMInfo* GetAmigaROMInfo(ParsedAmigaROMData *amiga_rom);
+char GetAmigaROMType(ParsedAmigaROMData *amiga_rom);
+const char* GetAmigaROMVersion(ParsedAmigaROMData *amiga_rom);
+bool GetAmigaROMIsByteSwapped(ParsedAmigaROMData *amiga_rom);
+bool GetAmigaROMHasValidChecksum(ParsedAmigaROMData *amiga_rom);
+uint8_t GetAmigaROMHeader(ParsedAmigaROMData *amiga_rom);
+bool GetAmigaROMHasValidFooter(ParsedAmigaROMData *amiga_rom);
+uint16_t GetAmigaROMMajorVersion(ParsedAmigaROMData *amiga_rom);
+uint16_t GetAmigaROMMinorVersion(ParsedAmigaROMData *amiga_rom);
+const char* GetAmigaROMMajorMinorVersion(ParsedAmigaROMData *amiga_rom);
+bool GetAmigaROMIsKicketySplit(ParsedAmigaROMData *amiga_rom);
+uint8_t GetAmigaROMFamily(ParsedAmigaROMData *amiga_rom);
+const AmigaROMDigests* GetAmigaROMDigests(ParsedAmigaROMData *amiga_rom);
+
 // Return whether an Amiga ROM is a valid size, accounting for
 // encryption, if it's there.
 bool ValidateAmigaROMSize(const ParsedAmigaROMData *amiga_rom);
@@ -116,10 +249,114 @@ bool ValidateAmigaROMSize(const ParsedAmigaROMData *amiga_rom);
 // Returns true if there is, or false if there isn't.
 bool ValidateAmigaROMResetVector(const ParsedAmigaROMData *amiga_rom);
 
-// Detects the version of the ROM by SHA1 hash
+// Calculates the SHA256 digest of the ROM data and caches it, along with
+// the matching entry from the known ROM database (or NULL if there is none),
+// in the struct.  Does nothing if the digest is already cached, and after
+// MarkAmigaROMDataModified only re-hashes from the first modified checkpoint.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateAmigaROMDigest(ParsedAmigaROMData *amiga_rom);
+
+// Calculates every digest selected by requested_digests (AMIGA_ROM_DIGEST_*
+// bits) which isn't already cached, in a single pass over the ROM data, and
+// caches the results in amiga_rom->digests.  Returns true if it succeeds,
+// or false if it fails.
+bool CalculateAmigaROMDigests(ParsedAmigaROMData *amiga_rom, const uint8_t requested_digests);
+
+// Marks length bytes at offset as modified.  The cached digests and modules
+// are dropped, but the SHA256 midstates saved every AMIGA_ROM_SHA256_CHECKPOINT_INTERVAL
+// bytes before offset are kept, so the next SHA256 calculation resumes from
+// the checkpoint just before the change.  The library's own mutators already
+// do this.
+void MarkAmigaROMDataModified(ParsedAmigaROMData *amiga_rom, const size_t offset, const size_t length);
+
+// Marks the cached digests, SHA256 checkpoints and database entry as stale,
+// and frees any modules.  Must be called after replacing or resizing
+// rom_data directly, or after changing it without MarkAmigaROMDataModified;
+// the library's own mutators already do this.
+void InvalidateAmigaROMDigest(ParsedAmigaROMData *amiga_rom);
+
+// Returns the known ROM database entry for the ROM, using the cached digest
+// if there is one.  Returns NULL if the ROM is unknown.
+const AmigaROMInfo* DetectAmigaROMInfo(const ParsedAmigaROMData *amiga_rom);
+
+// Returns the known ROM database entry for a precomputed 32-byte SHA256
+// digest.  Returns NULL if the digest is unknown.
+const AmigaROMInfo* DetectAmigaROMInfoFromDigest(const uint8_t *digest);
+
+// Looks the ROM up as each of the views selected by requested_views
+// (AMIGA_ROM_VIEW_* bits), hashing all of them in one pass over rom_data
+// instead of byte swapping or splitting it into new buffers.  A whole view
+// identifies the ROM on its own, but the Hi and Lo views only do together,
+// when both halves in the same byte order are halves of the same known ROM.
+// Returns the known entry identified (for a pair of halves, the ROM they
+// are halves of if it is known, or else the Hi half) and, if matched_view
+// isn't NULL, sets it to the view or views which matched.  Returns NULL if
+// the ROM isn't identified; then, if partial_match isn't NULL, it is set to
+// the entry a single half matched (and matched_view to that half's view),
+// or NULL if none did, so a damaged dump can still be compared against it.
+const AmigaROMInfo* DetectAmigaROMInfoFromViews(const ParsedAmigaROMData *amiga_rom, const uint8_t requested_views, uint8_t *matched_view, const AmigaROMInfo **partial_match);
+
+// Reads the structural fingerprint (size, header, major/minor version,
+// checksum and footer words) of the ROM into fingerprint.
+// Returns true if it succeeds, or false if the ROM is too small.
+bool GetAmigaROMFingerprint(const ParsedAmigaROMData *amiga_rom, AmigaROMFingerprint *fingerprint);
+
+// Looks the ROM's structural fingerprint up without hashing anything.
+// Returns AMIGA_ROM_FINGERPRINT_NO_MATCH if no known ROM has its size, or
+// none has its fingerprint and every known ROM of its size has one.
+// Returns AMIGA_ROM_FINGERPRINT_UNIQUE (and sets rom_info, if it isn't NULL)
+// if exactly one known ROM has its fingerprint.  That is only a candidate:
+// a dump with damage outside the fingerprinted words still matches, so only
+// the SHA256 digest confirms it.  Otherwise returns
+// AMIGA_ROM_FINGERPRINT_NEEDS_DIGEST, as only the SHA256 digest can tell.
+int MatchAmigaROMFingerprint(const ParsedAmigaROMData *amiga_rom, const AmigaROMInfo **rom_info);
+
+// Confirms the identification made by ParseAmigaROMData with the SHA256
+// digest, whatever parse_fields said, updating rom_info, version, type and
+// is_byte_swapped to match and clearing is_info_unconfirmed.  Only hashes
+// the ROM if its SHA256 digest isn't cached yet.
+// Returns true if the ROM is a known ROM, or false if it isn't or it fails.
+bool ConfirmAmigaROMInfo(ParsedAmigaROMData *amiga_rom);
+
+// Returns the known ROM database entry whose Merkle root matches a 32-byte
+// root from CalculateAmigaROMMerkleTree().  Only entries generated from a
+// ROM image carry a root.  Returns NULL if the root is unknown.
+const AmigaROMInfo* DetectAmigaROMInfoFromMerkleRoot(const uint8_t *root);
+
+// Returns the known ROM database entry with the same number of Merkle leaves
+// as merkle_tree and the most leaves in common with it, and if
+// matching_leaves isn't NULL, sets it to how many match.  Pass the result's
+// merkle->leaves to FindAmigaROMMerkleDamage() to list the damaged ranges.
+// Returns NULL if no entry has any leaves in common.
+const AmigaROMInfo* FindClosestAmigaROMInfoFromMerkleLeaves(const AmigaROMMerkleTree *merkle_tree, size_t *matching_leaves);
+
+// Finds the known ROMs most similar to the image merkle_tree was built from,
+// of any size, and writes up to max_results of them to results, most similar
+// first.  Only ROMs which share a MinHash band with the image are compared,
+// so the cost barely grows with the size of the database.  Pass a result's
+// rom_info->merkle->leaves to FindAmigaROMMerkleDamage() to list the ranges
+// which differ.  Returns the number written.
+size_t FindSimilarAmigaROMInfo(const AmigaROMMerkleTree *merkle_tree, AmigaROMSimilarity *results, const size_t max_results);
+
+// Returns the known resident module with the same hash, name and version as
+// module, using a binary search of the database's module index.
+// Returns NULL if the module is unknown.
+const AmigaROMModuleInfo* DetectAmigaROMModuleInfo(const AmigaROMModule *module);
+
+// Finds the resident modules of the ROM, looks each one up and keeps them in
+// modules, replacing any found before.  ParseAmigaROMData does this for
+// every ROM which isn't known, so custom and patched Kickstarts are still
+// described by the known modules they are built from.
+// Returns true if it succeeds, or false if it fails.
+bool DecomposeAmigaROM(ParsedAmigaROMData *amiga_rom);
+
+// Detects the version of the ROM by SHA256 hash
 // Returns NULL for failure, else a string indicating the ROM version
 const char* DetectAmigaROMVersion(const ParsedAmigaROMData *amiga_rom);
 
+// Same as DetectAmigaROMVersion, but for a precomputed 32-byte SHA256 digest
+const char* DetectAmigaROMVersionFromDigest(const uint8_t *digest);
+
 // Detects the major version in the Amiga ROM header
 // Returns 0 if the ROM is not detects as an Amiga ROM
 uint16_t DetectAmigaMajorROMVersion(const ParsedAmigaROMData *amiga_rom);
@@ -132,16 +369,30 @@ uint16_t DetectAmigaMinorROMVersion(const ParsedAmigaROMData *amiga_rom);
 // Returns NULL if the ROM is not detects as an Amiga ROM or the version is unknown
 const char* DetectAmigaMajorMinorROMVersion(const ParsedAmigaROMData *amiga_rom);
 
-// Returns a character indicating the type of ROM detected based on the SHA1 hash
+// Returns a version string for major and minor versions already read from
+// an Amiga ROM header, with one table index and at most a handful of minor
+// version compares.
+// Returns NULL if the version is unknown
+const char* LookupAmigaMajorMinorROMVersion(const uint16_t major_version, const uint16_t minor_version);
+
+// Returns a character indicating the type of ROM detected based on the SHA256 hash
 // Valid return values are:
 // A - Kickstart Hi/U34 ROM
 // B - Kickstart Lo/U35 ROM
 // E - Extended Amiga ROM
 // M - Kickstart merged ROM
-// O - Other (non-Kickstart) ROM
+// O - Other (non-Kickstart) ROM, or an unknown ROM with the signatures of one
 // U - Unknown ROM
 char DetectAmigaROMType(const ParsedAmigaROMData *amiga_rom);
 
+// Same as DetectAmigaROMType, but for a precomputed 32-byte SHA256 digest
+char DetectAmigaROMTypeFromDigest(const uint8_t *digest);
+
+// Classifies an unknown ROM which isn't a Kickstart by the signatures of
+// the non-Kickstart ROM families it contains, in one pass over the ROM.
+// Returns an AMIGA_ROM_FAMILY_* value.
+uint8_t DetectAmigaROMFamily(const ParsedAmigaROMData *amiga_rom);
+
 // Detect whether a ROM is a "Kickety-Split ROM"
 // Returns true if it is, and false if it isn't.
 bool DetectKicketySplitAmigaROM(const ParsedAmigaROMData *amiga_rom);
@@ -182,6 +433,27 @@ bool ValidateAmigaROMChecksum(const ParsedAmigaROMData *amiga_rom);
 // Returns true if it succeeds, or false if it fails.
 bool CorrectAmigaROMChecksum(ParsedAmigaROMData *amiga_rom);
 
+// Repairs the ROM against a known good reference_rom of the same size and
+// byte order: every difference FindAmigaROMDifferences() takes for bit rot
+// is overwritten with the reference's bytes, as is every other difference
+// if repair_patches is true.  The checksum is then corrected if it no
+// longer validates, and the repaired ROM is identified again.  If summary
+// isn't NULL, it is set to the differences found before repairing.
+// Returns true if it succeeds, or false if it fails.
+bool RepairAmigaROM(ParsedAmigaROMData *amiga_rom, const ParsedAmigaROMData *reference_rom, const bool repair_patches, AmigaROMDifferenceSummary *summary);
+
+// Returns the EPROM bank checksums stored for a known merged ROM and sets
+// bank_count to how many there are, or returns NULL if it has none.
+const AmigaROMBankChecksum* GetAmigaROMBankChecksums(const AmigaROMInfo *rom_info, size_t *bank_count);
+
+// Works out which EPROM half, and which bank of it, of a merged ROM differs
+// from expected_rom, in one pass over the ROM.  If expected_rom is NULL, the
+// ROM's own known ROM (or the one it's a layout of) is used, or failing that
+// the known ROM of the same size with the most Merkle leaves in common with
+// it.  Returns true if it succeeds, or false if it fails or there's no known
+// ROM with bank checksums to check against.
+bool VerifyAmigaROMEPROMs(const ParsedAmigaROMData *amiga_rom, const AmigaROMInfo *expected_rom, AmigaROMEPROMVerification *verification);
+
 // Validates whether an Amiga kickstart ROM as a valid footer.
 // Returns true if it does, or false if it doesn't.
 bool ValidateAmigaKickstartROMFooter(const ParsedAmigaROMData *amiga_rom);
@@ -197,19 +469,36 @@ int DetectAmigaROMEncryption(const ParsedAmigaROMData *amiga_rom);
 // Encrypts or decrypts Amiga ROMs according to whether crypt_operation is true or false.
 // If true, it will encrypt the ROMs.  If false, it will decrypt them.
 // The function returns true if the method succeeds, and false if it fails.
-// For safety, make sure that rom_contents has space for 11 more bytes than the original
-// ROM had if an encrypt operation is performed.
+// Both directions work in place, without a second copy of the ROM.  Decrypting
+// also hashes each chunk as it is decrypted, so the ROM's digests are cached
+// without another pass over it.
 bool CryptAmigaROM(ParsedAmigaROMData *amiga_rom, const bool crypt_operation, const char *keyfile_path);
 
 // Run the actual crypt operation, using the ROM data and keyfile data
 bool DoAmigaROMCryptOperation(uint8_t *rom_data_without_crypt_header, const size_t rom_size, const uint8_t *keyfile_data, const size_t keyfile_size);
 
+// Calculates the digests selected by requested_digests (AMIGA_ROM_DIGEST_*
+// bits) of the decrypted contents of an encrypted ROM.  Each chunk is
+// decrypted into a small buffer and hashed straight away, so the ROM is left
+// encrypted and no decrypted copy of it is ever held.
+// Returns true if it succeeds, or false if it fails.
+bool CalculateEncryptedAmigaROMDigests(const ParsedAmigaROMData *amiga_rom, const char *keyfile_path, const uint8_t requested_digests, AmigaROMDigests *digests);
+
+// Identifies an encrypted ROM without decrypting it, using
+// CalculateEncryptedAmigaROMDigests.  Returns NULL if the ROM isn't
+// encrypted, can't be decrypted with the keyfile, or is unknown.
+const AmigaROMInfo* DetectEncryptedAmigaROMInfo(const ParsedAmigaROMData *amiga_rom, const char *keyfile_path);
+
 // 0 indicates the ROM is not byte swapped (the ROM is for emulators)
 // 1 indicates the ROM is byte swapped (the ROM is for physical ICs)
 // -1 indicates the ROM is not an Amiga ROM known to this library,
 //    and the header is not indicative of its byte swappiness.
 int DetectAmigaROMByteSwap(const ParsedAmigaROMData *amiga_rom);
 
+// Same as DetectAmigaROMByteSwap, but for a precomputed 32-byte SHA256 digest
+// of the ROM.  The ROM header is still consulted if the digest is unknown.
+int DetectAmigaROMByteSwapFromDigest(const ParsedAmigaROMData *amiga_rom, const uint8_t *digest);
+
 // Get the unencrypted size of the Amiga ROM in bytes, based on the
 // data passed in.
 size_t DetectUnencryptedAmigaROMSize(const ParsedAmigaROMData *amiga_rom);
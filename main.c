@@ -37,8 +37,33 @@ int print_rom_info(const char* encryption_key_path, const char* rom_input_path);
 int split_rom(const bool swap, const bool unswap, const bool unconditional_swap, const char* encryption_key_path, const bool correct_checksum, const char* rom_high_path, const char* rom_low_path, const char* rom_input_path);
 int merge_rom(const bool swap, const bool unswap, const bool unconditional_swap, const bool encrypt_rom, const char* encryption_key_path, const bool correct_checksum, const char* rom_high_path, const char* rom_low_path, const char* rom_output_path);
 int swap_rom(const bool swap_state, const bool unconditional_swap, const bool encrypt_rom, const char* encryption_key_path, const bool correct_checksum, const char* rom_input_path, const char* rom_output_path);
-int crypt_rom(const bool encryption_state, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path);
-int checksum_rom(const bool correct_checksum, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path);
+int crypt_rom(const bool encryption_state, const uint16_t parse_fields, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path);
+int checksum_rom(const bool correct_checksum, const uint16_t parse_fields, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path);
+int repair_rom(const char* encryption_key_path, const char* rom_input_path, const char* rom_reference_path, const char* rom_output_path);
+int verify_eproms(const char* encryption_key_path, const char* rom_input_path, const char* rom_high_path, const char* rom_low_path);
+static bool parse_profile(const char* profile, uint16_t* parse_fields);
+static void print_source_rom(ParsedAmigaROMData* input_rom);
+static const char* unconfirmed_note(const ParsedAmigaROMData* input_rom);
+
+// Names -t accepts for each AMIGA_ROM_FIELD_* bit of a parse profile
+static const struct {
+	const char *name;
+	uint16_t fields;
+} PROFILE_FIELDS[] = {
+	{"size", AMIGA_ROM_FIELD_SIZE},
+	{"reset", AMIGA_ROM_FIELD_RESET_VECTOR},
+	{"info", AMIGA_ROM_FIELD_INFO},
+	{"swap", AMIGA_ROM_FIELD_BYTE_SWAP},
+	{"checksum", AMIGA_ROM_FIELD_CHECKSUM},
+	{"header", AMIGA_ROM_FIELD_HEADER},
+	{"footer", AMIGA_ROM_FIELD_FOOTER},
+	{"versions", AMIGA_ROM_FIELD_VERSIONS},
+	{"kickety", AMIGA_ROM_FIELD_KICKETY_SPLIT},
+	{"family", AMIGA_ROM_FIELD_FAMILY},
+	{"digests", AMIGA_ROM_FIELD_DIGESTS},
+	{"all", AMIGA_ROM_FIELD_ALL},
+	{"none", AMIGA_ROM_FIELD_NONE}
+};
 
 int main(int argc, char** argv)
 {
@@ -47,6 +72,8 @@ int main(int argc, char** argv)
 	char* rom_high_path = NULL;
 	char* rom_low_path = NULL;
 	char* encryption_key_path = NULL;
+	char* database_path = NULL;
+	char* rom_reference_path = NULL;
 	bool rom_info = false;
 	bool split = false;
 	bool merge = false;
@@ -57,10 +84,13 @@ int main(int argc, char** argv)
 	bool correct_checksum = false;
 	bool encrypt_rom = false;
 	bool decrypt_rom = false;
+	bool verify_rom_eproms = false;
+	bool custom_profile = false;
+	uint16_t parse_fields = AMIGA_ROM_FIELD_NONE;
 	int c;
 	int operation_result = 0;
 
-	while((c = getopt(argc, argv, "i:o:a:b:k:fsgpunvcedh")) != -1)
+	while((c = getopt(argc, argv, "i:o:a:b:k:l:r:t:fsgpunvcedxh")) != -1)
 	{
 		switch(c)
 		{
@@ -79,6 +109,21 @@ int main(int argc, char** argv)
 			case 'k':
 				encryption_key_path = strdup(optarg);
 				break;
+			case 'l':
+				database_path = strdup(optarg);
+				break;
+			case 'r':
+				rom_reference_path = strdup(optarg);
+				break;
+			case 't':
+				if(!parse_profile(optarg, &parse_fields))
+				{
+					print_help();
+					exit(1);
+				}
+
+				custom_profile = true;
+				break;
 			case 'f':
 				rom_info = true;
 				break;
@@ -109,6 +154,9 @@ int main(int argc, char** argv)
 			case 'd':
 				decrypt_rom = true;
 				break;
+			case 'x':
+				verify_rom_eproms = true;
+				break;
 			case 'h':
 			default:
 				print_help();
@@ -122,7 +170,7 @@ int main(int argc, char** argv)
 		unswap = false;
 	}
 
-	if(!rom_info && !split && !merge && !swap && !unswap && !encrypt_rom && !decrypt_rom && !validate_checksum && !correct_checksum)
+	if(!rom_info && !rom_reference_path && !verify_rom_eproms && !split && !merge && !swap && !unswap && !encrypt_rom && !decrypt_rom && !validate_checksum && !correct_checksum)
 	{
 		print_help();
 		exit(1);
@@ -134,6 +182,18 @@ int main(int argc, char** argv)
 		exit(1);
 	}
 
+	if(rom_reference_path && !rom_input_path)
+	{
+		print_help();
+		exit(1);
+	}
+
+	if(verify_rom_eproms && !rom_input_path && (!rom_high_path || !rom_low_path))
+	{
+		print_help();
+		exit(1);
+	}
+
 	if(split && merge)
 	{
 		print_help();
@@ -188,10 +248,23 @@ int main(int argc, char** argv)
 		exit(1);
 	}
 
+	if(database_path && !LoadAmigaROMDatabase(database_path))
+	{
+		fprintf(stderr, "Unable to load ROM database %s, using the built-in database instead.\n", database_path);
+	}
+
 	if(rom_info)
 	{
 		operation_result = print_rom_info(encryption_key_path, rom_input_path);
 	}
+	else if(rom_reference_path)
+	{
+		operation_result = repair_rom(encryption_key_path, rom_input_path, rom_reference_path, rom_output_path);
+	}
+	else if(verify_rom_eproms)
+	{
+		operation_result = verify_eproms(encryption_key_path, rom_input_path, rom_high_path, rom_low_path);
+	}
 	else if(split)
 	{
 		operation_result = split_rom(swap, unswap, unconditional_swap, encryption_key_path, correct_checksum, rom_high_path, rom_low_path, rom_input_path);
@@ -210,19 +283,19 @@ int main(int argc, char** argv)
 	}
 	else if(encrypt_rom)
 	{
-		operation_result = crypt_rom(true, encryption_key_path, rom_input_path, rom_output_path);
+		operation_result = crypt_rom(true, custom_profile ? parse_fields : AMIGA_ROM_FIELD_INFO, encryption_key_path, rom_input_path, rom_output_path);
 	}
 	else if(decrypt_rom)
 	{
-		operation_result = crypt_rom(false, encryption_key_path, rom_input_path, rom_output_path);
+		operation_result = crypt_rom(false, custom_profile ? parse_fields : AMIGA_ROM_FIELD_INFO, encryption_key_path, rom_input_path, rom_output_path);
 	}
 	else if(correct_checksum)
 	{
-		operation_result = checksum_rom(true, encryption_key_path, rom_input_path, rom_output_path);
+		operation_result = checksum_rom(true, custom_profile ? parse_fields : AMIGA_ROM_FIELD_CHECKSUM, encryption_key_path, rom_input_path, rom_output_path);
 	}
 	else if(validate_checksum)
 	{
-		operation_result = checksum_rom(false, encryption_key_path, rom_input_path, NULL);
+		operation_result = checksum_rom(false, custom_profile ? parse_fields : AMIGA_ROM_FIELD_CHECKSUM, encryption_key_path, rom_input_path, NULL);
 	}
 
 	free(rom_high_path);
@@ -230,6 +303,8 @@ int main(int argc, char** argv)
 	free(rom_input_path);
 	free(rom_output_path);
 	free(encryption_key_path);
+	free(database_path);
+	free(rom_reference_path);
 
 	exit(operation_result);
 }
@@ -243,7 +318,9 @@ void print_help(void)
     printf("  -a FILE  Path to High ROM for merging or splitting\n");
     printf("  -b FILE  Path to Low ROM for merging or splitting\n");
     printf("  -k FILE  Path to ROM encryption/decryption key\n");
-    printf("  -f       Print ROM info and quit (requires -i)\n");
+    printf("  -l FILE  Path to a binary ROM database to use instead of the built-in one\n");
+    printf("  -r FILE  Path to a known good ROM to repair bit rot against (requires -i, writes to -o if given)\n");
+    printf("  -f       Print ROM info and CRC32/MD5/SHA-1/SHA-256 digests and quit (requires -i)\n");
     printf("  -s       Split ROM (requires -i, -a, -b)\n");
     printf("  -g       Merge ROM (requires -a, -b, -o)\n");
     printf("  -p       Byte swap ROM for burning to an IC (requires -i, -o)\n");
@@ -253,6 +330,12 @@ void print_help(void)
     printf("  -c       Correct checksum (requires -i, -o)\n");
     printf("  -e       Encrypt ROM (requires -i, -o, -k)\n");
     printf("  -d       Decrypt ROM (requires -i, -o, -k)\n");
+    printf("  -x       Verify which EPROM half and 64KB bank is bad (requires -i, or -a and -b)\n");
+    printf("  -t LIST  Checks to run on the input ROM for -v, -c, -e and -d, separated by commas:\n");
+    printf("           size, reset, info, swap, checksum, header, footer, versions, kickety,\n");
+    printf("           family, digests, all or none (default: checksum for -v and -c, info\n");
+    printf("           for -e and -d).  The ROM is only named if info is run, and digests\n");
+    printf("           are printed if digests is\n");
     printf("  -h       Display this information\n");
     printf("\n");
     printf("Notes:\n");
@@ -261,10 +344,96 @@ void print_help(void)
 	return;
 }
 
+// Parses a comma separated list of PROFILE_FIELDS names into parse_fields.
+// Returns false if a name isn't one of them.
+static bool parse_profile(const char* profile, uint16_t* parse_fields)
+{
+	char *profile_copy = strdup(profile);
+	char *name;
+	size_t i;
+	bool found = true;
+
+	if(!profile_copy)
+	{
+		return false;
+	}
+
+	*parse_fields = AMIGA_ROM_FIELD_NONE;
+	for(name = strtok(profile_copy, ","); name && found; name = strtok(NULL, ","))
+	{
+		found = false;
+		for(i = 0; i < sizeof(PROFILE_FIELDS) / sizeof(PROFILE_FIELDS[0]); i++)
+		{
+			if(strcmp(name, PROFILE_FIELDS[i].name) == 0)
+			{
+				*parse_fields |= PROFILE_FIELDS[i].fields;
+				found = true;
+				break;
+			}
+		}
+	}
+
+	free(profile_copy);
+
+	return found;
+}
+
+// Prints the name of the source ROM if it has been identified, or a warning
+// if it has been found to be unknown.  Prints nothing if the parse profile
+// didn't ask for it to be identified, and prints the digests if it asked for
+// those.  A fingerprint match is confirmed by digest before it is printed.
+static void print_source_rom(ParsedAmigaROMData* input_rom)
+{
+	char hex_digest[65];
+
+	if(input_rom->is_info_unconfirmed)
+	{
+		ConfirmAmigaROMInfo(input_rom);
+	}
+
+	if((input_rom->valid_fields & AMIGA_ROM_FIELD_INFO) || (input_rom->digests.computed_digests & AMIGA_ROM_DIGEST_SHA256))
+	{
+		if(input_rom->rom_info == NULL)
+		{
+			printf("WARNING: Unknown source ROM loaded.\n");
+		}
+		else
+		{
+			printf("Detected source ROM: %s\n", input_rom->rom_info->version);
+		}
+	}
+
+	if(input_rom->valid_fields & AMIGA_ROM_FIELD_DIGESTS)
+	{
+		printf("CRC32:\t\t%08x\n", (unsigned int)input_rom->digests.crc32);
+		FormatAmigaROMDigest(input_rom->digests.md5, sizeof(input_rom->digests.md5), hex_digest);
+		printf("MD5:\t\t%s\n", hex_digest);
+		FormatAmigaROMDigest(input_rom->digests.sha1, sizeof(input_rom->digests.sha1), hex_digest);
+		printf("SHA-1:\t\t%s\n", hex_digest);
+		FormatAmigaROMDigest(input_rom->digests.sha256, sizeof(input_rom->digests.sha256), hex_digest);
+		printf("SHA-256:\t%s\n", hex_digest);
+	}
+}
+
+// Returns a note to follow the name of a ROM identified by its structural
+// fingerprint alone, or an empty string.
+static const char* unconfirmed_note(const ParsedAmigaROMData* input_rom)
+{
+	return input_rom->is_info_unconfirmed ? " (fingerprint match, unconfirmed)" : "";
+}
+
 int print_rom_info(const char* encryption_key_path, const char* rom_input_path)
 {
 	char *info_string = NULL;
 	ParsedAmigaROMData input_rom = GetInitializedAmigaROM();
+	AmigaROMMerkleTree merkle_tree = GetInitializedAmigaROMMerkleTree();
+	AmigaROMDamageRange damage_ranges[16];
+	AmigaROMSimilarity similar_roms[4];
+	const AmigaROMInfo *known_rom = NULL;
+	const AmigaROMInfo *partial_rom = NULL;
+	uint8_t matched_view = AMIGA_ROM_VIEW_NONE;
+	char merkle_root[65];
+	size_t similar_count, damage_count, version_length, i;
 
 	info_string = (char *)malloc(4096);
 	if(!info_string)
@@ -272,11 +441,85 @@ int print_rom_info(const char* encryption_key_path, const char* rom_input_path)
 		return 1;
 	}
 
-	input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+	input_rom = ReadAmigaROMWithDigests(rom_input_path, encryption_key_path, AMIGA_ROM_DIGEST_ALL);
+	ConfirmAmigaROMInfo(&input_rom);
 	PrintAmigaROMInfo(&input_rom, info_string, 4096);
 
 	printf("%s\n", info_string);
 
+	if(input_rom.rom_info && input_rom.rom_info->canonical)
+	{
+		printf("Known layout:\t\t\t%s%s\n", GetAmigaROMViewName(input_rom.rom_info->derived_view & AMIGA_ROM_VIEW_ALL), (input_rom.rom_info->derived_view & AMIGA_ROM_VIEW_MIRRORED) ? ", mirrored" : "");
+		printf("Canonical ROM:\t\t\t%s\n\n", input_rom.rom_info->canonical->version);
+	}
+
+	if(input_rom.parsed_rom && !input_rom.version)
+	{
+		known_rom = DetectAmigaROMInfoFromViews(&input_rom, AMIGA_ROM_VIEW_ALL, &matched_view, &partial_rom);
+		if(known_rom && (matched_view & (AMIGA_ROM_VIEW_AS_IS | AMIGA_ROM_VIEW_BYTE_SWAPPED)))
+		{
+			printf("Matches known ROM as %s:\t%s\n\n", GetAmigaROMViewName(matched_view), known_rom->version);
+		}
+		else if(known_rom)
+		{
+			// Halves listed on their own are named for the ROM, without " Hi"
+			version_length = strlen(known_rom->version);
+			if(known_rom->type == 'A' && strrchr(known_rom->version, ' '))
+			{
+				version_length = (size_t)(strrchr(known_rom->version, ' ') - known_rom->version);
+			}
+
+			printf("Matches known ROM as %s and %s:\t%.*s\n\n", GetAmigaROMViewName(matched_view & (AMIGA_ROM_VIEW_HI | AMIGA_ROM_VIEW_HI_BYTE_SWAPPED)), GetAmigaROMViewName(matched_view & (AMIGA_ROM_VIEW_LO | AMIGA_ROM_VIEW_LO_BYTE_SWAPPED)), (int)version_length, known_rom->version);
+		}
+		else if(partial_rom)
+		{
+			// Only one half is intact, so this is still a damaged dump
+			printf("Partially matches known ROM as %s:\t%s\n\n", GetAmigaROMViewName(matched_view), partial_rom->version);
+		}
+	}
+
+	// Custom and patched Kickstarts are described by their known modules
+	if(input_rom.module_count > 0 && !known_rom)
+	{
+		PrintAmigaROMComposition(&input_rom, info_string, 4096);
+		printf("%s\n", info_string);
+	}
+
+	if(input_rom.parsed_rom && CalculateAmigaROMMerkleTree(input_rom.rom_data, input_rom.rom_size, 0, &merkle_tree))
+	{
+		FormatAmigaROMDigest(merkle_tree.root, 32, merkle_root);
+		printf("Merkle root:\t\t\t%s\n", merkle_root);
+
+		// Without an exact match, the closest ROM's leaves show which
+		// address ranges of the dump are bad
+		if(!input_rom.version && !known_rom)
+		{
+			similar_count = FindSimilarAmigaROMInfo(&merkle_tree, similar_roms, 4);
+			for(i = 0; i < similar_count; i++)
+			{
+				printf("%s\t\t%s (%.0f%% similar, %zu of %zu blocks match)\n", (i == 0) ? "Closest known ROM:" : "Similar known ROM:", similar_roms[i].rom_info->version, similar_roms[i].similarity * 100.0, similar_roms[i].matching_leaves, merkle_tree.leaf_count);
+			}
+
+			known_rom = (similar_count > 0) ? similar_roms[0].rom_info : NULL;
+			if(known_rom)
+			{
+				damage_count = FindAmigaROMMerkleDamage((const uint8_t (*)[32])merkle_tree.leaves, merkle_tree.leaf_count, known_rom->merkle->leaves, known_rom->merkle->leaf_count, input_rom.rom_size, damage_ranges, 16);
+				for(i = 0; i < damage_count && i < 16; i++)
+				{
+					printf("Damaged range:\t\t\t0x%06zX-0x%06zX\n", damage_ranges[i].offset, damage_ranges[i].offset + damage_ranges[i].length - 1);
+				}
+
+				if(damage_count > 16)
+				{
+					printf("...and %zu more damaged ranges\n", damage_count - 16);
+				}
+			}
+		}
+
+		printf("\n");
+		DestroyAmigaROMMerkleTree(&merkle_tree);
+	}
+
 	free(info_string);
 
 	return 0;
@@ -287,8 +530,11 @@ int split_rom(const bool swap, const bool unswap, const bool unconditional_swap,
 	ParsedAmigaROMData high_rom = GetInitializedAmigaROM();
 	ParsedAmigaROMData input_rom = GetInitializedAmigaROM();
 	ParsedAmigaROMData low_rom = GetInitializedAmigaROM();
+	const char* version;
+	char type;
 
-	input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+	// Only the fields printed below are worked out
+	input_rom = ReadAmigaROMLazily(rom_input_path, encryption_key_path);
 	if(!input_rom.parsed_rom)
 	{
 		if(input_rom.is_encrypted && !input_rom.can_decrypt)
@@ -309,22 +555,25 @@ int split_rom(const bool swap, const bool unswap, const bool unconditional_swap,
 		return 1;
 	}
 
-	if(input_rom.version == NULL)
+	version = GetAmigaROMVersion(&input_rom);
+	type = GetAmigaROMType(&input_rom);
+
+	if(version == NULL)
 	{
 		printf("WARNING: Unknown source ROM loaded.\n");
 	}
 	else
 	{
-		printf("Detected source ROM: %s\n", input_rom.version);
+		printf("Detected source ROM: %s%s\n", version, unconfirmed_note(&input_rom));
 	}
 
-	if(input_rom.type != 'M')
+	if(type != 'M')
 	{
-		printf("ROM type: %c\n", input_rom.type);
+		printf("ROM type: %c\n", type);
 		printf("WARNING: ROM is not detected as a known merged ROM.\n");
 	}
 
-	if(input_rom.has_valid_checksum)
+	if(GetAmigaROMHasValidChecksum(&input_rom))
 	{
 		printf("Source ROM checksum is valid.\n");
 	}
@@ -349,7 +598,7 @@ int split_rom(const bool swap, const bool unswap, const bool unconditional_swap,
 		}
 	}
 
-	if((swap || unswap) && ((input_rom.type != 'U' || unconditional_swap) || SetAmigaROMByteSwap(&input_rom, swap, unswap, unconditional_swap) == 0))
+	if((swap || unswap) && ((type != 'U' || unconditional_swap) || SetAmigaROMByteSwap(&input_rom, swap, unswap, unconditional_swap) == 0))
 	{
 		DestroyInitializedAmigaROM(&input_rom);
 		printf("ERROR: Unable to perform conditional swap operation.  Aborting.\n");
@@ -461,7 +710,7 @@ int merge_rom(const bool swap, const bool unswap, const bool unconditional_swap,
 	}
 	else
 	{
-		printf("Detected High ROM: %s\n", high_rom.version);
+		printf("Detected High ROM: %s%s\n", high_rom.version, unconfirmed_note(&high_rom));
 	}
 
 	if(low_rom.version == NULL)
@@ -470,7 +719,7 @@ int merge_rom(const bool swap, const bool unswap, const bool unconditional_swap,
 	}
 	else
 	{
-		printf("Detected Low ROM: %s\n", low_rom.version);
+		printf("Detected Low ROM: %s%s\n", low_rom.version, unconfirmed_note(&low_rom));
 	}
 
 	if(high_rom.version != NULL && low_rom.version == NULL)
@@ -607,10 +856,12 @@ int merge_rom(const bool swap, const bool unswap, const bool unconditional_swap,
 
 int swap_rom(const bool swap_state, const bool unconditional_swap, const bool encrypt_rom, const char* encryption_key_path, const bool correct_checksum, const char* rom_input_path, const char* rom_output_path)
 {
-	size_t encrypted_input_rom_size = 0;
 	ParsedAmigaROMData input_rom = GetInitializedAmigaROM();
+	const char* version;
+	bool has_valid_checksum;
 
-	input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+	// Only the fields printed below are worked out
+	input_rom = ReadAmigaROMLazily(rom_input_path, encryption_key_path);
 	if(!input_rom.parsed_rom)
 	{
 		if(input_rom.is_encrypted && !input_rom.can_decrypt)
@@ -631,13 +882,16 @@ int swap_rom(const bool swap_state, const bool unconditional_swap, const bool en
 		return 1;
 	}
 
-	if(input_rom.version == NULL)
+	version = GetAmigaROMVersion(&input_rom);
+	has_valid_checksum = GetAmigaROMHasValidChecksum(&input_rom);
+
+	if(version == NULL)
 	{
 		printf("WARNING: Unknown source ROM loaded.\n");
 	}
 	else
 	{
-		printf("Detected source ROM: %s\n", input_rom.version);
+		printf("Detected source ROM: %s%s\n", version, unconfirmed_note(&input_rom));
 	}
 
 	if(SetAmigaROMByteSwap(&input_rom, swap_state, !swap_state, unconditional_swap) == 0)
@@ -647,7 +901,7 @@ int swap_rom(const bool swap_state, const bool unconditional_swap, const bool en
 		return 1;
 	}
 
-	if(input_rom.has_valid_checksum)
+	if(has_valid_checksum)
 	{
 		printf("ROM checksum is valid.\n");
 	}
@@ -695,7 +949,6 @@ int swap_rom(const bool swap_state, const bool unconditional_swap, const bool en
 		else
 		{
 			printf("Encrypted ROM.\n");
-			input_rom.rom_size = encrypted_input_rom_size;
 		}
 	}
 
@@ -720,13 +973,12 @@ int swap_rom(const bool swap_state, const bool unconditional_swap, const bool en
 	return 0;
 }
 
-int crypt_rom(const bool encryption_state, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path)
+int crypt_rom(const bool encryption_state, const uint16_t parse_fields, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path)
 {
-	size_t encrypted_input_rom_size = 0;
 
 	ParsedAmigaROMData input_rom = GetInitializedAmigaROM();
 
-	input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+	input_rom = ReadAmigaROMWithProfile(rom_input_path, encryption_key_path, (parse_fields & AMIGA_ROM_FIELD_DIGESTS) ? AMIGA_ROM_DIGEST_ALL : AMIGA_ROM_DIGEST_NONE, parse_fields);
 	if(!input_rom.parsed_rom)
 	{
 		if(input_rom.is_encrypted && !input_rom.can_decrypt)
@@ -747,14 +999,7 @@ int crypt_rom(const bool encryption_state, const char* encryption_key_path, cons
 		return 1;
 	}
 
-	if(input_rom.version == NULL)
-	{
-		printf("WARNING: Unknown source ROM loaded.\n");
-	}
-	else
-	{
-		printf("Detected source ROM: %s\n", input_rom.version);
-	}
+	print_source_rom(&input_rom);
 
 	if(input_rom.is_encrypted && input_rom.successfully_decrypted && !encryption_state)
 	{
@@ -781,7 +1026,6 @@ int crypt_rom(const bool encryption_state, const char* encryption_key_path, cons
 		else
 		{
 			printf("Encrypted ROM.\n");
-			input_rom.rom_size = encrypted_input_rom_size;
 		}
 	}
 
@@ -814,11 +1058,11 @@ int crypt_rom(const bool encryption_state, const char* encryption_key_path, cons
 	return 0;
 }
 
-int checksum_rom(const bool correct_checksum, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path)
+int checksum_rom(const bool correct_checksum, const uint16_t parse_fields, const char* encryption_key_path, const char* rom_input_path, const char* rom_output_path)
 {
 	ParsedAmigaROMData input_rom;
 
-	input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+	input_rom = ReadAmigaROMWithProfile(rom_input_path, encryption_key_path, (parse_fields & AMIGA_ROM_FIELD_DIGESTS) ? AMIGA_ROM_DIGEST_ALL : AMIGA_ROM_DIGEST_NONE, parse_fields);
 	if(!input_rom.parsed_rom)
 	{
 		if(input_rom.is_encrypted && !input_rom.can_decrypt)
@@ -839,16 +1083,9 @@ int checksum_rom(const bool correct_checksum, const char* encryption_key_path, c
 		return 1;
 	}
 
-	if(input_rom.version == NULL)
-	{
-		printf("WARNING: Unknown source ROM loaded.\n");
-	}
-	else
-	{
-		printf("Detected source ROM: %s\n", input_rom.version);
-	}
+	print_source_rom(&input_rom);
 
-	if(input_rom.has_valid_checksum)
+	if(GetAmigaROMHasValidChecksum(&input_rom))
 	{
 		printf("ROM checksum is valid.\n");
 	}
@@ -888,3 +1125,199 @@ int checksum_rom(const bool correct_checksum, const char* encryption_key_path, c
 
 	return 0;
 }
+
+int repair_rom(const char* encryption_key_path, const char* rom_input_path, const char* rom_reference_path, const char* rom_output_path)
+{
+	ParsedAmigaROMData input_rom;
+	ParsedAmigaROMData reference_rom;
+	AmigaROMMerkleTree merkle_tree = GetInitializedAmigaROMMerkleTree();
+	AmigaROMSimilarity similar_roms[8];
+	AmigaROMDifference differences[16];
+	AmigaROMDifferenceSummary summary;
+	size_t similar_count, difference_count, i;
+
+	input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+	if(!input_rom.parsed_rom)
+	{
+		printf("ERROR: Unable to load source ROM at: %s\n", rom_input_path);
+		DestroyInitializedAmigaROM(&input_rom);
+		return 1;
+	}
+
+	reference_rom = ReadAmigaROM(rom_reference_path, encryption_key_path);
+	if(!reference_rom.parsed_rom)
+	{
+		printf("ERROR: Unable to load reference ROM at: %s\n", rom_reference_path);
+		DestroyInitializedAmigaROM(&input_rom);
+		DestroyInitializedAmigaROM(&reference_rom);
+		return 1;
+	}
+
+	// The repair trusts both identities, so fingerprint matches aren't enough
+	ConfirmAmigaROMInfo(&input_rom);
+	ConfirmAmigaROMInfo(&reference_rom);
+
+	if(input_rom.version)
+	{
+		printf("Detected source ROM: %s\n", input_rom.version);
+	}
+	else if(CalculateAmigaROMMerkleTree(input_rom.rom_data, input_rom.rom_size, 0, &merkle_tree))
+	{
+		// The known ROM of the same size the dump is most like is the one
+		// the reference should be
+		similar_count = FindSimilarAmigaROMInfo(&merkle_tree, similar_roms, 8);
+		i = 0;
+		while(i < similar_count && similar_roms[i].rom_info->file_size != input_rom.rom_size)
+		{
+			i++;
+		}
+
+		if(i < similar_count)
+		{
+			printf("Closest known ROM: %s (%zu of %zu blocks match)\n", similar_roms[i].rom_info->version, similar_roms[i].matching_leaves, merkle_tree.leaf_count);
+		}
+
+		DestroyAmigaROMMerkleTree(&merkle_tree);
+	}
+
+	if(reference_rom.version)
+	{
+		printf("Reference ROM: %s\n", reference_rom.version);
+	}
+	else
+	{
+		printf("WARNING: Unknown reference ROM loaded.\n");
+	}
+
+	if(input_rom.rom_size != reference_rom.rom_size || input_rom.is_byte_swapped != reference_rom.is_byte_swapped)
+	{
+		printf("ERROR: The source and reference ROMs must be the same size and byte order.\n");
+		DestroyInitializedAmigaROM(&input_rom);
+		DestroyInitializedAmigaROM(&reference_rom);
+		return 1;
+	}
+
+	difference_count = FindAmigaROMDifferences(input_rom.rom_data, reference_rom.rom_data, input_rom.rom_size, differences, 16, &summary);
+	printf("Differences: %zu (%zu bit flips, %zu patches, %zu bytes, %zu bits)\n", difference_count, summary.bit_flip_count, summary.patch_count, summary.differing_bytes, summary.flipped_bits);
+
+	for(i = 0; i < difference_count && i < 16; i++)
+	{
+		printf("  0x%06zX-0x%06zX  %-9s %u bit%s\n", differences[i].offset, differences[i].offset + differences[i].length - 1, differences[i].is_bit_flip ? "bit flip" : "patch", (unsigned int)differences[i].flipped_bits, (differences[i].flipped_bits == 1) ? "" : "s");
+	}
+
+	if(difference_count > 16)
+	{
+		printf("  ...and %zu more differences\n", difference_count - 16);
+	}
+
+	if(rom_output_path)
+	{
+		if(!RepairAmigaROM(&input_rom, &reference_rom, false, NULL))
+		{
+			printf("ERROR: Unable to repair ROM.\n");
+			DestroyInitializedAmigaROM(&input_rom);
+			DestroyInitializedAmigaROM(&reference_rom);
+			return 1;
+		}
+
+		printf("Repaired %zu bit flips, kept %zu patches.  ROM checksum is %s.\n", summary.bit_flip_count, summary.patch_count, input_rom.has_valid_checksum ? "valid" : "invalid");
+
+		if(!WriteAmigaROM(&input_rom, rom_output_path))
+		{
+			printf("ERROR: Unable to write repaired ROM to disk.\n");
+			DestroyInitializedAmigaROM(&input_rom);
+			DestroyInitializedAmigaROM(&reference_rom);
+			return 1;
+		}
+
+		printf("Successfully wrote repaired ROM%s%s.\n", input_rom.version ? ": " : "", input_rom.version ? input_rom.version : "");
+	}
+
+	DestroyInitializedAmigaROM(&input_rom);
+	DestroyInitializedAmigaROM(&reference_rom);
+
+	return 0;
+}
+
+// Prints OK, or the byte range within the EPROM half of every bad bank.
+// The last bank ends with the half, which may be short of a whole bank.
+static void print_eprom_banks(const char* eprom_name, const uint32_t bad_banks, const size_t bank_count, const size_t half_size)
+{
+	size_t bank_end, i;
+
+	if(bad_banks == 0)
+	{
+		printf("%s\tOK\n", eprom_name);
+		return;
+	}
+
+	printf("%s\tBAD, banks:", eprom_name);
+	for(i = 0; i < bank_count; i++)
+	{
+		if(bad_banks & ((uint32_t)1 << i))
+		{
+			bank_end = (i + 1) * AMIGA_ROM_EPROM_BANK_SIZE;
+			if(bank_end > half_size)
+			{
+				bank_end = half_size;
+			}
+
+			printf(" %zu (0x%05zX-0x%05zX)", i, i * AMIGA_ROM_EPROM_BANK_SIZE, bank_end - 1);
+		}
+	}
+	printf("\n");
+}
+
+int verify_eproms(const char* encryption_key_path, const char* rom_input_path, const char* rom_high_path, const char* rom_low_path)
+{
+	ParsedAmigaROMData input_rom = GetInitializedAmigaROM();
+	ParsedAmigaROMData high_rom = GetInitializedAmigaROM();
+	ParsedAmigaROMData low_rom = GetInitializedAmigaROM();
+	AmigaROMEPROMVerification verification;
+
+	if(rom_input_path)
+	{
+		input_rom = ReadAmigaROM(rom_input_path, encryption_key_path);
+		if(!input_rom.parsed_rom)
+		{
+			printf("ERROR: Unable to load source ROM at: %s\n", rom_input_path);
+			DestroyInitializedAmigaROM(&input_rom);
+			return 1;
+		}
+	}
+	else
+	{
+		high_rom = ReadAmigaROM(rom_high_path, encryption_key_path);
+		low_rom = ReadAmigaROM(rom_low_path, encryption_key_path);
+		if(!high_rom.parsed_rom || !low_rom.parsed_rom || !MergeAmigaROM(&high_rom, &low_rom, &input_rom))
+		{
+			printf("ERROR: Unable to load and merge High ROM at: %s and Low ROM at: %s\n", rom_high_path, rom_low_path);
+			DestroyInitializedAmigaROM(&high_rom);
+			DestroyInitializedAmigaROM(&low_rom);
+			DestroyInitializedAmigaROM(&input_rom);
+			return 1;
+		}
+
+		DestroyInitializedAmigaROM(&high_rom);
+		DestroyInitializedAmigaROM(&low_rom);
+	}
+
+	// A damaged dump must be checked against the closest ROM, not the one
+	// its fingerprint matched
+	ConfirmAmigaROMInfo(&input_rom);
+
+	if(!VerifyAmigaROMEPROMs(&input_rom, NULL, &verification))
+	{
+		printf("ERROR: No known ROM with EPROM bank checksums to verify against.\n");
+		DestroyInitializedAmigaROM(&input_rom);
+		return 1;
+	}
+
+	printf("Expected ROM:\t%s\n", verification.rom_info->version);
+	print_eprom_banks("Hi (U34):", verification.bad_hi_banks, verification.bank_count, input_rom.rom_size / 2);
+	print_eprom_banks("Lo (U35):", verification.bad_lo_banks, verification.bank_count, input_rom.rom_size / 2);
+
+	DestroyInitializedAmigaROM(&input_rom);
+
+	return (verification.bad_hi_banks == 0 && verification.bad_lo_banks == 0) ? 0 : 1;
+}
@@ -1,11 +1,13 @@
 /*******************************************************************************
- * Teeny SHA-1
+ * Teeny SHA-256
  *
- * The below SHA256() calculates a SHA-1 hash value for a
+ * The below SHA256() calculates a SHA-256 hash value for a
  * specified data buffer and generates a hex representation of the
  * result.  Modifications from the upstream source are to contain the file to a
- * single C source file, generate an ASCII hex digest, and compile under strict
- * C17 standards.
+ * single C source file, generate an ASCII hex digest, compile under strict
+ * C17 standards, and expose an incremental init/update/final context API
+ * which compresses blocks directly from the caller's buffer instead of
+ * copying and padding the whole message up front.
  * 
  * Original source repo: https://github.com/CurryB0i/SHA-256-in-C
  *
@@ -14,223 +16,826 @@
  * License: MIT, see included LICENSE file for details.
  *
  * To use the SHA256() function either copy it into an existing
- * project source code file or include this file in a project and put
- * the declaration (example below) in the sources files where needed.
+ * project source code file or include this file in a project along with
+ * teeny-sha256.h, which declares SHA256() and the SHA256Context functions.
  ******************************************************************************/
 
-#include <stdbool.h>
+#include "teeny-sha256.h"
+
 #include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-/* Declaration:
-extern int SHA256(const uint8_t* msg, size_t msgLen, uint8_t* digest, char* hexDigest);
-*/
+static const uint32_t H0[8] = {
+  0x6a09e667,
+  0xbb67ae85,
+  0x3c6ef372,
+  0xa54ff53a,
+  0x510e527f,
+  0x9b05688c,
+  0x1f83d9ab,
+  0x5be0cd19
+};
+
+static const uint32_t K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+  0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+  0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+  0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+  0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+  0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t rightRotate(const uint32_t word, const unsigned int offset) {
+  return (word >> offset) | (word << (32 - offset));
+}
+
+static inline uint32_t loadBigEndian32(const uint8_t* bytes) {
+  return ((uint32_t)bytes[0] << 24) |
+      ((uint32_t)bytes[1] << 16) |
+      ((uint32_t)bytes[2] << 8) |
+      ((uint32_t)bytes[3]);
+}
 
 /**
- * Computes the SHA-256 hash of the given input message.
- *
- * @param msg        Pointer to the input message (raw bytes).
- * @param msgLen     Length of the input message in bytes.
- * @param digest     Pointer to a buffer of at least 32 bytes.
- *                   The resulting 32-byte hash will be written here.
- * @param hexDigest  Pointer to a buffer to store an ASCII hex string
- *                   representation of the SHA256 digest on function return.
- *                   Must be at least 65 bytes (including space for the
- *                   null terminator).
- *
- * @return           0 on success, non-zero on failure.
+ * Signature shared by every compression kernel: runs the SHA-256 compression
+ * function over noOfBlocks consecutive 64-byte blocks starting at blocks,
+ * updating the eight state words in H.
+ */
+typedef void (*HashBlocksFunc)(uint32_t* H, const uint8_t* blocks, size_t noOfBlocks);
+
+#define SHA256_ROUND(a, b, c, d, e, f, g, h, j) \
+  temp1 = h + (rightRotate(e, 6) ^ rightRotate(e, 11) ^ rightRotate(e, 25)) + \
+      (g ^ (e & (f ^ g))) + K[j] + W[j]; \
+  temp2 = (rightRotate(a, 2) ^ rightRotate(a, 13) ^ rightRotate(a, 22)) + \
+      ((a & b) | (c & (a | b))); \
+  d += temp1; \
+  h = temp1 + temp2;
+
+static void hashPortable(uint32_t* H, const uint8_t* blocks, size_t noOfBlocks) {
+  uint32_t W[64];
+  uint32_t a, b, c, d, e, f, g, h, temp1, temp2;
+
+  for(size_t i = 0; i < noOfBlocks; i++, blocks += 64) {
+    for(size_t j=0; j<16; j++) {
+      W[j] = loadBigEndian32(blocks + j * 4);
+    }
+
+    for(size_t j=16; j<64; j++) {
+      uint32_t s0 = rightRotate(W[j-15],7) ^ rightRotate(W[j-15],18) ^ (W[j-15] >> 3);
+      uint32_t s1 = rightRotate(W[j-2],17) ^ rightRotate(W[j-2],19) ^ (W[j-2] >> 10);
+      W[j] = W[j-16] + s0 + W[j-7] + s1;
+    }
+
+    a = H[0];
+    b = H[1];
+    c = H[2];
+    d = H[3];
+    e = H[4];
+    f = H[5];
+    g = H[6];
+    h = H[7];
+
+    // Eight rounds per iteration, rotating the variable roles instead of
+    // shuffling eight registers after every round.
+    for(size_t j=0; j<64; j+=8) {
+      SHA256_ROUND(a, b, c, d, e, f, g, h, j);
+      SHA256_ROUND(h, a, b, c, d, e, f, g, j + 1);
+      SHA256_ROUND(g, h, a, b, c, d, e, f, j + 2);
+      SHA256_ROUND(f, g, h, a, b, c, d, e, j + 3);
+      SHA256_ROUND(e, f, g, h, a, b, c, d, j + 4);
+      SHA256_ROUND(d, e, f, g, h, a, b, c, j + 5);
+      SHA256_ROUND(c, d, e, f, g, h, a, b, j + 6);
+      SHA256_ROUND(b, c, d, e, f, g, h, a, j + 7);
+    }
+
+    H[0] += a;
+    H[1] += b;
+    H[2] += c;
+    H[3] += d;
+    H[4] += e;
+    H[5] += f;
+    H[6] += g;
+    H[7] += h;
+  }
+}
+
+#undef SHA256_ROUND
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+
+#define TEENY_SHA256_X86 1
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/**
+ * Intel SHA extensions kernel.  The hardware keeps the state as ABEF/CDGH
+ * word pairs, so H is shuffled into that layout on entry and back on exit.
  */
-int SHA256(const uint8_t* msg, size_t msgLen, uint8_t* digest, char* hexDigest);
+__attribute__((target("sha,sse4.1")))
+static void hashShaNi(uint32_t* H, const uint8_t* blocks, size_t noOfBlocks) {
+  const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+  __m128i state0, state1, msg, temp, abefSave, cdghSave;
+  __m128i M[4];
+
+  temp = _mm_loadu_si128((const __m128i*)&H[0]);
+  state1 = _mm_loadu_si128((const __m128i*)&H[4]);
+  temp = _mm_shuffle_epi32(temp, 0xB1);
+  state1 = _mm_shuffle_epi32(state1, 0x1B);
+  state0 = _mm_alignr_epi8(temp, state1, 8);
+  state1 = _mm_blend_epi16(state1, temp, 0xF0);
+
+  for(size_t i = 0; i < noOfBlocks; i++, blocks += 64) {
+    abefSave = state0;
+    cdghSave = state1;
+
+    for(size_t j = 0; j < 4; j++) {
+      M[j] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(blocks + 16 * j)), byteSwapMask);
+    }
+
+    for(size_t j = 0; j < 16; j++) {
+      msg = _mm_add_epi32(M[j & 3], _mm_loadu_si128((const __m128i*)&K[4 * j]));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+      msg = _mm_shuffle_epi32(msg, 0x0E);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
 
-void padMsg(uint8_t* paddedBinaryMsg,const uint8_t* binary,int len,int padLen) {
-  memcpy(paddedBinaryMsg,binary,len*sizeof(uint8_t));
-  paddedBinaryMsg[len++] = 0x80;
-  while(padLen > 0) {
-    paddedBinaryMsg[len++] = 0;
-    padLen--;
+      if(j < 12) {
+        temp = _mm_add_epi32(_mm_sha256msg1_epu32(M[j & 3], M[(j + 1) & 3]), _mm_alignr_epi8(M[(j + 3) & 3], M[(j + 2) & 3], 4));
+        M[j & 3] = _mm_sha256msg2_epu32(temp, M[(j + 3) & 3]);
+      }
+    }
+
+    state0 = _mm_add_epi32(state0, abefSave);
+    state1 = _mm_add_epi32(state1, cdghSave);
   }
+
+  temp = _mm_shuffle_epi32(state0, 0x1B);
+  state1 = _mm_shuffle_epi32(state1, 0xB1);
+  state0 = _mm_blend_epi16(temp, state1, 0xF0);
+  state1 = _mm_alignr_epi8(state1, temp, 8);
+
+  _mm_storeu_si128((__m128i*)&H[0], state0);
+  _mm_storeu_si128((__m128i*)&H[4], state1);
 }
 
-void intToBin(uint8_t* paddedBinaryMsg, int offset, uint64_t len) {
-  for (size_t i = 0; i < 8; i++) {
-    paddedBinaryMsg[offset + i] = (len >> (56 - 8 * i)) & 0xFF;
+static int cpuHasShaNi(void) {
+  unsigned int eax, ebx, ecx, edx;
+
+  if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+
+  // SSSE3 (pshufb) and SSE4.1 (pblendw) are used alongside the SHA opcodes.
+  if(!(ecx & (1u << 9)) || !(ecx & (1u << 19))) {
+    return 0;
   }
+
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    return 0;
+  }
+
+  return (ebx & (1u << 29)) != 0;
 }
 
-int getBlocks(uint8_t** blocks, int noOfBlocks, uint8_t* binMsg) {
-  for(int i = 0;i < noOfBlocks; i++) {
-    blocks[i] = malloc(64 * sizeof(uint8_t));
-    if(blocks[i] == NULL) {
-      fprintf(stderr, "Memory allocation failed\n");
-      free(binMsg);
-      return 1;
+static int cpuHasOsXsaveState(uint64_t mask) {
+  unsigned int eax, ebx, ecx, edx, xcr0Low, xcr0High;
+
+  if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & (1u << 27))) {
+    return 0;
+  }
+
+  __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+
+  return ((((uint64_t)xcr0High << 32) | xcr0Low) & mask) == mask;
+}
+
+static int cpuHasAvx2(void) {
+  unsigned int eax, ebx, ecx, edx;
+
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(ebx & (1u << 5))) {
+    return 0;
+  }
+
+  // XMM and YMM state must be enabled by the OS.
+  return cpuHasOsXsaveState(0x06);
+}
+
+static int cpuHasAvx512(void) {
+  unsigned int eax, ebx, ecx, edx;
+
+  if(!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(ebx & (1u << 16))) {
+    return 0;
+  }
+
+  // XMM, YMM, opmask and both halves of the ZMM state must be enabled.
+  return cpuHasOsXsaveState(0xE6);
+}
+
+/**
+ * Loads one 64-byte block from each of eight lanes and transposes it so that
+ * W[t] holds message word t of every lane, already converted to big-endian.
+ */
+__attribute__((target("avx2")))
+static inline void loadTransposed8(__m256i* W, const uint8_t* const* lanes) {
+  const __m256i byteSwapMask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  __m256i r[8], t[8], u[8];
+
+  for(size_t half = 0; half < 2; half++) {
+    for(size_t i = 0; i < 8; i++) {
+      r[i] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(lanes[i] + 32 * half)), byteSwapMask);
+    }
+
+    for(size_t i = 0; i < 8; i += 2) {
+      t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+      t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+
+    for(size_t i = 0; i < 8; i += 4) {
+      u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+      u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+      u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+      u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+
+    for(size_t i = 0; i < 4; i++) {
+      W[8 * half + i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+      W[8 * half + i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+    }
+  }
+}
+
+#define MB_ROUND(a, b, c, d, e, f, g, h, j) \
+  if((j) >= 16) { \
+    W[(j) & 15] = ADD(ADD(W[(j) & 15], SSIG0(W[((j) + 1) & 15])), ADD(W[((j) + 9) & 15], SSIG1(W[((j) + 14) & 15]))); \
+  } \
+  temp1 = ADD(ADD(ADD(h, BSIG1(e)), ADD(CH(e, f, g), SET1(K[j]))), W[(j) & 15]); \
+  temp2 = ADD(BSIG0(a), MAJ(a, b, c)); \
+  d = ADD(d, temp1); \
+  h = ADD(temp1, temp2);
+
+#define MB_ROUNDS(j) \
+  MB_ROUND(a, b, c, d, e, f, g, h, j); \
+  MB_ROUND(h, a, b, c, d, e, f, g, j + 1); \
+  MB_ROUND(g, h, a, b, c, d, e, f, j + 2); \
+  MB_ROUND(f, g, h, a, b, c, d, e, j + 3); \
+  MB_ROUND(e, f, g, h, a, b, c, d, j + 4); \
+  MB_ROUND(d, e, f, g, h, a, b, c, j + 5); \
+  MB_ROUND(c, d, e, f, g, h, a, b, j + 6); \
+  MB_ROUND(b, c, d, e, f, g, h, a, j + 7);
+
+#define ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+#define ADD(x, y) _mm256_add_epi32(x, y)
+#define XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256(x, y), z)
+#define BSIG0(x) XOR3(ROTR(x, 2), ROTR(x, 13), ROTR(x, 22))
+#define BSIG1(x) XOR3(ROTR(x, 6), ROTR(x, 11), ROTR(x, 25))
+#define SSIG0(x) XOR3(ROTR(x, 7), ROTR(x, 18), _mm256_srli_epi32(x, 3))
+#define SSIG1(x) XOR3(ROTR(x, 17), ROTR(x, 19), _mm256_srli_epi32(x, 10))
+#define CH(x, y, z) _mm256_xor_si256(z, _mm256_and_si256(x, _mm256_xor_si256(y, z)))
+#define MAJ(x, y, z) _mm256_or_si256(_mm256_and_si256(x, y), _mm256_and_si256(z, _mm256_or_si256(x, y)))
+#define SET1(k) _mm256_set1_epi32((int)(k))
+
+/**
+ * AVX2 multi-buffer kernel: compresses noOfBlocks blocks from each of eight
+ * independent messages at once, one message per 32-bit lane.  H holds the
+ * eight state words of each lane, and every lane pointer is advanced past the
+ * blocks consumed.
+ */
+__attribute__((target("avx2")))
+static void hashAvx2x8(uint32_t (*H)[8], const uint8_t** lanes, size_t noOfBlocks) {
+  __m256i W[16], S[8];
+  __m256i a, b, c, d, e, f, g, h, temp1, temp2;
+  uint32_t out[8];
+
+  for(size_t k = 0; k < 8; k++) {
+    S[k] = _mm256_setr_epi32((int)H[0][k], (int)H[1][k], (int)H[2][k], (int)H[3][k],
+        (int)H[4][k], (int)H[5][k], (int)H[6][k], (int)H[7][k]);
+  }
+
+  for(size_t i = 0; i < noOfBlocks; i++) {
+    loadTransposed8(W, lanes);
+    for(size_t l = 0; l < 8; l++) {
+      lanes[l] += 64;
+    }
+
+    a = S[0];
+    b = S[1];
+    c = S[2];
+    d = S[3];
+    e = S[4];
+    f = S[5];
+    g = S[6];
+    h = S[7];
+
+    for(size_t j = 0; j < 64; j += 8) {
+      MB_ROUNDS(j);
     }
 
-    memcpy(blocks[i],binMsg + 64*i, 64*sizeof(uint8_t));
+    S[0] = ADD(S[0], a);
+    S[1] = ADD(S[1], b);
+    S[2] = ADD(S[2], c);
+    S[3] = ADD(S[3], d);
+    S[4] = ADD(S[4], e);
+    S[5] = ADD(S[5], f);
+    S[6] = ADD(S[6], g);
+    S[7] = ADD(S[7], h);
+  }
+
+  for(size_t k = 0; k < 8; k++) {
+    _mm256_storeu_si256((__m256i*)out, S[k]);
+    for(size_t l = 0; l < 8; l++) {
+      H[l][k] = out[l];
+    }
   }
+}
+
+#undef ROTR
+#undef ADD
+#undef XOR3
+#undef BSIG0
+#undef BSIG1
+#undef SSIG0
+#undef SSIG1
+#undef CH
+#undef MAJ
+#undef SET1
+
+#define ROTR(x, n) _mm512_ror_epi32(x, n)
+#define ADD(x, y) _mm512_add_epi32(x, y)
+#define XOR3(x, y, z) _mm512_ternarylogic_epi32(x, y, z, 0x96)
+#define BSIG0(x) XOR3(ROTR(x, 2), ROTR(x, 13), ROTR(x, 22))
+#define BSIG1(x) XOR3(ROTR(x, 6), ROTR(x, 11), ROTR(x, 25))
+#define SSIG0(x) XOR3(ROTR(x, 7), ROTR(x, 18), _mm512_srli_epi32(x, 3))
+#define SSIG1(x) XOR3(ROTR(x, 17), ROTR(x, 19), _mm512_srli_epi32(x, 10))
+#define CH(x, y, z) _mm512_ternarylogic_epi32(x, y, z, 0xCA)
+#define MAJ(x, y, z) _mm512_ternarylogic_epi32(x, y, z, 0xE8)
+#define SET1(k) _mm512_set1_epi32((int)(k))
+
+/**
+ * AVX-512 multi-buffer kernel: the sixteen-lane counterpart of hashAvx2x8(),
+ * using native rotates and ternary logic for the round functions.
+ */
+__attribute__((target("avx2,avx512f")))
+static void hashAvx512x16(uint32_t (*H)[8], const uint8_t** lanes, size_t noOfBlocks) {
+  __m512i W[16], S[8];
+  __m512i a, b, c, d, e, f, g, h, temp1, temp2;
+  __m256i W0[16], W1[16];
+  uint32_t out[16];
+
+  for(size_t k = 0; k < 8; k++) {
+    S[k] = _mm512_setr_epi32((int)H[0][k], (int)H[1][k], (int)H[2][k], (int)H[3][k],
+        (int)H[4][k], (int)H[5][k], (int)H[6][k], (int)H[7][k],
+        (int)H[8][k], (int)H[9][k], (int)H[10][k], (int)H[11][k],
+        (int)H[12][k], (int)H[13][k], (int)H[14][k], (int)H[15][k]);
+  }
+
+  for(size_t i = 0; i < noOfBlocks; i++) {
+    loadTransposed8(W0, lanes);
+    loadTransposed8(W1, lanes + 8);
+    for(size_t t = 0; t < 16; t++) {
+      W[t] = _mm512_inserti64x4(_mm512_castsi256_si512(W0[t]), W1[t], 1);
+    }
+    for(size_t l = 0; l < 16; l++) {
+      lanes[l] += 64;
+    }
+
+    a = S[0];
+    b = S[1];
+    c = S[2];
+    d = S[3];
+    e = S[4];
+    f = S[5];
+    g = S[6];
+    h = S[7];
+
+    for(size_t j = 0; j < 64; j += 8) {
+      MB_ROUNDS(j);
+    }
+
+    S[0] = ADD(S[0], a);
+    S[1] = ADD(S[1], b);
+    S[2] = ADD(S[2], c);
+    S[3] = ADD(S[3], d);
+    S[4] = ADD(S[4], e);
+    S[5] = ADD(S[5], f);
+    S[6] = ADD(S[6], g);
+    S[7] = ADD(S[7], h);
+  }
+
+  for(size_t k = 0; k < 8; k++) {
+    _mm512_storeu_si512((void*)out, S[k]);
+    for(size_t l = 0; l < 16; l++) {
+      H[l][k] = out[l];
+    }
+  }
+}
+
+#undef ROTR
+#undef ADD
+#undef XOR3
+#undef BSIG0
+#undef BSIG1
+#undef SSIG0
+#undef SSIG1
+#undef CH
+#undef MAJ
+#undef SET1
+#undef MB_ROUNDS
+#undef MB_ROUND
+
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+
+#define TEENY_SHA256_ARM 1
+
+#include <arm_neon.h>
+
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_SHA2
+#define HWCAP_SHA2 (1 << 6)
+#endif
+#endif
+
+#if defined(__ARM_FEATURE_SHA2)
+#define TEENY_SHA256_ARM_TARGET
+#elif defined(__clang__)
+#define TEENY_SHA256_ARM_TARGET __attribute__((target("crypto")))
+#else
+#define TEENY_SHA256_ARM_TARGET __attribute__((target("+crypto")))
+#endif
+
+/**
+ * ARMv8 cryptography extensions kernel.  SHA256H/SHA256H2 take the state as
+ * ABCD/EFGH, so H loads directly.
+ */
+TEENY_SHA256_ARM_TARGET
+static void hashArmV8(uint32_t* H, const uint8_t* blocks, size_t noOfBlocks) {
+  uint32x4_t state0 = vld1q_u32(&H[0]);
+  uint32x4_t state1 = vld1q_u32(&H[4]);
+  uint32x4_t abcdSave, efghSave, wk, temp;
+  uint32x4_t M[4];
+
+  for(size_t i = 0; i < noOfBlocks; i++, blocks += 64) {
+    abcdSave = state0;
+    efghSave = state1;
+
+    for(size_t j = 0; j < 4; j++) {
+      M[j] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(blocks + 16 * j)));
+    }
+
+    for(size_t j = 0; j < 16; j++) {
+      wk = vaddq_u32(M[j & 3], vld1q_u32(&K[4 * j]));
+
+      if(j < 12) {
+        M[j & 3] = vsha256su1q_u32(vsha256su0q_u32(M[j & 3], M[(j + 1) & 3]), M[(j + 2) & 3], M[(j + 3) & 3]);
+      }
+
+      temp = state0;
+      state0 = vsha256hq_u32(state0, state1, wk);
+      state1 = vsha256h2q_u32(state1, temp, wk);
+    }
+
+    state0 = vaddq_u32(state0, abcdSave);
+    state1 = vaddq_u32(state1, efghSave);
+  }
+
+  vst1q_u32(&H[0], state0);
+  vst1q_u32(&H[4], state1);
+}
+
+static int cpuHasArmV8Sha2(void) {
+#if defined(__ARM_FEATURE_SHA2) || (defined(__APPLE__) && defined(__MACH__))
+  return 1;
+#elif defined(__linux__)
+  return (getauxval(AT_HWCAP) & HWCAP_SHA2) != 0;
+#else
   return 0;
+#endif
 }
 
-uint32_t rightRotate(const uint32_t word,int offset) {
-  uint32_t temp = word;
-  offset = offset % 32;
-  return (temp >> offset) | (temp << (32 - offset));
-}
-
-void hash (uint8_t** blocks,int noOfBlocks,uint8_t* hashedMsg) {
-
-  uint32_t H[] = {
-    0x6a09e667,
-    0xbb67ae85,
-    0x3c6ef372,
-    0xa54ff53a,
-    0x510e527f,
-    0x9b05688c,
-    0x1f83d9ab,
-    0x5be0cd19
-  };
-
-  static uint32_t K[64] = {
-    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-  };
-
-  for(int i = 0;i < noOfBlocks; i++) {
-    uint32_t W[64];
+#endif
 
-    for(size_t j=0; j<16; j++) {
-      W[j] = (((uint32_t)blocks[i][j * 4] << 24) |
-          ((uint32_t)blocks[i][j * 4 + 1] << 16) |
-          ((uint32_t)blocks[i][j * 4 + 2] << 8) |
-          ((uint32_t)blocks[i][j * 4 + 3]));
+/**
+ * Signature shared by the multi-buffer kernels: compresses noOfBlocks blocks
+ * from every lane in lockstep.  H[lane] holds each lane's state and each
+ * lanes[lane] pointer is advanced past the blocks consumed.
+ */
+typedef void (*HashLanesFunc)(uint32_t (*H)[8], const uint8_t** lanes, size_t noOfBlocks);
+
+#define SHA256_MAX_LANES 16
+
+static HashBlocksFunc hashBlocks = hashPortable;
+static const char* hashBlocksName = "portable";
+static HashLanesFunc hashLanes = NULL;
+static size_t hashLaneCount = 1;
+
+// Pick the fastest kernel the running CPU supports.  Runs before main() when
+// the compiler supports constructors, so the pointer is never written while
+// other threads may be hashing; otherwise the portable kernel stays in place.
+#if defined(TEENY_SHA256_X86) || defined(TEENY_SHA256_ARM)
+__attribute__((constructor))
+static void selectHashKernel(void) {
+#if defined(TEENY_SHA256_X86)
+  if(cpuHasShaNi()) {
+    hashBlocks = hashShaNi;
+    hashBlocksName = "x86 SHA-NI";
+  }
+
+  // Eight AVX2 lanes only just keep pace with a single SHA-NI stream, so the
+  // AVX2 kernel is only used on CPUs without the SHA extensions.
+  if(cpuHasAvx512()) {
+    hashLanes = hashAvx512x16;
+    hashLaneCount = 16;
+  } else if(cpuHasAvx2() && hashBlocks == hashPortable) {
+    hashLanes = hashAvx2x8;
+    hashLaneCount = 8;
+  }
+#elif defined(TEENY_SHA256_ARM)
+  if(cpuHasArmV8Sha2()) {
+    hashBlocks = hashArmV8;
+    hashBlocksName = "ARMv8 SHA2";
+  }
+#endif
+}
+#endif
+
+const char* SHA256Implementation(void) {
+  return hashBlocksName;
+}
+
+void SHA256Init(SHA256Context* ctx) {
+  memcpy(ctx->state, H0, sizeof(H0));
+  ctx->msgLen = 0;
+  ctx->blockBufferLen = 0;
+}
+
+void SHA256InitFromMidstate(SHA256Context* ctx, const uint32_t midstate[8], uint64_t msgLen) {
+  memcpy(ctx->state, midstate, sizeof(ctx->state));
+  ctx->msgLen = msgLen;
+  ctx->blockBufferLen = 0;
+}
+
+void SHA256Update(SHA256Context* ctx, const uint8_t* msg, size_t msgLen) {
+  if(msgLen == 0) {
+    return;
+  }
+
+  ctx->msgLen += msgLen;
+
+  if(ctx->blockBufferLen > 0) {
+    size_t fill = 64 - ctx->blockBufferLen;
+    if(fill > msgLen) {
+      fill = msgLen;
     }
 
-    for(size_t j=16; j<64; j++) {
-      uint32_t s0 = rightRotate(W[j-15],7) ^ rightRotate(W[j-15],18) ^ (W[j-15] >> 3);
-      uint32_t s1 = rightRotate(W[j-2],17) ^ rightRotate(W[j-2],19) ^ (W[j-2] >> 10);
-      W[j] = W[j-16] + s0 + W[j-7] + s1;
+    memcpy(ctx->blockBuffer + ctx->blockBufferLen, msg, fill);
+    ctx->blockBufferLen += fill;
+    msg += fill;
+    msgLen -= fill;
+
+    if(ctx->blockBufferLen < 64) {
+      return;
     }
 
-    uint32_t a = H[0];
-    uint32_t b = H[1];
-    uint32_t c = H[2];
-    uint32_t d = H[3];
-    uint32_t e = H[4];
-    uint32_t f = H[5];
-    uint32_t g = H[6];
-    uint32_t h = H[7];
-
-    uint32_t S1,ch,temp1,S0,maj,temp2;
-    for(size_t j=0; j<64; j++) {
-      S1 = rightRotate(e , 6) ^ rightRotate(e , 11) ^ rightRotate(e , 25);
-      ch = (e & f) ^ (~e & g);
-      temp1 = h + S1 + ch + K[j] + W[j];
-      S0 = rightRotate(a , 2) ^ rightRotate(a , 13) ^ rightRotate(a , 22);
-      maj = (a & b) ^ (a & c) ^ (b & c);
-      temp2 = S0 + maj;
-
-      h = g;
-      g = f;
-      f = e;
-      e = d + temp1;
-      d = c;
-      c = b;
-      b = a;
-      a = temp1 + temp2;
-    }
-
-    H[0] = H[0] + a;
-    H[1] = H[1] + b;
-    H[2] = H[2] + c;
-    H[3] = H[3] + d;
-    H[4] = H[4] + e;
-    H[5] = H[5] + f;
-    H[6] = H[6] + g;
-    H[7] = H[7] + h;
-  }
-
-  for(int i=0; i<8; i++) {
-    hashedMsg[i*4 + 0] = (H[i] >> 24) & 0xFF;
-    hashedMsg[i*4 + 1] = (H[i] >> 16) & 0xFF;
-    hashedMsg[i*4 + 2] = (H[i] >> 8) & 0xFF;
-    hashedMsg[i*4 + 3] = (H[i] >> 0) & 0xFF;
+    hashBlocks(ctx->state, ctx->blockBuffer, 1);
+    ctx->blockBufferLen = 0;
+  }
+
+  if(msgLen >= 64) {
+    size_t noOfBlocks = msgLen / 64;
+    hashBlocks(ctx->state, msg, noOfBlocks);
+    msg += noOfBlocks * 64;
+    msgLen -= noOfBlocks * 64;
+  }
+
+  if(msgLen > 0) {
+    memcpy(ctx->blockBuffer, msg, msgLen);
+    ctx->blockBufferLen = msgLen;
+  }
+}
+
+void SHA256Final(SHA256Context* ctx, uint8_t* digest) {
+  uint64_t bitLen = ctx->msgLen * 8;
+  size_t len = ctx->blockBufferLen;
+
+  ctx->blockBuffer[len++] = 0x80;
+
+  if(len > 56) {
+    memset(ctx->blockBuffer + len, 0, 64 - len);
+    hashBlocks(ctx->state, ctx->blockBuffer, 1);
+    len = 0;
+  }
+
+  memset(ctx->blockBuffer + len, 0, 56 - len);
+  for(size_t i = 0; i < 8; i++) {
+    ctx->blockBuffer[56 + i] = (bitLen >> (56 - 8 * i)) & 0xFF;
+  }
+  hashBlocks(ctx->state, ctx->blockBuffer, 1);
+
+  for(size_t i=0; i<8; i++) {
+    digest[i*4 + 0] = (ctx->state[i] >> 24) & 0xFF;
+    digest[i*4 + 1] = (ctx->state[i] >> 16) & 0xFF;
+    digest[i*4 + 2] = (ctx->state[i] >> 8) & 0xFF;
+    digest[i*4 + 3] = (ctx->state[i] >> 0) & 0xFF;
   }
 }
 
+void SHA256HexDigest(const uint8_t* digest, char* hexDigest) {
+  static const char hexChars[] = "0123456789abcdef";
+
+  for(size_t i=0; i<32; i++) {
+    hexDigest[2*i] = hexChars[digest[i] >> 4];
+    hexDigest[2*i + 1] = hexChars[digest[i] & 0x0F];
+  }
+  hexDigest[64] = '\0';
+}
+
 int SHA256(const uint8_t* msg, size_t msgLen, uint8_t* digest, char* hexDigest) {
+  SHA256Context ctx;
 
-  uint8_t* binary = malloc(msgLen * sizeof(uint8_t));
-  if (binary == NULL) {
-    fprintf(stderr, "Memory allocation failed\n");
+  if(digest == NULL || (msg == NULL && msgLen > 0)) {
     return 1;
   }
-  memcpy(binary, msg, msgLen);
 
-  int padLen = 0;
-  if (msgLen % 64 < 56){
-    padLen = 56 - (msgLen % 64);
-  } else {
-    padLen = 64 + 56 - (msgLen % 64);
+  SHA256Init(&ctx);
+  SHA256Update(&ctx, msg, msgLen);
+  SHA256Final(&ctx, digest);
+
+  if (hexDigest) {
+    SHA256HexDigest(digest, hexDigest);
   }
 
-  int paddedMsgLen = msgLen + padLen + 8;
-  uint8_t* paddedBinaryMsg = malloc(paddedMsgLen * sizeof(uint8_t));
-  if(paddedBinaryMsg == NULL) {
-    fprintf(stderr,"Memory allocation failed");
-    free(binary);
+  return 0;
+}
+
+size_t SHA256MultiLanes(void) {
+  return hashLaneCount;
+}
+
+static int compareJobLengths(const void* left, const void* right) {
+  size_t leftLen = (*(const SHA256Job* const*)left)->msgLen;
+  size_t rightLen = (*(const SHA256Job* const*)right)->msgLen;
+
+  return (leftLen < rightLen) - (leftLen > rightLen);
+}
+
+int SHA256Multi(SHA256Job* jobs, size_t noOfJobs) {
+  SHA256Job** order;
+  uint32_t laneState[SHA256_MAX_LANES][8];
+  const uint8_t* lanes[SHA256_MAX_LANES];
+
+  if(jobs == NULL && noOfJobs > 0) {
     return 1;
   }
 
-  padMsg(paddedBinaryMsg, binary, msgLen, padLen);
-  intToBin(paddedBinaryMsg, msgLen+padLen, (uint64_t) msgLen*8);
-  free(binary);
+  for(size_t i = 0; i < noOfJobs; i++) {
+    if(jobs[i].msg == NULL && jobs[i].msgLen > 0) {
+      return 1;
+    }
+  }
 
-  int noOfBlocks = paddedMsgLen/64;
-  uint8_t** blocks = malloc(noOfBlocks * sizeof(uint8_t*));
-  if(blocks == NULL) {
-    fprintf(stderr, "Memory allocation failed\n");
-    free(paddedBinaryMsg);
-    return 1;
+  if(hashLanes == NULL || noOfJobs < 2) {
+    for(size_t i = 0; i < noOfJobs; i++) {
+      SHA256(jobs[i].msg, jobs[i].msgLen, jobs[i].digest, NULL);
+    }
+    return 0;
   }
-  int status = getBlocks(blocks, noOfBlocks, paddedBinaryMsg);
-  if(status != 0) {
-    fprintf(stderr, "Failed to create blocks.");
-    free(paddedBinaryMsg);
+
+  // Hash the longest messages together so the lanes stay balanced.
+  order = malloc(noOfJobs * sizeof(SHA256Job*));
+  if(order == NULL) {
     return 1;
   }
-  free(paddedBinaryMsg);
 
-  uint8_t* hashedMsg = malloc(64 * sizeof(uint8_t));
-  hash(blocks, noOfBlocks, hashedMsg);
-  memcpy(digest, hashedMsg, 32);
+  for(size_t i = 0; i < noOfJobs; i++) {
+    order[i] = &jobs[i];
+  }
+  qsort(order, noOfJobs, sizeof(SHA256Job*), compareJobLengths);
 
-  if (hexDigest) {
-    for(int i=0; i<32; i++) {
-      sprintf(hexDigest + 2*i, "%02x", (unsigned int)digest[i]);
+  for(size_t first = 0; first < noOfJobs; first += hashLaneCount) {
+    size_t groupSize = noOfJobs - first < hashLaneCount ? noOfJobs - first : hashLaneCount;
+    size_t sharedBlocks = order[first + groupSize - 1]->msgLen / 64;
+
+    // Idle lanes re-hash the shortest job of the group and are discarded.
+    for(size_t l = 0; l < hashLaneCount; l++) {
+      const SHA256Job* job = order[first + (l < groupSize ? l : groupSize - 1)];
+      memcpy(laneState[l], H0, sizeof(H0));
+      lanes[l] = job->msg;
     }
-  }
 
-  for(int i=0; i<noOfBlocks; i++) {
-    free(blocks[i]);
+    if(sharedBlocks > 0) {
+      hashLanes(laneState, lanes, sharedBlocks);
+    }
+
+    // Finish whatever each message has left past the shared blocks.
+    for(size_t l = 0; l < groupSize; l++) {
+      SHA256Job* job = order[first + l];
+      SHA256Context ctx;
+
+      memcpy(ctx.state, laneState[l], sizeof(ctx.state));
+      ctx.msgLen = (uint64_t)sharedBlocks * 64;
+      ctx.blockBufferLen = 0;
+      SHA256Update(&ctx, job->msg + sharedBlocks * 64, job->msgLen - sharedBlocks * 64);
+      SHA256Final(&ctx, job->digest);
+    }
   }
-  free(blocks);
-  free(hashedMsg);
+
+  free(order);
   return 0;
 }
+
+#if defined(TEENY_SHA256_X86) || defined(TEENY_SHA256_ARM)
+// Compresses 1, 3 and 17 blocks of data with kernel and with the portable
+// kernel, returning 1 if every state matches.
+static int kernelMatchesPortable(HashBlocksFunc kernel, const uint8_t* data) {
+  static const size_t blockCounts[] = {1, 3, 17};
+
+  for(size_t i = 0; i < sizeof(blockCounts) / sizeof(blockCounts[0]); i++) {
+    uint32_t expected[8];
+    uint32_t actual[8];
+
+    memcpy(expected, H0, sizeof(H0));
+    memcpy(actual, H0, sizeof(H0));
+    hashPortable(expected, data + i * 64, blockCounts[i]);
+    kernel(actual, data + i * 64, blockCounts[i]);
+
+    if(memcmp(expected, actual, sizeof(expected)) != 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+#endif
+
+#if defined(TEENY_SHA256_X86)
+// Compresses 17 blocks in each of laneCount lanes, each starting one block
+// further into data, and returns 1 if every lane matches the portable kernel.
+static int lanesMatchPortable(HashLanesFunc kernel, size_t laneCount, const uint8_t* data) {
+  uint32_t laneState[SHA256_MAX_LANES][8];
+  const uint8_t* lanes[SHA256_MAX_LANES];
+  uint32_t expected[8];
+
+  for(size_t l = 0; l < laneCount; l++) {
+    memcpy(laneState[l], H0, sizeof(H0));
+    lanes[l] = data + l * 64;
+  }
+
+  kernel(laneState, lanes, 17);
+
+  for(size_t l = 0; l < laneCount; l++) {
+    memcpy(expected, H0, sizeof(H0));
+    hashPortable(expected, data + l * 64, 17);
+
+    if(memcmp(expected, laneState[l], sizeof(expected)) != 0) {
+      return 0;
+    }
+  }
+
+  return 1;
+}
+#endif
+
+const char* SHA256CheckKernels(void) {
+#if defined(TEENY_SHA256_X86) || defined(TEENY_SHA256_ARM)
+  uint8_t data[64 * (SHA256_MAX_LANES + 17)];
+  uint32_t seed = 1;
+
+  for(size_t i = 0; i < sizeof(data); i++) {
+    seed = seed * 1103515245u + 12345u;
+    data[i] = (uint8_t)(seed >> 24);
+  }
+
+#if defined(TEENY_SHA256_X86)
+  if(cpuHasShaNi() && !kernelMatchesPortable(hashShaNi, data)) {
+    return "x86 SHA-NI";
+  }
+
+  if(cpuHasAvx2() && !lanesMatchPortable(hashAvx2x8, 8, data)) {
+    return "AVX2 x8";
+  }
+
+  if(cpuHasAvx512() && !lanesMatchPortable(hashAvx512x16, 16, data)) {
+    return "AVX-512 x16";
+  }
+#elif defined(TEENY_SHA256_ARM)
+  if(cpuHasArmV8Sha2() && !kernelMatchesPortable(hashArmV8, data)) {
+    return "ARMv8 SHA2";
+  }
+#endif
+#endif
+
+  return NULL;
+}
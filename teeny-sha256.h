@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Teeny SHA-256
+ *
+ * Declarations for the one-shot SHA256() function and the incremental
+ * context API implemented in teeny-sha256.c.
+ *
+ * Original source repo: https://github.com/CurryB0i/SHA-256-in-C
+ *
+ * Copyright (c) 2025 CurryB0i
+ *
+ * License: MIT, see included LICENSE file for details.
+ ******************************************************************************/
+
+#ifndef TEENY_SHA256_H
+#define TEENY_SHA256_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Running state for an incremental SHA-256 computation.  Full 64-byte blocks
+ * are compressed straight out of the caller's buffer; only a trailing partial
+ * block is ever copied into blockBuffer.
+ */
+typedef struct {
+  uint32_t state[8];
+  uint64_t msgLen;
+  uint8_t blockBuffer[64];
+  size_t blockBufferLen;
+} SHA256Context;
+
+/**
+ * One message for SHA256Multi().  msg and msgLen are inputs; digest receives
+ * the 32-byte hash.
+ */
+typedef struct {
+  const uint8_t* msg;
+  size_t msgLen;
+  uint8_t digest[32];
+} SHA256Job;
+
+/**
+ * Computes the SHA-256 hash of the given input message.
+ *
+ * @param msg        Pointer to the input message (raw bytes).
+ * @param msgLen     Length of the input message in bytes.
+ * @param digest     Pointer to a buffer of at least 32 bytes.
+ *                   The resulting 32-byte hash will be written here.
+ * @param hexDigest  Pointer to a buffer to store an ASCII hex string
+ *                   representation of the SHA256 digest on function return.
+ *                   Must be at least 65 bytes (including space for the
+ *                   null terminator).  May be NULL.
+ *
+ * @return           0 on success, non-zero on failure.
+ */
+int SHA256(const uint8_t* msg, size_t msgLen, uint8_t* digest, char* hexDigest);
+
+/**
+ * Computes the SHA-256 hash of every job in parallel SIMD lanes (sixteen with
+ * AVX-512, eight with AVX2 on CPUs without SHA-NI), falling back to one
+ * SHA256() call per job when no multi-buffer kernel is available.  Jobs of
+ * similar length are grouped together, so collections of equally sized ROM
+ * images keep every lane busy.
+ *
+ * @return           0 on success, non-zero on failure.
+ */
+int SHA256Multi(SHA256Job* jobs, size_t noOfJobs);
+
+/**
+ * Returns the number of messages SHA256Multi() hashes concurrently on this
+ * CPU, or 1 when it falls back to hashing them one at a time.
+ */
+size_t SHA256MultiLanes(void);
+
+/**
+ * Resets a context to the SHA-256 initial hash value.
+ */
+void SHA256Init(SHA256Context* ctx);
+
+/**
+ * Resumes a hash from a midstate.  Whenever msgLen (a multiple of 64) bytes
+ * have been fed to a context, ctx->state holds the midstate for that prefix;
+ * a context restored from a saved copy of it continues exactly as the
+ * original would have.
+ */
+void SHA256InitFromMidstate(SHA256Context* ctx, const uint32_t midstate[8], uint64_t msgLen);
+
+/**
+ * Feeds msgLen bytes of msg into the running hash.  May be called any number
+ * of times with arbitrarily sized pieces of the message.
+ */
+void SHA256Update(SHA256Context* ctx, const uint8_t* msg, size_t msgLen);
+
+/**
+ * Pads the message, writes the 32-byte digest, and leaves the context in an
+ * undefined state until SHA256Init() is called again.
+ */
+void SHA256Final(SHA256Context* ctx, uint8_t* digest);
+
+/**
+ * Writes the 64-character lowercase hex form of a 32-byte digest, plus a
+ * null terminator, into hexDigest.
+ */
+void SHA256HexDigest(const uint8_t* digest, char* hexDigest);
+
+/**
+ * Returns a short name for the compression kernel selected for this CPU
+ * ("x86 SHA-NI", "ARMv8 SHA2" or "portable").  Every kernel produces
+ * byte-identical digests.
+ */
+const char* SHA256Implementation(void);
+
+/**
+ * Runs every single and multi-buffer kernel the running CPU supports, not
+ * just the ones selected, over the same blocks as the portable kernel.
+ *
+ * @return           NULL if they all match it, or the name of the first
+ *                   kernel which doesn't.
+ */
+const char* SHA256CheckKernels(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,593 @@
+/*
+MIT License
+
+Copyright (c) 2026 Christopher Gelatt
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Regression and known-answer checks for the library, the DAT importer and
+// the database generator, run by "make check" with the path to
+// AmigaROMHashGen.  Each check prints what it expected on failure, and the
+// exit status is the number of failed checks.
+
+#include "../AmigaROMDatImport.h"
+#include "../AmigaROMDatabase.h"
+#include "../AmigaROMDigests.h"
+#include "../AmigaROMMerkle.h"
+#include "../AmigaROMSignatures.h"
+#include "../AmigaROMUtil.h"
+#include "../teeny-sha256.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failed_checks = 0;
+
+#define CHECK(condition) CheckCondition((condition), #condition, __FILE__, __LINE__)
+
+static void CheckCondition(const bool condition, const char *description, const char *file, const int line)
+{
+	if(!condition)
+	{
+		printf("FAILED: %s:%d: %s\n", file, line, description);
+		failed_checks++;
+	}
+}
+
+// Returns whether the digest_length byte digest is hex_digest
+static bool DigestIs(const uint8_t *digest, const size_t digest_length, const char *hex_digest)
+{
+	char formatted[65];
+
+	FormatAmigaROMDigest(digest, digest_length, formatted);
+
+	return strcmp(formatted, hex_digest) == 0;
+}
+
+// Fills data with the same pseudo-random bytes for the same seed
+static void FillTestData(uint8_t *data, const size_t size, uint32_t seed)
+{
+	size_t i;
+
+	for(i = 0; i < size; i++)
+	{
+		seed = (seed * 1103515245u) + 12345u;
+		data[i] = (uint8_t)(seed >> 24);
+	}
+}
+
+// Returns the family found in a size byte image of zeros holding pattern
+// at offset, byte swapped first if swap_bytes is set
+static uint8_t ScanPattern(const size_t size, const char *pattern, const size_t offset, const bool swap_bytes)
+{
+	uint8_t *data = calloc(size, 1);
+	uint8_t family, temp;
+	size_t i;
+
+	if(!data)
+	{
+		return AMIGA_ROM_FAMILY_COUNT;
+	}
+
+	memcpy(&data[offset], pattern, strlen(pattern));
+
+	if(swap_bytes)
+	{
+		for(i = 0; i + 1 < size; i += 2)
+		{
+			temp = data[i];
+			data[i] = data[i + 1];
+			data[i + 1] = temp;
+		}
+	}
+
+	family = ScanAmigaROMSignatures(data, size, NULL);
+	free(data);
+
+	return family;
+}
+
+static void CheckSignatures(void)
+{
+	uint8_t *data;
+	size_t i;
+
+	// Images with no signatures in them stay unknown
+	CHECK(ScanPattern(8192, "", 0, false) == AMIGA_ROM_FAMILY_UNKNOWN);
+
+	data = malloc(524288);
+	if(data)
+	{
+		srand(1);
+		for(i = 0; i < 524288; i++)
+		{
+			data[i] = (uint8_t)(rand() & 0xFF);
+		}
+
+		CHECK(ScanAmigaROMSignatures(data, 524288, NULL) == AMIGA_ROM_FAMILY_UNKNOWN);
+		free(data);
+	}
+
+	// Fragments of byte swapped signatures aren't signatures
+	CHECK(ScanPattern(8192, "TD", 101, false) == AMIGA_ROM_FAMILY_UNKNOWN);
+	CHECK(ScanPattern(8192, "C317", 101, false) == AMIGA_ROM_FAMILY_UNKNOWN);
+
+	// Whole signatures are found as stored and byte swapped, wherever they
+	// start
+	CHECK(ScanPattern(8192, "CDTV", 100, false) == AMIGA_ROM_FAMILY_CDTV);
+	CHECK(ScanPattern(8192, "CDTV", 100, true) == AMIGA_ROM_FAMILY_CDTV);
+	CHECK(ScanPattern(8192, "CDTV", 101, true) == AMIGA_ROM_FAMILY_CDTV);
+	CHECK(ScanPattern(8192, "NCR 53C710", 101, true) == AMIGA_ROM_FAMILY_A4091);
+	CHECK(ScanPattern(8192, "WD33C93", 8185, true) == AMIGA_ROM_FAMILY_A590_A2091);
+}
+
+// Keeps the game and ROM handed over by ImportAmigaROMDat
+typedef struct {
+	AmigaROMDatGame game;
+	AmigaROMDatRom rom;
+	size_t rom_count;
+} DatImportResult;
+
+static bool KeepDatRom(const AmigaROMDatGame *game, const AmigaROMDatRom *rom, void *context)
+{
+	DatImportResult *result = (DatImportResult*)context;
+
+	result->game = *game;
+	result->rom = *rom;
+	result->rom_count++;
+
+	return true;
+}
+
+static void CheckDatImport(void)
+{
+	DatImportResult result;
+
+	// CDATA sections are element text
+	memset(&result, 0, sizeof(result));
+	CHECK(ImportAmigaROMDat("tests/dats/cdata.dat", KeepDatRom, &result));
+	CHECK(result.rom_count == 1);
+	CHECK(strcmp(result.game.name, "Kickstart") == 0);
+	CHECK(strcmp(result.game.description, "Kickstart v1.3 <A500> [a] & more") == 0);
+	CHECK(result.rom.has_file_size && result.rom.file_size == 262144);
+
+	// Backslash escapes in clrmamepro strings
+	memset(&result, 0, sizeof(result));
+	CHECK(ImportAmigaROMDat("tests/dats/escaped.dat", KeepDatRom, &result));
+	CHECK(result.rom_count == 1);
+	CHECK(strcmp(result.game.name, "Kickstart \"Hi\"") == 0);
+	CHECK(strcmp(result.game.description, "Kickstart v3.1 \\ \"A4000\"") == 0);
+	CHECK(strcmp(result.rom.name, "kick31 \"hi\".rom") == 0);
+	CHECK(result.rom.has_file_size && result.rom.file_size == 262144);
+}
+
+// FIPS 180-2 vectors, and every SIMD kernel against the portable one
+static void CheckSHA256(void)
+{
+	SHA256Job jobs[40];
+	SHA256Context context;
+	uint8_t digest[32];
+	uint8_t *data;
+	const char *failed_kernel;
+	size_t i;
+
+	SHA256((const uint8_t*)"", 0, digest, NULL);
+	CHECK(DigestIs(digest, 32, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+	SHA256((const uint8_t*)"abc", 3, digest, NULL);
+	CHECK(DigestIs(digest, 32, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+	SHA256((const uint8_t*)"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56, digest, NULL);
+	CHECK(DigestIs(digest, 32, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"));
+
+	data = malloc(1000000);
+	if(!data)
+	{
+		CHECK(data != NULL);
+		return;
+	}
+
+	memset(data, 'a', 1000000);
+	SHA256(data, 1000000, digest, NULL);
+	CHECK(DigestIs(digest, 32, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+
+	// The same message fed in uneven pieces, and resumed from a midstate
+	SHA256Init(&context);
+	for(i = 0; i < 1000000; i += 7777)
+	{
+		SHA256Update(&context, &data[i], (1000000 - i < 7777) ? 1000000 - i : 7777);
+	}
+	SHA256Final(&context, digest);
+	CHECK(DigestIs(digest, 32, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+
+	SHA256Init(&context);
+	SHA256Update(&context, data, 6400);
+	SHA256InitFromMidstate(&context, context.state, 6400);
+	SHA256Update(&context, &data[6400], 1000000 - 6400);
+	SHA256Final(&context, digest);
+	CHECK(DigestIs(digest, 32, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+
+	failed_kernel = SHA256CheckKernels();
+	CHECK(failed_kernel == NULL);
+	if(failed_kernel)
+	{
+		printf("SHA-256 kernel which differs: %s\n", failed_kernel);
+	}
+
+	// Enough jobs of mixed lengths to fill every multi-buffer lane
+	FillTestData(data, 1000000, 2);
+	for(i = 0; i < 40; i++)
+	{
+		jobs[i].msg = &data[i * 997];
+		jobs[i].msgLen = (i * 4099) % 70000;
+	}
+
+	CHECK(SHA256Multi(jobs, 40) == 0);
+	for(i = 0; i < 40; i++)
+	{
+		SHA256(jobs[i].msg, jobs[i].msgLen, digest, NULL);
+		CHECK(memcmp(jobs[i].digest, digest, 32) == 0);
+	}
+
+	free(data);
+}
+
+// CRC-32 check value, RFC 1321 MD5 and FIPS 180-2 SHA-1 vectors, through
+// the one pass digest engine
+static void CheckDigestEngine(void)
+{
+	static const char *million_a_md5 = "7707d6ae4e027c70eea2a935c2296f21";
+	static const char *million_a_sha1 = "34aa973cd4c4daa4f61eeb2bdbad27316534016f";
+	AmigaROMDigestContext digest_context;
+	AmigaROMDigests digests;
+	uint8_t *data;
+	size_t i;
+
+	CHECK(CalculateAmigaROMDigestsFromData((const uint8_t*)"123456789", 9, AMIGA_ROM_DIGEST_ALL, &digests));
+	CHECK(digests.computed_digests == AMIGA_ROM_DIGEST_ALL);
+	CHECK(digests.crc32 == 0xCBF43926);
+
+	CHECK(CalculateAmigaROMDigestsFromData((const uint8_t*)"", 0, AMIGA_ROM_DIGEST_ALL, &digests));
+	CHECK(digests.crc32 == 0);
+	CHECK(DigestIs(digests.md5, 16, "d41d8cd98f00b204e9800998ecf8427e"));
+	CHECK(DigestIs(digests.sha1, 20, "da39a3ee5e6b4b0d3255bfef95601890afd80709"));
+
+	CHECK(CalculateAmigaROMDigestsFromData((const uint8_t*)"abc", 3, AMIGA_ROM_DIGEST_ALL, &digests));
+	CHECK(DigestIs(digests.md5, 16, "900150983cd24fb0d6963f7d28e17f72"));
+	CHECK(DigestIs(digests.sha1, 20, "a9993e364706816aba3e25717850c26c9cd0d89d"));
+	CHECK(DigestIs(digests.sha256, 32, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+
+	CHECK(CalculateAmigaROMDigestsFromData((const uint8_t*)"12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80, AMIGA_ROM_DIGEST_MD5, &digests));
+	CHECK(digests.computed_digests == AMIGA_ROM_DIGEST_MD5);
+	CHECK(DigestIs(digests.md5, 16, "57edf4a22be3c955ac49da2e2107b67a"));
+
+	CHECK(CalculateAmigaROMDigestsFromData((const uint8_t*)"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 56, AMIGA_ROM_DIGEST_SHA1, &digests));
+	CHECK(DigestIs(digests.sha1, 20, "84983e441c3bd26ebaae4aa1f95129e5e54670f1"));
+
+	data = malloc(1000000);
+	if(!data)
+	{
+		CHECK(data != NULL);
+		return;
+	}
+
+	memset(data, 'a', 1000000);
+	CHECK(CalculateAmigaROMDigestsFromData(data, 1000000, AMIGA_ROM_DIGEST_ALL, &digests));
+	CHECK(DigestIs(digests.md5, 16, million_a_md5));
+	CHECK(DigestIs(digests.sha1, 20, million_a_sha1));
+	CHECK(DigestIs(digests.sha256, 32, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+
+	// Uneven pieces cross every block and chunk boundary
+	InitAmigaROMDigestContext(&digest_context, AMIGA_ROM_DIGEST_ALL);
+	for(i = 0; i < 1000000; i += 12345)
+	{
+		UpdateAmigaROMDigestContext(&digest_context, &data[i], (1000000 - i < 12345) ? 1000000 - i : 12345);
+	}
+	FinalizeAmigaROMDigestContext(&digest_context, &digests);
+	CHECK(DigestIs(digests.md5, 16, million_a_md5));
+	CHECK(DigestIs(digests.sha1, 20, million_a_sha1));
+
+	free(data);
+}
+
+// Builds the views and EPROM halves of a merged image byte by byte and
+// checks the one pass digests against them
+static void CheckViewDigests(const size_t image_size)
+{
+	AmigaROMViewDigests view_digests;
+	AmigaROMBankChecksums bank_checksums;
+	AmigaROMBankChecksums swapped_checksums;
+	AmigaROMDigests digests;
+	uint8_t *image, *swapped, *views[AMIGA_ROM_VIEW_COUNT];
+	uint8_t digest[32];
+	size_t half_size = image_size / 2;
+	size_t view_size, i, v;
+
+	image = malloc(image_size);
+	swapped = malloc(image_size);
+	for(v = 0; v < AMIGA_ROM_VIEW_COUNT; v++)
+	{
+		views[v] = malloc(AMIGA_ROM_MIN_SPLIT_VIEW_SIZE > image_size ? AMIGA_ROM_MIN_SPLIT_VIEW_SIZE : image_size);
+	}
+
+	if(!image || !swapped || !views[5])
+	{
+		CHECK(image && swapped && views[5]);
+		return;
+	}
+
+	FillTestData(image, image_size, 3);
+	for(i = 0; i < image_size; i += 2)
+	{
+		swapped[i] = image[i + 1];
+		swapped[i + 1] = image[i];
+	}
+
+	// Hi, Lo, Hi swapped and Lo swapped, in view bit order from bit 2
+	for(i = 0; i < image_size; i += 4)
+	{
+		memcpy(&views[2][i / 2], &image[i], 2);
+		memcpy(&views[3][i / 2], &image[i + 2], 2);
+		memcpy(&views[4][i / 2], &swapped[i], 2);
+		memcpy(&views[5][i / 2], &swapped[i + 2], 2);
+	}
+
+	CHECK(CalculateAmigaROMViewDigests(image, image_size, AMIGA_ROM_VIEW_ALL, &view_digests));
+	CHECK(view_digests.computed_views == AMIGA_ROM_VIEW_ALL);
+
+	SHA256(image, image_size, digest, NULL);
+	CHECK(view_digests.view_size[0] == image_size && memcmp(view_digests.sha256[0], digest, 32) == 0);
+	SHA256(swapped, image_size, digest, NULL);
+	CHECK(view_digests.view_size[1] == image_size && memcmp(view_digests.sha256[1], digest, 32) == 0);
+
+	// Small halves are repeated to fill an EPROM
+	view_size = half_size;
+	while(view_size < AMIGA_ROM_MIN_SPLIT_VIEW_SIZE)
+	{
+		view_size *= 2;
+	}
+
+	for(v = 2; v < AMIGA_ROM_VIEW_COUNT; v++)
+	{
+		for(i = half_size; i < view_size; i += half_size)
+		{
+			memcpy(&views[v][i], views[v], half_size);
+		}
+
+		SHA256(views[v], view_size, digest, NULL);
+		CHECK(view_digests.view_size[v] == view_size && memcmp(view_digests.sha256[v], digest, 32) == 0);
+	}
+
+	// Bank checksums are of the unswapped halves, whichever way round the
+	// image is
+	CHECK(CalculateAmigaROMBankChecksums(image, image_size, false, &bank_checksums));
+	CHECK(CalculateAmigaROMBankChecksums(swapped, image_size, true, &swapped_checksums));
+	CHECK(bank_checksums.bank_count == (half_size + AMIGA_ROM_EPROM_BANK_SIZE - 1) / AMIGA_ROM_EPROM_BANK_SIZE);
+	CHECK(swapped_checksums.bank_count == bank_checksums.bank_count);
+
+	for(i = 0; i < bank_checksums.bank_count; i++)
+	{
+		CHECK(swapped_checksums.hi_crc32[i] == bank_checksums.hi_crc32[i] && swapped_checksums.lo_crc32[i] == bank_checksums.lo_crc32[i]);
+		view_size = (half_size - (i * AMIGA_ROM_EPROM_BANK_SIZE) < AMIGA_ROM_EPROM_BANK_SIZE) ? half_size - (i * AMIGA_ROM_EPROM_BANK_SIZE) : AMIGA_ROM_EPROM_BANK_SIZE;
+
+		CalculateAmigaROMDigestsFromData(&views[2][i * AMIGA_ROM_EPROM_BANK_SIZE], view_size, AMIGA_ROM_DIGEST_CRC32, &digests);
+		CHECK(bank_checksums.hi_crc32[i] == digests.crc32);
+		CalculateAmigaROMDigestsFromData(&views[3][i * AMIGA_ROM_EPROM_BANK_SIZE], view_size, AMIGA_ROM_DIGEST_CRC32, &digests);
+		CHECK(bank_checksums.lo_crc32[i] == digests.crc32);
+	}
+
+	for(v = 0; v < AMIGA_ROM_VIEW_COUNT; v++)
+	{
+		free(views[v]);
+	}
+	free(swapped);
+	free(image);
+}
+
+// Hashes the leaves and nodes by hand, as AmigaROMMerkle.h describes them
+static void CheckMerkleTree(void)
+{
+	static const uint8_t node_prefix = 0x01;
+	AmigaROMMerkleTree merkle_tree = GetInitializedAmigaROMMerkleTree();
+	SHA256Context context;
+	uint8_t leaves[3][32];
+	uint8_t node[32], root[32];
+	uint8_t *data;
+	const size_t data_size = (2 * AMIGA_ROM_MERKLE_LEAF_SIZE) + 1000;
+
+	data = malloc(data_size);
+	if(!data)
+	{
+		CHECK(data != NULL);
+		return;
+	}
+
+	FillTestData(data, data_size, 4);
+	SHA256(data, AMIGA_ROM_MERKLE_LEAF_SIZE, leaves[0], NULL);
+	SHA256(&data[AMIGA_ROM_MERKLE_LEAF_SIZE], AMIGA_ROM_MERKLE_LEAF_SIZE, leaves[1], NULL);
+	SHA256(&data[2 * AMIGA_ROM_MERKLE_LEAF_SIZE], 1000, leaves[2], NULL);
+
+	// The odd leaf is carried up to pair with the first node
+	SHA256Init(&context);
+	SHA256Update(&context, &node_prefix, 1);
+	SHA256Update(&context, leaves[0], 32);
+	SHA256Update(&context, leaves[1], 32);
+	SHA256Final(&context, node);
+
+	SHA256Init(&context);
+	SHA256Update(&context, &node_prefix, 1);
+	SHA256Update(&context, node, 32);
+	SHA256Update(&context, leaves[2], 32);
+	SHA256Final(&context, root);
+
+	CHECK(CalculateAmigaROMMerkleTree(data, data_size, 1, &merkle_tree));
+	CHECK(merkle_tree.leaf_count == 3);
+	CHECK(merkle_tree.leaf_count == 3 && memcmp(merkle_tree.leaves, leaves, sizeof(leaves)) == 0);
+	CHECK(memcmp(merkle_tree.root, root, 32) == 0);
+
+	// More threads than leaves give the same tree
+	CHECK(CalculateAmigaROMMerkleTree(data, data_size, 8, &merkle_tree));
+	CHECK(memcmp(merkle_tree.root, root, 32) == 0);
+
+	CHECK(CalculateAmigaROMMerkleRoot((const uint8_t (*)[32])leaves, 1, node));
+	CHECK(memcmp(node, leaves[0], 32) == 0);
+
+	DestroyAmigaROMMerkleTree(&merkle_tree);
+	free(data);
+}
+
+// Looks every entry of the current database up by its own digest
+static void CheckPerfectHash(void)
+{
+	const AmigaROMDatabase *database = GetAmigaROMDatabase();
+	uint8_t digest[32];
+	size_t i;
+
+	CHECK(database->rom_info_count > 0);
+
+	for(i = 0; i < database->rom_info_count; i++)
+	{
+		CHECK(DetectAmigaROMInfoFromDigest(database->digests[i]) == &(database->rom_info[i]));
+		CHECK(memcmp(database->rom_info[i].sha256_digest, database->digests[i], 32) == 0);
+	}
+
+	memcpy(digest, database->digests[0], 32);
+	digest[31] ^= 0x01;
+	CHECK(DetectAmigaROMInfoFromDigest(digest) == NULL);
+}
+
+// Writes a ROM image and a list naming it, builds a database from them with
+// AmigaROMHashGen, loads it and looks the image and its layouts up
+static void CheckDatabaseRoundTrip(const char *hashgen_path)
+{
+	static const char *image_path = "tests/RoundTrip.rom";
+	static const char *list_path = "tests/RoundTrip.txt";
+	static const char *database_path = "tests/RoundTrip.db";
+	const size_t image_size = 262144;
+	ParsedAmigaROMData amiga_rom = GetInitializedAmigaROM();
+	AmigaROMMerkleTree merkle_tree = GetInitializedAmigaROMMerkleTree();
+	AmigaROMViewDigests view_digests;
+	AmigaROMBankChecksums bank_checksums;
+	const AmigaROMBankChecksum *stored_checksums;
+	const AmigaROMInfo *rom_info, *view_info, *fingerprint_info;
+	uint8_t digest[32];
+	char hex_digest[65];
+	char command[512];
+	uint8_t *image;
+	size_t bank_count = 0;
+	size_t i;
+	FILE *fp;
+
+	image = malloc(image_size);
+	if(!image)
+	{
+		CHECK(image != NULL);
+		return;
+	}
+
+	FillTestData(image, image_size, 5);
+	SHA256(image, image_size, digest, hex_digest);
+
+	fp = fopen(image_path, "wb");
+	CHECK(fp != NULL);
+	if(fp)
+	{
+		fwrite(image, 1, image_size, fp);
+		fclose(fp);
+	}
+
+	fp = fopen(list_path, "w");
+	CHECK(fp != NULL);
+	if(fp)
+	{
+		fprintf(fp, "%s %zu M 0 Round Trip ROM\n", hex_digest, image_size);
+		fclose(fp);
+	}
+
+	snprintf(command, sizeof(command), "%s -l %s -b %s -i %s", hashgen_path, list_path, database_path, image_path);
+	CHECK(system(command) == 0);
+	CHECK(LoadAmigaROMDatabase(database_path));
+
+	rom_info = DetectAmigaROMInfoFromDigest(digest);
+	CHECK(rom_info != NULL);
+	if(rom_info)
+	{
+		CHECK(strcmp(rom_info->version, "Round Trip ROM") == 0);
+		CHECK(rom_info->file_size == image_size);
+
+		// Every other layout is found and leads back to the image
+		CHECK(CalculateAmigaROMViewDigests(image, image_size, AMIGA_ROM_VIEW_ALL & ~AMIGA_ROM_VIEW_AS_IS, &view_digests));
+		for(i = 1; i < AMIGA_ROM_VIEW_COUNT; i++)
+		{
+			view_info = DetectAmigaROMInfoFromDigest(view_digests.sha256[i]);
+			CHECK(view_info != NULL && view_info->canonical == rom_info && view_info->derived_view == (1 << i));
+		}
+
+		amiga_rom.rom_data = image;
+		amiga_rom.rom_size = image_size;
+		CHECK(MatchAmigaROMFingerprint(&amiga_rom, &fingerprint_info) == AMIGA_ROM_FINGERPRINT_UNIQUE);
+		CHECK(fingerprint_info == rom_info);
+
+		CHECK(CalculateAmigaROMMerkleTree(image, image_size, 0, &merkle_tree));
+		CHECK(DetectAmigaROMInfoFromMerkleRoot(merkle_tree.root) == rom_info);
+		DestroyAmigaROMMerkleTree(&merkle_tree);
+
+		stored_checksums = GetAmigaROMBankChecksums(rom_info, &bank_count);
+		CHECK(CalculateAmigaROMBankChecksums(image, image_size, false, &bank_checksums));
+		CHECK(stored_checksums != NULL && bank_count == bank_checksums.bank_count);
+		for(i = 0; stored_checksums && i < bank_count; i++)
+		{
+			CHECK(stored_checksums[i].hi_crc32 == bank_checksums.hi_crc32[i] && stored_checksums[i].lo_crc32 == bank_checksums.lo_crc32[i]);
+		}
+	}
+
+	CheckPerfectHash();
+
+	UseBuiltInAmigaROMDatabase();
+	FreeRetiredAmigaROMDatabases();
+	CHECK(DetectAmigaROMInfoFromDigest(digest) == NULL);
+
+	remove(image_path);
+	remove(list_path);
+	remove(database_path);
+	free(image);
+}
+
+int main(int argc, char **argv)
+{
+	CheckSignatures();
+	CheckDatImport();
+	CheckSHA256();
+	CheckDigestEngine();
+	CheckViewDigests(524288);
+	CheckViewDigests(262144);
+	CheckViewDigests(131072);
+	CheckMerkleTree();
+	CheckPerfectHash();
+	CheckDatabaseRoundTrip((argc > 1) ? argv[1] : "./AmigaROMHashGen");
+
+	if(failed_checks == 0)
+	{
+		printf("All checks passed.\n");
+	}
+
+	return failed_checks;
+}